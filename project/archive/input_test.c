@@ -2,59 +2,23 @@
 // GBA Bare-metal Programming: Input, Movement, and Rendering
 // ---------------------------------------------------------
 
-#include <stdbool.h> // bool 타입을 사용하기 위한 표준 헤더
+#include "../include/gba.h"    // 레지스터 / 색상 / 키 마스크 (REG_KEYINPUT 등 MMIO는 모두 volatile)
+#include "../include/input.h"  // key_poll / key_held / key_hit
 
 // ---------------------------------------------------------
-// 1. 자료형 및 레지스터 정의 (Memory Mapped I/O)
+// 1. 입력 읽기
 // ---------------------------------------------------------
-typedef unsigned short u16;
-typedef unsigned int   u32;
-
-#define REG_BASE        0x04000000
-#define VRAM            ((volatile u16*)0x06000000)
-
-// [레지스터 매핑]
-// volatile 키워드 필수: 하드웨어에 의해 값이 언제든 바뀔 수 있으므로, 
+// volatile 키워드 필수: 하드웨어에 의해 값이 언제든 바뀔 수 있으므로,
 // 컴파일러가 최적화(캐싱)하지 않고 매번 메모리 주소에서 직접 읽도록 강제함.
-#define REG_DISPCNT     (*(volatile u32*)(REG_BASE + 0x0000)) // 디스플레이 제어
-#define REG_VCOUNT      (*(volatile u16*)(REG_BASE + 0x0006)) // 수직 라인 카운터 (Scanline)
-#define REG_KEYINPUT    (*(volatile u16*)(REG_BASE + 0x0130)) // 키 입력 상태
-
-// [설정 상수]
-#define MODE_3          0x0003 // 비트맵 모드 (240x160, 16bit Color)
-#define BG2_ENABLE      0x0400 // 배경 레이어 2 활성화
-#define SCREEN_W        240
-#define SCREEN_H        160
+// 그래서 REG_KEYINPUT을 게임 로직 곳곳에서 읽으면 검사마다 MMIO 읽기가 한 번씩 생기고,
+// 같은 프레임 안에서도 값이 달라질 수 있음.
+// -> 프레임마다 key_poll()로 한 번만 읽고, 나머지는 스냅샷(key_curr / key_prev) 비트 연산.
+//    눌림 = 1 (Active High)로 뒤집혀 있으므로 '!'가 필요 없음.
 
 // ---------------------------------------------------------
 // 2. 색상 및 키 매크로
 // ---------------------------------------------------------
-
-// [RGB 매크로]
-// GBA는 15bit 색상(0BBBBBGGGGGRRRRR)을 사용함.
-// 각 채널 범위: 0 ~ 31
-#define RGB(r, g, b)    ((u16)((r) | ((g) << 5) | ((b) << 10)))
-
-// [기본 색상]
-#define COLOR_BLACK     RGB(0,  0,  0)
-#define COLOR_WHITE     RGB(31, 31, 31)
-#define COLOR_RED       RGB(31, 0,  0)
-#define COLOR_GREEN     RGB(0,  31, 0)
-#define COLOR_BLUE      RGB(0,  0,  31)
-#define COLOR_GOLD      RGB(31, 25, 0)
-
-// [키 마스크]
-// 각 비트가 버튼 하나에 대응됨.
-#define KEY_A           0x0001
-#define KEY_B           0x0002
-#define KEY_SELECT      0x0004
-#define KEY_START       0x0008
-#define KEY_RIGHT       0x0010
-#define KEY_LEFT        0x0020
-#define KEY_UP          0x0040
-#define KEY_DOWN        0x0080
-#define KEY_R           0x0100
-#define KEY_L           0x0200
+// RGB / COLOR_xxx / KEY_xxx는 gba.h에 있음
 
 // ---------------------------------------------------------
 // 3. 전역 상태 변수 (Global State)
@@ -97,15 +61,7 @@ void draw_rect(int x, int y, int w, int h, u16 color) {
     }
 }
 
-// 수직 동기화 (VSync)
-// 화면 갱신 중에 VRAM을 건드리면 '티어링(Tearing)' 현상 발생.
-// 전자총이 그림을 다 그리고 처음으로 돌아가는 VBlank 구간(160~227)을 기다림.
-void sync_vblank() {
-    // 1. 이미 VBlank 중이라면 다음 프레임까지 대기 (Edge Trigger 유도)
-    while (REG_VCOUNT >= 160);
-    // 2. VBlank가 시작될 때까지 대기
-    while (REG_VCOUNT < 160);
-}
+// 수직 동기화 (VSync): sync_vblank()는 gba.h에 있음 (VBlank 구간 160~227을 기다림)
 
 // ---------------------------------------------------------
 // 5. 메인 함수 (Game Loop)
@@ -128,19 +84,18 @@ int main() {
         int old_x = p_x;
         int old_y = p_y;
 
-        // 키 입력 레지스터 읽기
-        u16 key_state = REG_KEYINPUT;
+        // 키 입력 스냅샷 (레지스터는 여기서 한 번만 읽음)
+        key_poll();
 
         // 1-1. 배경 색상 변경 로직
-        // GBA 버튼은 Active Low 방식 (눌림=0, 뗌=1).
-        // 따라서 비트 마스킹 결과가 0일 때가 '눌린 상태'임.
+        // 누르고 있는 동안이 아니라 '눌린 순간'에만 바꾸면 됨 -> key_hit (엣지 검출)
         u16 new_bg_color = background_color;
 
-        if      ( !(key_state & KEY_A) )      new_bg_color = COLOR_RED;
-        else if ( !(key_state & KEY_B) )      new_bg_color = COLOR_GOLD;
-        else if ( !(key_state & KEY_L) )      new_bg_color = COLOR_GREEN;
-        else if ( !(key_state & KEY_R) )      new_bg_color = COLOR_WHITE;
-        else if ( !(key_state & KEY_SELECT) ) new_bg_color = COLOR_BLACK;
+        if      (key_hit(KEY_A))      new_bg_color = COLOR_RED;
+        else if (key_hit(KEY_B))      new_bg_color = COLOR_GOLD;
+        else if (key_hit(KEY_L))      new_bg_color = COLOR_GREEN;
+        else if (key_hit(KEY_R))      new_bg_color = COLOR_WHITE;
+        else if (key_hit(KEY_SELECT)) new_bg_color = COLOR_BLACK;
 
         // [최적화 핵심]
         // 매 프레임 clear_screen을 호출하면 CPU 부하가 심해짐.
@@ -152,11 +107,11 @@ int main() {
             draw_rect(p_x, p_y, p_w, p_h, COLOR_BLUE);
         }
 
-        // 1-2. 이동 로직
-        if ( !(key_state & KEY_UP) )    p_y -= speed;
-        if ( !(key_state & KEY_DOWN) )  p_y += speed;
-        if ( !(key_state & KEY_LEFT) )  p_x -= speed;
-        if ( !(key_state & KEY_RIGHT) ) p_x += speed;
+        // 1-2. 이동 로직 (누르고 있는 동안 계속 이동 -> key_held)
+        if (key_held(KEY_UP))    p_y -= speed;
+        if (key_held(KEY_DOWN))  p_y += speed;
+        if (key_held(KEY_LEFT))  p_x -= speed;
+        if (key_held(KEY_RIGHT)) p_x += speed;
 
         // 화면 밖으로 나가지 않도록 좌표 고정 (Clamping)
         if (p_x < 0) p_x = 0;
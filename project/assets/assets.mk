@@ -0,0 +1,6 @@
+# assets.mk
+# 에셋별 변환 옵션 (makefile이 include). 적지 않은 에셋은 ASSET_FLAGS (--mode tiles4)
+# 옵션을 바꾸면 그 에셋만 다시 변환됩니다. (build/gen/assets/xxx.flags 비교)
+
+# 16x16 마우스 커서 스프라이트: 2x2 타일을 OBJ 1D 순서로, OBJ 타일은 칸마다 뒤집기가 없음
+ASSET_FLAGS_cursor := --mode tiles4 --meta 2x2 --no-flip
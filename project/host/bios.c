@@ -0,0 +1,159 @@
+// bios.c
+// 호스트 빌드용 BIOS 호출 대체 구현 (include/bios.h 참고)
+// ---------------------------------------------------------
+
+#include <stdio.h>
+
+#include "bios.h"
+#include "fixmath.h"
+
+// [CpuSet] 16/32비트 단위 복사 또는 채우기
+void bios_cpu_set(const void* src, void* dst, u32 mode) {
+    u32 count = mode & 0x1FFFFF;
+    int fill  = (mode & CS_FILL) != 0;
+
+    if (mode & CS_32) {
+        const u32* s = (const u32*)src;
+        u32*       d = (u32*)dst;
+        for (u32 i = 0; i < count; ++i) d[i] = fill ? s[0] : s[i];
+    } else {
+        const u16* s = (const u16*)src;
+        u16*       d = (u16*)dst;
+        for (u32 i = 0; i < count; ++i) d[i] = fill ? s[0] : s[i];
+    }
+}
+
+// [CpuFastSet] 실제 BIOS처럼 개수를 8워드 단위로 올림
+void bios_cpu_fast_set(const void* src, void* dst, u32 mode) {
+    u32 count = ((mode & 0x1FFFFF) + 7) & ~7u;
+    bios_cpu_set(src, dst, count | CS_32 | (mode & CS_FILL));
+}
+
+// [Halt] 스캔라인을 진행시키다가 ISR이 한 번이라도 호출되면 깨어남
+void bios_halt(void) {
+    uint32_t start = host_irq_count();
+    while (host_irq_count() == start) {
+        (void)REG_VCOUNT;
+    }
+}
+
+// [Stop] REG_KEYCNT 조건이 맞을 때까지 스캔라인 진행 (키 스크립트가 프레임 끝마다 반영됨)
+// 조건이 끝내 안 맞으면 HOST_FRAMES에서 평소처럼 종료
+void bios_stop(void) {
+    u16 keycnt = REG_KEYCNT;
+    u16 want   = keycnt & KEY_MASK;
+
+    for (;;) {
+        u16 down = (u16)(~REG_KEYINPUT & want);
+        if ((keycnt & KEYCNT_AND) ? (want && down == want) : (down != 0)) break;
+        (void)REG_VCOUNT;
+    }
+    if (keycnt & KEYCNT_IRQ) host_raise_irq(IRQ_KEYPAD);
+}
+
+// [IntrWait] 원하는 플래그가 REG_IFBIOS에 올라올 때까지 Halt 반복
+void bios_intr_wait(bool discard, u16 flags) {
+    if (discard) host_ifbios &= (u16)~flags;
+    while (!(host_ifbios & flags)) {
+        bios_halt();
+    }
+    host_ifbios &= (u16)~flags;
+}
+
+void bios_vblank_intr_wait(void) {
+    bios_intr_wait(true, IRQ_VBLANK);
+}
+
+// [Div] C의 정수 나눗셈과 같은 규칙 (0을 향해 버림)
+s32 bios_div(s32 num, s32 den) {
+    return num / den;
+}
+
+// [Sqrt] 비트 단위 정수 제곱근 (버림)
+u16 bios_sqrt(u32 x) {
+    u32 root = 0;
+    u32 bit  = 1u << 30;
+
+    while (bit > x) bit >>= 2;
+    while (bit) {
+        if (x >= root + bit) {
+            x    -= root + bit;
+            root  = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (u16)root;
+}
+
+// [LZ77UnComp] 플래그 바이트(상위 비트부터) + 리터럴 / (길이 - 3, 거리 - 1) 참조
+// 호스트 메모리는 8비트 쓰기가 되므로 풀기는 같지만, VRAM 버전은 실기에서 깨지는
+// '거리 1' 참조를 만나면 경고를 남김 (실제 BIOS는 16비트씩 쓰므로 직전 바이트가 아직 없음)
+static void lz77_uncomp(const void* src, void* dst, bool vram) {
+    const u8* s    = (const u8*)src;
+    u8*       d    = (u8*)dst;
+    u32       size = (u32)s[1] | ((u32)s[2] << 8) | ((u32)s[3] << 16);
+    u32       out  = 0;
+    bool      warned = false;
+
+    s += 4;
+    while (out < size) {
+        u8 flags = *s++;
+        for (int i = 0; i < 8 && out < size; ++i, flags <<= 1) {
+            if (flags & 0x80) {
+                u32 len  = (u32)(s[0] >> 4) + 3;
+                u32 dist = ((u32)(s[0] & 0x0F) << 8 | s[1]) + 1;
+                s += 2;
+
+                if (vram && dist < 2 && !warned) {
+                    fprintf(stderr, "[host] LZ77UnCompVram: distance-1 reference at byte %u (breaks on hardware)\n", out);
+                    warned = true;
+                }
+                while (len-- && out < size) {
+                    d[out] = d[out - dist];
+                    ++out;
+                }
+            } else {
+                d[out++] = *s++;
+            }
+        }
+    }
+}
+
+void bios_lz77_uncomp_wram(const void* src, void* dst) {
+    lz77_uncomp(src, dst, false);
+}
+
+void bios_lz77_uncomp_vram(const void* src, void* dst) {
+    lz77_uncomp(src, dst, true);
+}
+
+// [BgAffineSet / ObjAffineSet] 실제 BIOS처럼 각도의 상위 8비트만 사용 (256단계)
+// 사인표는 fixmath의 Q12 표를 2칸씩 건너뛰어 씀
+static void rotscale(s16 sx, s16 sy, u16 alpha, s16* pa, s16* pb, s16* pc, s16* pd) {
+    int a   = (alpha >> 8) * 2;
+    int sin = fix_sin_q12(a), cos = fix_cos_q12(a);
+
+    *pa = (s16)((sx * cos) >> 12);
+    *pb = (s16)(-(sx * sin) >> 12);
+    *pc = (s16)((sy * sin) >> 12);
+    *pd = (s16)((sy * cos) >> 12);
+}
+
+void bios_bg_affine_set(const BgAffineSrc* src, BgAffineDst* dst, int count) {
+    for (int i = 0; i < count; ++i, ++src, ++dst) {
+        rotscale(src->sx, src->sy, src->alpha, &dst->pa, &dst->pb, &dst->pc, &dst->pd);
+        dst->x = src->tex_x - (dst->pa * src->scr_x + dst->pb * src->scr_y);
+        dst->y = src->tex_y - (dst->pc * src->scr_x + dst->pd * src->scr_y);
+    }
+}
+
+void bios_obj_affine_set(const ObjAffineSrc* src, void* dst, int count, int offset) {
+    u8* d = (u8*)dst;
+
+    for (int i = 0; i < count; ++i, ++src, d += offset * 4) {
+        rotscale(src->sx, src->sy, src->alpha, (s16*)d, (s16*)(d + offset), (s16*)(d + offset * 2),
+                 (s16*)(d + offset * 3));
+    }
+}
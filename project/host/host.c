@@ -0,0 +1,479 @@
+// host.c
+// 호스트(x86-64 리눅스) 시뮬레이션 레이어: 가짜 메모리 맵 + 결정적 프레임 드라이버
+// ---------------------------------------------------------
+// make host 빌드에서만 링크됩니다. 자세한 설명은 include/host.h 참고.
+
+#define _POSIX_C_SOURCE 199309L // clock_gettime
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "gba.h"
+
+// ---------------------------------------------------------
+// 1. 가짜 메모리 맵
+// ---------------------------------------------------------
+// 실제 하드웨어처럼 32비트 정렬을 보장해야 u32 접근이 안전함.
+uint16_t host_io[HOST_IO_SIZE / 2]     __attribute__((aligned(4)));
+uint16_t host_pal[HOST_PAL_SIZE / 2]   __attribute__((aligned(4)));
+uint16_t host_vram[HOST_VRAM_SIZE / 2] __attribute__((aligned(4)));
+uint16_t host_oam[HOST_OAM_SIZE / 2]   __attribute__((aligned(4)));
+
+#define VCOUNT_MAX      228 // 0 ~ 227 (160줄 VDraw + 68줄 VBlank)
+#define KEY_MASK_ALL    0x03FF
+#define CYCLES_PER_SECOND    16777216u
+#define CYCLES_PER_LINE_HOST 1232u
+
+// ---------------------------------------------------------
+// 2. 키 입력 스크립트
+// ---------------------------------------------------------
+// 파일 형식 (한 줄에 하나, '#'은 주석):
+//   <프레임 번호> [키 이름...]
+// 해당 프레임부터 다음 줄이 나올 때까지 나열한 키를 누르고 있음.
+// 키 이름이 없으면 모든 키를 뗌. 프레임 번호는 오름차순이어야 함.
+//   예)  0   RIGHT
+//        30  RIGHT A
+//        60
+typedef struct {
+    uint32_t frame;
+    uint16_t held; // 눌린 키 비트 (Active High, 레지스터에 쓸 때 반전)
+} KeyEvent;
+
+#define MAX_KEY_EVENTS 4096
+
+static KeyEvent key_events[MAX_KEY_EVENTS];
+static int      key_event_count = 0;
+static int      key_event_next  = 0;
+static uint16_t key_held        = 0;
+
+static const struct { const char* name; uint16_t mask; } key_names[] = {
+    { "A", KEY_A }, { "B", KEY_B }, { "SELECT", KEY_SELECT }, { "START", KEY_START },
+    { "RIGHT", KEY_RIGHT }, { "LEFT", KEY_LEFT }, { "UP", KEY_UP }, { "DOWN", KEY_DOWN },
+    { "R", KEY_R }, { "L", KEY_L },
+};
+
+static void load_key_script(const char* path) {
+    FILE* fp = fopen(path, "r");
+    if (!fp) {
+        fprintf(stderr, "[host] cannot open key script: %s\n", path);
+        exit(1);
+    }
+
+    char line[256];
+    int  line_no = 0;
+    while (fgets(line, sizeof(line), fp) && key_event_count < MAX_KEY_EVENTS) {
+        ++line_no;
+        char* hash = strchr(line, '#');
+        if (hash) *hash = '\0';
+
+        char* tok = strtok(line, " \t\r\n");
+        if (!tok) continue; // 빈 줄
+
+        KeyEvent ev = { (uint32_t)strtoul(tok, NULL, 10), 0 };
+        while ((tok = strtok(NULL, " \t\r\n")) != NULL) {
+            size_t i;
+            for (i = 0; i < sizeof(key_names) / sizeof(key_names[0]); ++i) {
+                if (strcmp(tok, key_names[i].name) == 0) break;
+            }
+            if (i == sizeof(key_names) / sizeof(key_names[0])) {
+                fprintf(stderr, "[host] %s:%d: unknown key '%s'\n", path, line_no, tok);
+                exit(1);
+            }
+            ev.held |= key_names[i].mask;
+        }
+        key_events[key_event_count++] = ev;
+    }
+    fclose(fp);
+}
+
+// 새 프레임에 들어갈 때 스크립트를 재생하여 REG_KEYINPUT 갱신
+static void apply_key_script(uint32_t frame) {
+    while (key_event_next < key_event_count && key_events[key_event_next].frame <= frame) {
+        key_held = key_events[key_event_next].held;
+        ++key_event_next;
+    }
+    REG_KEYINPUT = (u16)(~key_held & KEY_MASK_ALL); // Active Low
+}
+
+// ---------------------------------------------------------
+// 3. 프레임 시간 측정
+// ---------------------------------------------------------
+static uint32_t frame_limit = 600;
+static uint32_t frames      = 0;
+static uint64_t frame_start_ns;
+static uint64_t total_ns, min_ns = UINT64_MAX, max_ns;
+static const char* dump_path = NULL;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// FNV-1a: 화면 결과를 숫자 하나로 요약 (회귀 테스트에서 비교용)
+static uint32_t vram_hash(void) {
+    const uint8_t* p = (const uint8_t*)host_vram;
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < sizeof(host_vram); ++i) {
+        h = (h ^ p[i]) * 16777619u;
+    }
+    return h;
+}
+
+// 현재 화면을 PPM(P6, 240x160)으로 저장. BGR555 -> RGB888 변환.
+// REG_DISPCNT의 모드와 페이지 비트를 보고 실제로 '보이는' 화면을 해석함.
+// (Mode 5의 160x128 밖 영역은 검정)
+static u16 screen_pixel(int x, int y) {
+    u32 dispcnt = REG_DISPCNT;
+    u32 page    = (dispcnt & DCNT_PAGE) ? 0xA000 / 2 : 0;
+
+    switch (dispcnt & 7) {
+        case 4: {
+            u16 pair = host_vram[page + (y * SCREEN_W + x) / 2];
+            return host_pal[(x & 1) ? (pair >> 8) : (pair & 0xFF)];
+        }
+        case 5:
+            if (x >= 160 || y >= 128) return 0;
+            return host_vram[page + y * 160 + x];
+        default:
+            return host_vram[y * SCREEN_W + x];
+    }
+}
+
+static void dump_screen(const char* path) {
+    FILE* fp = fopen(path, "wb");
+    if (!fp) {
+        fprintf(stderr, "[host] cannot write dump: %s\n", path);
+        return;
+    }
+    fprintf(fp, "P6\n%d %d\n255\n", SCREEN_W, SCREEN_H);
+    for (int y = 0; y < SCREEN_H; ++y) {
+        for (int x = 0; x < SCREEN_W; ++x) {
+            u16 c = screen_pixel(x, y);
+            uint8_t rgb[3] = {
+                (uint8_t)(((c      ) & 31) << 3),
+                (uint8_t)(((c >>  5) & 31) << 3),
+                (uint8_t)(((c >> 10) & 31) << 3),
+            };
+            fwrite(rgb, 1, 3, fp);
+        }
+    }
+    fclose(fp);
+}
+
+static void sound_report(void); // 7절
+
+static void host_report(void) {
+    if (dump_path) dump_screen(dump_path);
+
+    printf("[host] frames: %u\n", frames);
+    if (frames > 0) {
+        printf("[host] frame cpu time (us): avg %.2f  min %.2f  max %.2f\n",
+               (double)total_ns / frames / 1000.0,
+               (double)min_ns / 1000.0, (double)max_ns / 1000.0);
+    }
+    sound_report();
+    host_save_report();
+    printf("[host] vram hash: %08x\n", vram_hash());
+}
+
+// 한 프레임이 끝남 (스캔라인 159 -> 160)
+static void end_of_frame(void) {
+    uint64_t t  = now_ns();
+    uint64_t dt = t - frame_start_ns;
+
+    total_ns += dt;
+    if (dt < min_ns) min_ns = dt;
+    if (dt > max_ns) max_ns = dt;
+
+    if (++frames >= frame_limit) {
+        exit(0); // atexit(host_report)가 결과 출력
+    }
+
+    apply_key_script(frames);
+    frame_start_ns = now_ns(); // 키 스크립트 처리 시간은 제외
+}
+
+// ---------------------------------------------------------
+// 4. 인터럽트 흉내
+// ---------------------------------------------------------
+// 실제 하드웨어의 REG_IF는 '1을 써서 지우는' 레지스터지만 여기서는 평범한 메모리라,
+// ISR이 끝난 뒤 허용된(IE) 비트를 호스트가 대신 지움. 중첩 인터럽트는 없음.
+void (*volatile host_isr)(void) = NULL;
+volatile uint16_t host_ifbios   = 0;
+
+static uint32_t irq_dispatched = 0;
+static bool     in_isr         = false;
+
+void host_raise_irq(uint16_t mask) {
+    REG_IF |= mask;
+    if (in_isr || !REG_IME || !host_isr) return;
+
+    uint16_t pending = REG_IE & REG_IF;
+    if (!pending) return;
+
+    in_isr = true;
+    host_isr();
+    in_isr = false;
+
+    REG_IF &= (u16)~pending;
+    ++irq_dispatched;
+}
+
+uint32_t host_irq_count(void) {
+    return irq_dispatched;
+}
+
+// ---------------------------------------------------------
+// 5. 가상 스캔라인 카운터
+// ---------------------------------------------------------
+static void dma_trigger(uint32_t timing); // 6절
+static void sound_line(void);             // 7절
+
+volatile uint16_t* host_vcount(void) {
+    volatile uint16_t* vcount = &host_io[0x0006 / 2];
+    uint16_t line = (uint16_t)((*vcount + 1) % VCOUNT_MAX);
+    uint16_t stat = REG_DISPSTAT & ~(DSTAT_IN_VBL | DSTAT_IN_HBL | DSTAT_IN_VCT);
+    uint16_t irqs = 0;
+
+    *vcount = line;
+
+    if (line >= SCREEN_H && line < VCOUNT_MAX - 1) stat |= DSTAT_IN_VBL;
+    if (line == (stat >> 8))                      stat |= DSTAT_IN_VCT;
+    REG_DISPSTAT = stat;
+
+    if (line == SCREEN_H) end_of_frame();
+
+    // HBlank DMA는 화면을 그리는 줄(0~159)의 HBlank에서만
+    if (line >= 1 && line <= SCREEN_H) dma_trigger(DMA_AT_HBLANK);
+    if (line == SCREEN_H)              dma_trigger(DMA_AT_VBLANK);
+    sound_line();
+    host_save_line();
+
+    // 한 줄 진행 = 직전 줄의 HBlank를 지나온 것으로 간주
+    if (stat & DSTAT_HBL_IRQ)                                  irqs |= IRQ_HBLANK;
+    if ((stat & DSTAT_VBL_IRQ) && line == SCREEN_H)            irqs |= IRQ_VBLANK;
+    if ((stat & DSTAT_VCT_IRQ) && (stat & DSTAT_IN_VCT))       irqs |= IRQ_VCOUNT;
+    if (irqs) host_raise_irq(irqs);
+
+    return vcount;
+}
+
+uint32_t host_frame_count(void) {
+    return frames;
+}
+
+// ---------------------------------------------------------
+// 6. DMA / 사이클 카운터
+// ---------------------------------------------------------
+// 실제 DMA처럼 단위(16/32비트)와 주소 증감 모드를 그대로 따름.
+// 개수 0은 하드웨어와 같이 최대치(0x10000)로 취급.
+// DMA_AT_HBLANK / DMA_AT_VBLANK는 채널에 걸어 두었다가 가상 스캔라인이 그 시점을 지날 때 실행.
+typedef struct {
+    const volatile uint8_t* src;
+    volatile uint8_t*       dst;
+    volatile uint8_t*       dst_start; // DMA_DST_RELOAD용
+    uint32_t                ctrl;      // 0 = 꺼짐
+} HostDmaChannel;
+
+static HostDmaChannel dma_ch[4];
+
+static void dma_run(HostDmaChannel* c) {
+    uint32_t count = c->ctrl & 0xFFFF;
+    int      size  = (c->ctrl & DMA_32) ? 4 : 2;
+    intptr_t s_step, d_step;
+
+    if (count == 0) count = 0x10000;
+
+    switch (c->ctrl & (DMA_SRC_FIXED | DMA_SRC_DEC)) {
+        case DMA_SRC_FIXED: s_step = 0;     break;
+        case DMA_SRC_DEC:   s_step = -size; break;
+        default:            s_step = size;  break;
+    }
+    switch (c->ctrl & DMA_DST_RELOAD) {
+        case DMA_DST_FIXED: d_step = 0;     break;
+        case DMA_DST_DEC:   d_step = -size; break;
+        default:            d_step = size;  break;
+    }
+
+    for (uint32_t i = 0; i < count; ++i, c->src += s_step, c->dst += d_step) {
+        if (size == 4) *(volatile uint32_t*)c->dst = *(const volatile uint32_t*)c->src;
+        else           *(volatile uint16_t*)c->dst = *(const volatile uint16_t*)c->src;
+    }
+
+    if ((c->ctrl & DMA_DST_RELOAD) == DMA_DST_RELOAD) c->dst = c->dst_start;
+    if (!(c->ctrl & DMA_REPEAT) || (c->ctrl & DMA_AT_SPECIAL) == DMA_NOW) c->ctrl = 0;
+}
+
+void host_dma(int ch, const volatile void* src, volatile void* dst, uint32_t ctrl) {
+    HostDmaChannel* c = &dma_ch[ch & 3];
+
+    c->src       = (const volatile uint8_t*)src;
+    c->dst       = (volatile uint8_t*)dst;
+    c->dst_start = c->dst;
+    c->ctrl      = (ctrl & DMA_ENABLE) ? ctrl : 0;
+
+    if (c->ctrl && (ctrl & DMA_AT_SPECIAL) == DMA_NOW) dma_run(c);
+}
+
+// timing = DMA_AT_HBLANK / DMA_AT_VBLANK 채널 실행 (번호가 작은 채널이 먼저)
+static void dma_trigger(uint32_t timing) {
+    for (int i = 0; i < 4; ++i) {
+        if (dma_ch[i].ctrl && (dma_ch[i].ctrl & DMA_AT_SPECIAL) == timing) dma_run(&dma_ch[i]);
+    }
+}
+
+// ---------------------------------------------------------
+// 7. Direct Sound (FIFO 재생 + WAV 기록)
+// ---------------------------------------------------------
+// 줄마다 1232사이클씩 쌓아서 타이머 0 주기마다 FIFO A/B에서 1바이트씩 꺼냄. (타이머 1 배정은 흉내 안 냄)
+// 꺼낸 뒤 16바이트 이하가 되면 그 FIFO를 대상으로 걸린 DMA_AT_SPECIAL 채널(1, 2)이 4워드를 채움.
+// 실제 하드웨어처럼 DMA 개수는 무시.
+// HOST_WAV가 있으면 꺼낸 샘플을 SOUNDCNT_H의 좌우/볼륨 설정대로 합쳐 16비트 스테레오 WAV로 저장.
+#define FIFO_SIZE 32
+
+typedef struct {
+    int8_t   q[FIFO_SIZE];
+    int      head, count;
+} HostFifo;
+
+static HostFifo    fifo[2];
+static uint32_t    sound_acc       = 0;
+static uint32_t    fifo_underruns  = 0;
+static const char* wav_path        = NULL;
+static FILE*       wav_fp          = NULL;
+static uint32_t    wav_samples     = 0;
+
+static void fifo_refill(int which) {
+    volatile void* target = which ? (volatile void*)&REG_FIFO_B : (volatile void*)&REG_FIFO_A;
+    HostFifo*      f      = &fifo[which];
+
+    for (int ch = 1; ch <= 2; ++ch) {
+        HostDmaChannel* c = &dma_ch[ch];
+        if (!c->ctrl || (c->ctrl & DMA_AT_SPECIAL) != DMA_AT_SPECIAL || c->dst != target) continue;
+
+        for (int w = 0; w < 4 && f->count <= FIFO_SIZE - 4; ++w, c->src += 4) {
+            uint32_t word = *(const volatile uint32_t*)c->src;
+            for (int b = 0; b < 4; ++b) {
+                f->q[(f->head + f->count) % FIFO_SIZE] = (int8_t)(word >> (b * 8));
+                ++f->count;
+            }
+        }
+        return;
+    }
+}
+
+static int fifo_pop(int which) {
+    HostFifo* f = &fifo[which];
+    int       v = 0;
+
+    if (f->count == 0) fifo_refill(which); // 초기화 직후: DMA가 먼저 채움
+    if (f->count > 0) {
+        v       = f->q[f->head];
+        f->head = (f->head + 1) % FIFO_SIZE;
+        --f->count;
+    } else {
+        ++fifo_underruns;
+    }
+    if (f->count <= FIFO_SIZE / 2) fifo_refill(which);
+    return v;
+}
+
+static void wav_header(uint32_t rate, uint32_t samples) {
+    uint32_t bytes = samples * 4;
+    uint8_t  h[44] = { 'R', 'I', 'F', 'F', 0, 0, 0, 0, 'W', 'A', 'V', 'E', 'f', 'm', 't', ' ',
+                       16, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 16, 0,
+                       'd', 'a', 't', 'a', 0, 0, 0, 0 };
+
+    for (int i = 0; i < 4; ++i) {
+        h[4 + i]  = (uint8_t)((36 + bytes) >> (i * 8));
+        h[24 + i] = (uint8_t)(rate >> (i * 8));
+        h[28 + i] = (uint8_t)((rate * 4) >> (i * 8));
+        h[40 + i] = (uint8_t)(bytes >> (i * 8));
+    }
+    fseek(wav_fp, 0, SEEK_SET);
+    fwrite(h, 1, sizeof(h), wav_fp);
+    fseek(wav_fp, 0, SEEK_END);
+}
+
+static void wav_write(int a, int b) {
+    u16 cnt   = REG_SOUNDCNT_H;
+    int va    = a * ((cnt & SDS_A100) ? 2 : 1);
+    int vb    = b * ((cnt & SDS_B100) ? 2 : 1);
+    int left  = ((cnt & SDS_AL) ? va : 0) + ((cnt & SDS_BL) ? vb : 0);
+    int right = ((cnt & SDS_AR) ? va : 0) + ((cnt & SDS_BR) ? vb : 0);
+    int16_t s[2];
+
+    left  *= 64;
+    right *= 64;
+    s[0] = (int16_t)(left  > 32767 ? 32767 : left  < -32768 ? -32768 : left);
+    s[1] = (int16_t)(right > 32767 ? 32767 : right < -32768 ? -32768 : right);
+    fwrite(s, sizeof(s), 1, wav_fp);
+    ++wav_samples;
+}
+
+// 한 줄(1232사이클) 동안 재생된 샘플 처리
+static void sound_line(void) {
+    if (!(REG_SOUNDCNT_X & SNDSTAT_ENABLE) || !(REG_TM_CNT_H(0) & TM_ENABLE)) return;
+
+    // FIFO 초기화 비트는 쓰기 전용이라 여기서 처리하고 지움
+    if (REG_SOUNDCNT_H & SDS_ARESET) { fifo[0].count = 0; REG_SOUNDCNT_H &= (u16)~SDS_ARESET; }
+    if (REG_SOUNDCNT_H & SDS_BRESET) { fifo[1].count = 0; REG_SOUNDCNT_H &= (u16)~SDS_BRESET; }
+
+    uint32_t period = 0x10000u - REG_TM_CNT_L(0);
+
+    if (wav_path && !wav_fp) {
+        wav_fp = fopen(wav_path, "wb");
+        if (!wav_fp) {
+            fprintf(stderr, "[host] cannot write wav: %s\n", wav_path);
+            wav_path = NULL;
+        } else {
+            wav_header(CYCLES_PER_SECOND / period, 0);
+        }
+    }
+
+    for (sound_acc += CYCLES_PER_LINE_HOST; sound_acc >= period; sound_acc -= period) {
+        int a = fifo_pop(0);
+        int b = fifo_pop(1);
+        if (wav_fp) wav_write(a, b);
+    }
+}
+
+static void sound_report(void) {
+    if (!wav_fp && !fifo_underruns) return;
+
+    if (wav_fp) {
+        wav_header(CYCLES_PER_SECOND / (0x10000u - REG_TM_CNT_L(0)), wav_samples);
+        fclose(wav_fp);
+        printf("[host] wav: %s (%u samples)\n", wav_path, wav_samples);
+    }
+    printf("[host] sound fifo underruns: %u\n", fifo_underruns);
+}
+
+static uint64_t start_ns;
+
+uint32_t host_cycles(void) {
+    // 16.78MHz = 1 사이클당 약 59.6ns
+    return (uint32_t)((now_ns() - start_ns) * 16777216ull / 1000000000ull);
+}
+
+// ---------------------------------------------------------
+// 8. 초기화 (main보다 먼저 실행)
+// ---------------------------------------------------------
+__attribute__((constructor))
+static void host_init(void) {
+    const char* env;
+
+    if ((env = getenv("HOST_FRAMES")) != NULL) frame_limit = (uint32_t)strtoul(env, NULL, 10);
+    if ((env = getenv("HOST_KEYS")) != NULL)   load_key_script(env);
+    dump_path = getenv("HOST_DUMP");
+    wav_path  = getenv("HOST_WAV");
+
+    if (frame_limit == 0) frame_limit = 1;
+
+    apply_key_script(0);
+    atexit(host_report);
+    start_ns = frame_start_ns = now_ns();
+}
@@ -0,0 +1,227 @@
+// save.c
+// 호스트 빌드용 카트리지 세이브 칩 흉내: SRAM / Flash 64KB / Flash 128KB (include/host.h 참고)
+// ---------------------------------------------------------
+// 칩 내용은 HOST_SAV 파일과 주고받고, HOST_SAVE_CUT으로 전원 차단 지점을 정할 수 있음.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gba.h"
+
+#define SAVE_MAX_SIZE       0x20000
+#define FLASH_SECTOR_SIZE   0x1000
+#define FLASH_BANK_SIZE     0x10000
+
+// 섹터 지우기 약 25ms, 칩 전체 지우기 약 1초 (한 줄 = 1232사이클 = 73.4us)
+#define ERASE_SECTOR_LINES  340
+#define ERASE_CHIP_LINES    13600
+
+// Flash 명령 해석 상태
+enum { CMD_IDLE, CMD_AA, CMD_55 };
+enum { NEXT_NONE, NEXT_PROGRAM, NEXT_BANK };
+
+static uint8_t     chip[SAVE_MAX_SIZE];
+static int         type       = HOST_SAVE_FLASH128;
+static uint32_t    size       = SAVE_MAX_SIZE;
+static const char* path       = NULL;
+static bool        used       = false;
+
+static int         cmd_state  = CMD_IDLE;
+static int         next_write = NEXT_NONE;
+static bool        id_mode    = false;
+static bool        erase_arm  = false; // 0x80을 받음 -> 다음 명령이 섹터/칩 지우기
+static uint32_t    bank       = 0;
+static uint32_t    busy_lines = 0;
+
+static uint32_t    cut_at     = 0;     // 0 = 전원 차단 없음
+static uint32_t    events     = 0;     // 지금까지 시작한 쓰기 수
+static uint32_t    programs   = 0;
+static uint32_t    erases     = 0;
+
+static const char* type_name(void) {
+    switch (type) {
+        case HOST_SAVE_SRAM:    return "sram";
+        case HOST_SAVE_FLASH64: return "flash64";
+        default:                return "flash128";
+    }
+}
+
+static void save_file(void) {
+    if (!path) return;
+
+    FILE* fp = fopen(path, "wb");
+    if (!fp) {
+        fprintf(stderr, "[host] cannot write save: %s\n", path);
+        return;
+    }
+    fwrite(chip, 1, size, fp);
+    fclose(fp);
+}
+
+// ---------------------------------------------------------
+// 1. 전원 차단
+// ---------------------------------------------------------
+// 쓰기(바이트 하나 / 섹터 지우기)를 시작할 때마다 세고, cut_at번째는 일부만 반영한 뒤 종료.
+// 어디까지 반영되는지는 cut_at으로 정한 의사 난수 (같은 N이면 같은 결과)
+static uint32_t cut_rand(void) {
+    static uint32_t x = 0;
+    if (!x) x = cut_at * 2654435761u | 1;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return x;
+}
+
+static void power_cut(void) {
+    save_file();
+    printf("[host] save: power cut at write %u\n", events);
+    exit(0); // atexit(host_report)가 결과 출력
+}
+
+// 반환값: 이번 쓰기가 전원 차단 지점인지
+static bool begin_event(void) {
+    used = true;
+    return cut_at && ++events == cut_at;
+}
+
+// ---------------------------------------------------------
+// 2. Flash 명령
+// ---------------------------------------------------------
+static uint16_t flash_id(void) {
+    return (type == HOST_SAVE_FLASH64) ? 0x1CC2 : 0x09C2; // 장치 << 8 | 제조사 (Macronix)
+}
+
+static void erase_range(uint32_t start, uint32_t len, uint32_t lines) {
+    if (begin_event()) {
+        // 지우기 도중 차단: 앞쪽 일부만 지워지고 경계 바이트는 깨짐
+        uint32_t done = cut_rand() % len;
+        memset(&chip[start], 0xFF, done);
+        chip[start + done] &= (uint8_t)cut_rand();
+        power_cut();
+    }
+    memset(&chip[start], 0xFF, len);
+    busy_lines = lines;
+    ++erases;
+}
+
+static void flash_program(uint32_t addr, uint8_t v) {
+    if (begin_event()) {
+        // 쓰기 도중 차단: 0이 되어야 할 비트 중 일부만 0이 됨
+        chip[addr] &= (uint8_t)(v | cut_rand());
+        power_cut();
+    }
+    chip[addr] &= v; // Flash는 1 -> 0만 가능 (0 -> 1은 지우기로만)
+    ++programs;
+}
+
+static void flash_write(uint32_t off, uint8_t v) {
+    off &= 0xFFFF;
+    if (busy_lines) return; // 지우는 중에는 명령을 받지 않음
+
+    if (next_write == NEXT_PROGRAM) {
+        next_write = NEXT_NONE;
+        flash_program(bank + off, v);
+        return;
+    }
+    if (next_write == NEXT_BANK) {
+        next_write = NEXT_NONE;
+        if (off == 0 && type == HOST_SAVE_FLASH128) bank = (v & 1) * FLASH_BANK_SIZE;
+        return;
+    }
+
+    if (cmd_state == CMD_IDLE && off == 0x5555 && v == 0xAA) { cmd_state = CMD_AA; return; }
+    if (cmd_state == CMD_AA   && off == 0x2AAA && v == 0x55) { cmd_state = CMD_55; return; }
+    if (cmd_state != CMD_55) {
+        cmd_state = CMD_IDLE;
+        return;
+    }
+    cmd_state = CMD_IDLE;
+
+    // 명령 바이트: 0x30은 섹터 주소에, 나머지는 0x5555에 씀
+    if (erase_arm) {
+        erase_arm = false;
+        if (v == 0x30)                 erase_range(bank + (off & ~(FLASH_SECTOR_SIZE - 1)), FLASH_SECTOR_SIZE, ERASE_SECTOR_LINES);
+        if (v == 0x10 && off == 0x5555) erase_range(0, size, ERASE_CHIP_LINES);
+        return;
+    }
+    if (off != 0x5555) return;
+
+    switch (v) {
+        case 0x90: id_mode    = true;         break;
+        case 0xF0: id_mode    = false;        break;
+        case 0x80: erase_arm  = true;         break;
+        case 0xA0: next_write = NEXT_PROGRAM; break;
+        case 0xB0: next_write = NEXT_BANK;    break;
+        default:                              break;
+    }
+}
+
+// ---------------------------------------------------------
+// 3. 버스 (SRAM_READ / SRAM_WRITE)
+// ---------------------------------------------------------
+uint8_t host_save_read(uint32_t off) {
+    if (type == HOST_SAVE_SRAM) return chip[off % size];
+
+    off &= 0xFFFF;
+    if (busy_lines) return 0x00; // 지우는 중 (데이터 폴링: 다 지워지면 0xFF가 읽힘)
+    if (id_mode && off < 2) return (uint8_t)(flash_id() >> (off * 8));
+    return chip[(bank + off) % size];
+}
+
+void host_save_write(uint32_t off, uint8_t v) {
+    if (type == HOST_SAVE_SRAM) {
+        if (begin_event() && (cut_rand() & 1)) power_cut(); // 바이트 쓰기는 되거나 안 되거나
+        chip[off % size] = v;
+        if (cut_at && events == cut_at) power_cut();
+        ++programs;
+        return;
+    }
+    flash_write(off, v);
+}
+
+int host_save_type(void) {
+    return type;
+}
+
+void host_save_line(void) {
+    if (busy_lines) --busy_lines;
+}
+
+void host_save_report(void) {
+    if (!used && !path) return;
+
+    save_file();
+    printf("[host] save: %s %u bytes written, %u sector erases%s%s\n", type_name(), programs, erases,
+           path ? " -> " : "", path ? path : "");
+}
+
+// ---------------------------------------------------------
+// 4. 초기화 (main보다 먼저 실행)
+// ---------------------------------------------------------
+__attribute__((constructor))
+static void host_save_init(void) {
+    const char* env;
+
+    if ((env = getenv("HOST_SAVE_TYPE")) != NULL) {
+        if      (strcmp(env, "sram") == 0)    type = HOST_SAVE_SRAM;
+        else if (strcmp(env, "flash64") == 0) type = HOST_SAVE_FLASH64;
+        else                                  type = HOST_SAVE_FLASH128;
+    }
+    size = (type == HOST_SAVE_SRAM) ? 0x8000 : (type == HOST_SAVE_FLASH64) ? 0x10000 : 0x20000;
+
+    if ((env = getenv("HOST_SAVE_CUT")) != NULL) cut_at = (uint32_t)strtoul(env, NULL, 10);
+
+    // 빈 칩 = 모두 0xFF (Flash를 지운 상태, SRAM도 같게 둠)
+    memset(chip, 0xFF, sizeof(chip));
+
+    path = getenv("HOST_SAV");
+    if (path) {
+        FILE* fp = fopen(path, "rb");
+        if (fp) {
+            size_t n = fread(chip, 1, size, fp);
+            (void)n;
+            fclose(fp);
+        }
+    }
+}
@@ -0,0 +1,84 @@
+#ifndef AFFINE_H
+#define AFFINE_H
+
+#include "gba.h"
+#include "fixed.h"
+
+// =========================================================================
+// 아핀 변환 (회전 / 확대 스프라이트와 BG2, BG3)
+// -------------------------------------------------------------------------
+// 하드웨어는 화면 픽셀마다 "텍스처의 어디를 읽을지"를 2x2 행렬(8.8)로 계산합니다.
+// 그래서 필요한 것은 화면 -> 텍스처 방향의 '역'행렬:
+//      | pa pb |   | cos/zx  -sin/zx |
+//      | pc pd | = | sin/zy   cos/zy |     (zx, zy = 확대율, 각도는 반시계 방향)
+// 스프라이트는 OAM 안의 행렬 32개를 나눠 쓰고, BG2/BG3은 레지스터에 직접 둡니다.
+//
+// [1. 스프라이트 행렬 캐시]
+//    같은 (각도, 확대율)의 스프라이트는 행렬 하나를 같이 씁니다.
+//    affine_obj()는 키로 32칸 해시 표를 찾아 행렬 번호를 돌려주고, 없을 때만 새로 계산합니다.
+//    - 이번 프레임에 쓰인 칸은 보호, 지난 프레임에만 쓰인 칸은 새 키에게 재사용
+//    - 지난 프레임과 같은 키면 계산 없이 같은 번호 (회전 속도가 같은 스프라이트 수십 개 = 행렬 몇 개)
+//    - 한 프레임에 서로 다른 키가 32개를 넘으면 -1 (호출자가 회전 없이 그리거나 각도를 양자화)
+//    새 행렬은 affine_end()에서 한꺼번에 계산합니다:
+//      기본   = fixmath 사인표(512단계, Q12)
+//      BIOS   = ObjAffineSet 한 번 호출 (256단계, affine_use_bios(true))
+//
+// [2. 배경 (Mode 1: BG2, Mode 2: BG2 + BG3)]
+//    affine_bg_set()은 "텍스처의 (tex_x, tex_y)를 화면의 (scr_x, scr_y)에 두고 돌리기/키우기"를
+//    행렬 + 참조점으로 바꿔서 보관하고, affine_vblank()에서 레지스터에 씁니다.
+//
+// [3. 프레임 흐름]
+//    affine_begin();
+//    int m = affine_obj(angle, zoom, zoom);
+//    if (m >= 0) sprite_add_affine(x, y, SPR_16x16, attr2, m, false, 0);
+//    affine_end();                     // 새 행렬 계산 -> Shadow OAM (sprite_end 전에)
+//    sprite_end();
+//    VBlank: sprite_vblank(); affine_vblank();
+// =========================================================================
+
+#define AFFINE_OBJ_SLOTS 32
+
+typedef struct {
+    s16 pa, pb, pc, pd; // 8.8
+} AffineMatrix;
+
+typedef struct {
+    u16 hits;     // 이번 프레임: 이미 있던 행렬을 그대로 쓴 횟수
+    u16 misses;   // 이번 프레임: 새로 계산한 행렬 수
+    u16 overflow; // 이번 프레임: 칸이 없어서 -1을 돌려준 횟수
+    u16 live;     // 이번 프레임에 쓰인 칸 수
+} AffineStats;
+
+// ---------------------------------------------------------
+// 1. 행렬 계산
+// ---------------------------------------------------------
+// angle: fixmath 각도 (512 = 한 바퀴), zoom: fixed (FIX_ONE = 원래 크기, 0이면 FIX_ONE으로 취급)
+void affine_rotscale(AffineMatrix* m, int angle, fixed zoom_x, fixed zoom_y);
+
+// ---------------------------------------------------------
+// 2. 스프라이트 행렬 캐시
+// ---------------------------------------------------------
+void affine_init(void);
+void affine_begin(void);
+
+// 반환값: 행렬 번호 0 ~ 31 (칸이 모자라면 -1)
+int  affine_obj(int angle, fixed zoom_x, fixed zoom_y);
+
+// 이번 프레임에 새로 생긴 행렬을 한꺼번에 계산해서 Shadow OAM에 기록
+void affine_end(void);
+
+// true면 affine_end가 BIOS ObjAffineSet으로 일괄 계산
+void affine_use_bios(bool on);
+
+const AffineStats* affine_stats(void);
+
+// ---------------------------------------------------------
+// 3. 배경
+// ---------------------------------------------------------
+// bg = 2 또는 3. 텍스처 점 (tex_x, tex_y)(fixed, 픽셀)를 화면 (scr_x, scr_y)에 두고 회전/확대
+void affine_bg_set(int bg, fixed tex_x, fixed tex_y, int scr_x, int scr_y, int angle, fixed zoom_x, fixed zoom_y);
+
+// VBlank에서 호출: affine_bg_set으로 바뀐 BG 레지스터 반영
+void affine_vblank(void);
+
+#endif // AFFINE_H
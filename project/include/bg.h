@@ -0,0 +1,101 @@
+#ifndef BG_H
+#define BG_H
+
+#include "gba.h"
+
+// =========================================================================
+// 타일 배경 (Mode 0) + 큰 맵 스트리밍
+// -------------------------------------------------------------------------
+// 비트맵 모드는 화면 전체(38KB)를 CPU가 칠해야 하지만, 타일 모드는
+// "8x8 타일 그림(캐릭터 블록)" + "어느 칸에 어느 타일(스크린 블록)"만 두면
+// 하드웨어가 매 줄 알아서 그리고, 스크롤은 레지스터 두 개로 끝납니다.
+//
+// [1. VRAM 블록 할당]
+//    배경용 VRAM 64KB = 캐릭터 블록(16KB) 4개 = 스크린 블록(2KB) 32개 (같은 메모리)
+//    bg.c가 스크린 블록 단위 비트맵으로 사용 중인 곳을 기록합니다.
+//    - 캐릭터 블록: 앞에서부터 (0, 1, ...)
+//    - 스크린 블록: 뒤에서부터 (31, 30, ...) -> 타일과 맵이 서로 침범하지 않게
+//    비트맵 모드 화면(Mode 3 = 0x0000~0x95FF)과는 함께 쓸 수 없습니다.
+//
+// [2. 스트리밍 (64x64 링 버퍼)]
+//    하드웨어 맵은 최대 64x64 칸(512x512 픽셀)이고 스크롤 값은 512에서 한 바퀴 돕니다.
+//    그래서 맵 칸 (tx, ty)를 항상 링 위치 (tx & 63, ty & 63)에 쓰고,
+//    스크롤 레지스터에는 카메라 좌표를 그대로(하위 9비트) 넣으면
+//    ROM에 있는 아무리 큰 맵이라도 화면 근처 31x21칸만 VRAM에 올라가 있으면 됩니다.
+//
+//    카메라가 타일 경계를 넘으면 '새로 보이는 열/행'만 복사합니다.
+//      - 가로로 한 칸: 열 1개 = 21칸
+//      - 세로로 한 칸: 행 1개 = 31칸
+//    맵 크기와 관계없이 프레임당 업로드량이 일정합니다. (한 번에 창 크기 이상 움직이면 전체 다시 로드)
+//
+// [3. 사용 예]
+//    bg_init();
+//    int cbb = bg_alloc_charblock();
+//    int sbb = bg_alloc_screenblocks(4);               // 64x64 = 스크린 블록 4개
+//    bg_load_tiles(cbb, tiles, sizeof(tiles));
+//    bg_setup(0, cbb, sbb, BG_4BPP | BG_SIZE_64x64 | BG_PRIO(1));
+//    bg_stream_init(&stream, 0, sbb, &world_map, cam_x, cam_y);
+//    REG_DISPCNT = MODE_0 | BG0_ENABLE;
+//    루프: vblank_wait(); bg_stream_update(&stream, cam_x, cam_y);
+//
+//    업데이트는 VBlank 직후에 부를 것. VDraw 중에 스크롤이 바뀌면 화면 중간부터 어긋나 보입니다.
+// =========================================================================
+
+#define BG_COUNT          4
+#define BG_CHARBLOCKS     4
+#define BG_SCREENBLOCKS   32
+
+#define BG_RING_SIZE      64                 // 링 버퍼 한 변 (칸)
+#define BG_STREAM_COLS    (SCREEN_W / 8 + 1) // 31: 가로 스크롤 중 걸치는 칸 포함
+#define BG_STREAM_ROWS    (SCREEN_H / 8 + 1) // 21
+
+// ---------------------------------------------------------
+// 1. 블록 할당 / 레지스터
+// ---------------------------------------------------------
+// 할당 기록 초기화 + BG0~3 스크롤 0
+void bg_init(void);
+
+// 반환값: 블록 번호 (자리가 없으면 -1)
+int  bg_alloc_charblock(void);
+void bg_free_charblock(int cbb);
+
+// count개 연속된 스크린 블록 (64x32/32x64 = 2, 64x64 = 4). 반환값: 첫 번호 또는 -1
+int  bg_alloc_screenblocks(int count);
+void bg_free_screenblocks(int sbb, int count);
+
+// REG_BGxCNT 설정. flags = BG_PRIO | BG_4BPP/BG_8BPP | BG_SIZE_xxx | BG_MOSAIC
+void bg_setup(int bg, int cbb, int sbb, u16 flags);
+
+// 스크롤 (하위 9비트만 의미 있음, 음수도 그대로 넣으면 됨)
+void bg_set_scroll(int bg, int x, int y);
+
+// 타일 그림 / 팔레트 복사 (bytes는 4의 배수)
+void bg_load_tiles(int cbb, const void* tiles, u32 bytes);
+void bg_load_palette(const u16* palette, int count);
+
+// ---------------------------------------------------------
+// 2. 맵 스트리밍
+// ---------------------------------------------------------
+typedef struct {
+    const u16* data;   // width * height 칸, 행 우선 (맵 칸 = SE_TILE | SE_HFLIP | SE_PALBANK ...)
+    int        width;  // 칸 수 (제한 없음)
+    int        height;
+    u16        fill;   // 맵 바깥 칸에 쓸 값 (카메라가 경계 밖을 볼 때)
+} BgMap;
+
+typedef struct {
+    int          bg;
+    int          sbb;     // 64x64 링의 첫 스크린 블록
+    const BgMap* map;
+    int          tile_x;  // 지금 VRAM에 올라가 있는 창의 왼쪽 위 (맵 칸 좌표)
+    int          tile_y;
+    u16          uploaded; // 직전 업데이트에서 쓴 칸 수 (프로파일용)
+} BgStreamer;
+
+// 카메라 위치(픽셀, 화면 왼쪽 위) 기준으로 창 전체를 올리고 스크롤 설정
+void bg_stream_init(BgStreamer* s, int bg, int sbb, const BgMap* map, int cam_x, int cam_y);
+
+// 카메라가 움직인 만큼 새로 보이는 열/행만 복사하고 스크롤 설정
+void bg_stream_update(BgStreamer* s, int cam_x, int cam_y);
+
+#endif // BG_H
@@ -0,0 +1,174 @@
+#ifndef BIOS_H
+#define BIOS_H
+
+#include "gba.h"
+
+// =========================================================================
+// BIOS 호출 (Software Interrupt, SWI)
+// -------------------------------------------------------------------------
+// GBA BIOS ROM(0x00000000)에는 복사, 나눗셈, 압축 해제 같은 루틴이 들어 있고,
+// 'swi 번호' 명령으로 호출합니다. 인자는 r0~r3으로 넘기며 BIOS가 r0~r3을 덮어씁니다.
+//
+// [Thumb vs ARM]
+//    Thumb 모드에서는 'swi n', ARM 모드에서는 'swi n << 16'으로 번호를 적어야 함.
+//
+// [호스트 빌드]
+//    BIOS가 없으므로 host/bios.c에서 같은 동작을 C로 흉내 냅니다.
+// =========================================================================
+
+// CpuSet / CpuFastSet 모드 비트 (r2)
+#define CS_FILL         (1 << 24) // 원본 주소 고정 (채우기)
+#define CS_32           (1 << 26) // CpuSet 전용: 32비트 단위 (없으면 16비트)
+
+// BgAffineSet 입력 (20바이트): 텍스처 중심(20.8) -> 화면 중심, 비율(8.8, 1/확대율), 각도(0 ~ 0xFFFF)
+typedef struct {
+    s32 tex_x, tex_y;
+    s16 scr_x, scr_y;
+    s16 sx, sy;
+    u16 alpha;
+    u16 pad;
+} BgAffineSrc;
+
+// BgAffineSet 출력 = REG_BGPA ~ REG_BGY 배치 그대로
+typedef struct {
+    s16 pa, pb, pc, pd;
+    s32 x, y;
+} BgAffineDst;
+
+// ObjAffineSet 입력 (8바이트): 비율(8.8, 1/확대율), 각도(0 ~ 0xFFFF)
+typedef struct {
+    s16 sx, sy;
+    u16 alpha;
+    u16 pad;
+} ObjAffineSrc;
+
+#ifdef GBA_HOST
+
+void bios_cpu_set(const void* src, void* dst, u32 mode);
+void bios_cpu_fast_set(const void* src, void* dst, u32 mode);
+void bios_halt(void);
+void bios_stop(void);
+void bios_intr_wait(bool discard, u16 flags);
+void bios_vblank_intr_wait(void);
+s32  bios_div(s32 num, s32 den);
+u16  bios_sqrt(u32 x);
+void bios_lz77_uncomp_wram(const void* src, void* dst);
+void bios_lz77_uncomp_vram(const void* src, void* dst);
+void bios_bg_affine_set(const BgAffineSrc* src, BgAffineDst* dst, int count);
+void bios_obj_affine_set(const ObjAffineSrc* src, void* dst, int count, int offset);
+
+#else
+
+#if defined(__thumb__)
+#define BIOS_SWI(n)     "swi " #n "\n"
+#else
+#define BIOS_SWI(n)     "swi " #n " << 16\n"
+#endif
+
+// [CpuSet: SWI 0x0B]
+// mode = 개수(하위 21비트) | CS_32 | CS_FILL. 16/32비트 단위 복사 또는 채우기.
+static inline void bios_cpu_set(const void* src, void* dst, u32 mode) {
+    register u32 r0 asm("r0") = (u32)src;
+    register u32 r1 asm("r1") = (u32)dst;
+    register u32 r2 asm("r2") = mode;
+    asm volatile(BIOS_SWI(0x0B) : "+r"(r0), "+r"(r1), "+r"(r2) :: "r3", "memory");
+}
+
+// [CpuFastSet: SWI 0x0C]
+// mode = 워드 개수(8의 배수로 올림됨) | CS_FILL. 내부적으로 8워드 ldmia/stmia 사용.
+// 주의: 주소는 4바이트 정렬 필수, 개수가 8의 배수가 아니면 초과해서 씀.
+static inline void bios_cpu_fast_set(const void* src, void* dst, u32 mode) {
+    register u32 r0 asm("r0") = (u32)src;
+    register u32 r1 asm("r1") = (u32)dst;
+    register u32 r2 asm("r2") = mode;
+    asm volatile(BIOS_SWI(0x0C) : "+r"(r0), "+r"(r1), "+r"(r2) :: "r3", "memory");
+}
+
+// [Halt: SWI 0x02]
+// 아무 인터럽트(IE & IF)가 올 때까지 CPU를 재움. 전력 소모가 크게 줄어듦.
+static inline void bios_halt(void) {
+    asm volatile(BIOS_SWI(0x02) ::: "r0", "r1", "r2", "r3", "memory");
+}
+
+// [Stop: SWI 0x03]
+// Halt보다 깊은 절전: CPU, LCD 컨트롤러, 사운드, 타이머가 모두 멈춤.
+// 키패드 / 카트리지 / 시리얼 인터럽트로만 깨어남 (REG_IE + REG_KEYCNT 설정 필수).
+// 들어가기 전에 DCNT_BLANK로 화면을 끄는 것이 권장됨 (input.h의 key_sleep 참고)
+static inline void bios_stop(void) {
+    asm volatile(BIOS_SWI(0x03) ::: "r0", "r1", "r2", "r3", "memory");
+}
+
+// [IntrWait: SWI 0x04]
+// flags 중 하나가 REG_IFBIOS에 올라올 때까지 Halt를 반복하고, 올라온 비트를 지움.
+// discard = true면 이미 올라와 있던 플래그를 버리고 '새로' 발생하기를 기다림.
+static inline void bios_intr_wait(bool discard, u16 flags) {
+    register u32 r0 asm("r0") = discard;
+    register u32 r1 asm("r1") = flags;
+    asm volatile(BIOS_SWI(0x04) : "+r"(r0), "+r"(r1) :: "r2", "r3", "memory");
+}
+
+// [VBlankIntrWait: SWI 0x05] = IntrWait(true, IRQ_VBLANK)
+// 다음 VBlank 시작까지 잠듦. VBlank 인터럽트가 켜져 있어야 함 (irq.h 참고).
+static inline void bios_vblank_intr_wait(void) {
+    asm volatile(BIOS_SWI(0x05) ::: "r0", "r1", "r2", "r3", "memory");
+}
+
+// [Div: SWI 0x06]
+// num / den (0을 향해 버림). r1 = 나머지, r3 = 몫의 절댓값도 돌려주지만 여기서는 몫만 사용.
+// 32비트 전용이라 64비트 나눗셈(__aeabi_ldivmod)보다 훨씬 빠름. den = 0이면 BIOS가 멈춤.
+static inline s32 bios_div(s32 num, s32 den) {
+    register s32 r0 asm("r0") = num;
+    register s32 r1 asm("r1") = den;
+    asm volatile(BIOS_SWI(0x06) : "+r"(r0), "+r"(r1) :: "r3", "memory");
+    return r0;
+}
+
+// [Sqrt: SWI 0x08]
+// 32비트 정수의 제곱근 (버림)
+static inline u16 bios_sqrt(u32 x) {
+    register u32 r0 asm("r0") = x;
+    asm volatile(BIOS_SWI(0x08) : "+r"(r0) :: "r1", "r2", "r3", "memory");
+    return (u16)r0;
+}
+
+// [LZ77UnCompWram: SWI 0x11]
+// tools/assetconv.c --lz77로 만든 스트림(헤더 u32 = 풀린 크기 << 8 | 0x10)을 dst에 풀기.
+// 바이트 단위로 쓰므로 WRAM 전용 (VRAM은 8비트 쓰기가 안 됨).
+static inline void bios_lz77_uncomp_wram(const void* src, void* dst) {
+    register u32 r0 asm("r0") = (u32)src;
+    register u32 r1 asm("r1") = (u32)dst;
+    asm volatile(BIOS_SWI(0x11) : "+r"(r0), "+r"(r1) :: "r2", "r3", "memory");
+}
+
+// [LZ77UnCompVram: SWI 0x12]
+// 16비트 단위로 써서 VRAM에 바로 풀 수 있음. 대신 스트림이 '거리 1' 참조를 쓰지 않아야 함
+// (assetconv는 항상 거리 2 이상으로 압축). 풀린 크기는 2의 배수.
+static inline void bios_lz77_uncomp_vram(const void* src, void* dst) {
+    register u32 r0 asm("r0") = (u32)src;
+    register u32 r1 asm("r1") = (u32)dst;
+    asm volatile(BIOS_SWI(0x12) : "+r"(r0), "+r"(r1) :: "r2", "r3", "memory");
+}
+
+// [BgAffineSet: SWI 0x0E]
+// count개의 (중심, 비율, 각도)로 아핀 배경 행렬 + 참조점 계산. dst를 REG_BGPA(n)에 그대로 복사하면 됨
+static inline void bios_bg_affine_set(const BgAffineSrc* src, BgAffineDst* dst, int count) {
+    register u32 r0 asm("r0") = (u32)src;
+    register u32 r1 asm("r1") = (u32)dst;
+    register u32 r2 asm("r2") = (u32)count;
+    asm volatile(BIOS_SWI(0x0E) : "+r"(r0), "+r"(r1), "+r"(r2) :: "r3", "memory");
+}
+
+// [ObjAffineSet: SWI 0x0F]
+// count개의 행렬 (pa, pb, pc, pd)을 offset 바이트 간격으로 씀.
+// offset = 2: 빽빽한 s16[4] 배열,  offset = 8: OAM의 attr3 자리에 바로
+static inline void bios_obj_affine_set(const ObjAffineSrc* src, void* dst, int count, int offset) {
+    register u32 r0 asm("r0") = (u32)src;
+    register u32 r1 asm("r1") = (u32)dst;
+    register u32 r2 asm("r2") = (u32)count;
+    register u32 r3 asm("r3") = (u32)offset;
+    asm volatile(BIOS_SWI(0x0F) : "+r"(r0), "+r"(r1), "+r"(r2), "+r"(r3) :: "memory");
+}
+
+#endif // GBA_HOST
+
+#endif // BIOS_H
@@ -0,0 +1,35 @@
+#ifndef DEBUG_H
+#define DEBUG_H
+
+#include "gba.h"
+
+// =========================================================================
+// 디버그 로그 (mGBA Debug Log)
+// -------------------------------------------------------------------------
+// GBA에는 화면 말고는 출력 장치가 없습니다.
+// mGBA 에뮬레이터는 0x04FFF600 근처에 '디버그 출력용 가짜 레지스터'를 제공하며,
+// 여기에 문자열을 쓰면 mGBA의 로그 창(Tools > View Logs)과 stdout에 찍힙니다.
+//
+// - 0x04FFF780 (u16): 0xC0DE를 쓰면 활성화, 읽었을 때 0x1DEA면 mGBA 위에서 실행 중
+// - 0x04FFF600 (256바이트): 출력할 문자열 버퍼
+// - 0x04FFF700 (u16): 로그 레벨 | 0x100 을 쓰는 순간 한 줄 출력
+//
+// 실기나 다른 에뮬레이터에서는 아무 일도 일어나지 않습니다.
+// 호스트 빌드에서는 그냥 stdout으로 출력합니다.
+// =========================================================================
+
+#define LOG_FATAL       0
+#define LOG_ERROR       1
+#define LOG_WARN        2
+#define LOG_INFO        3
+#define LOG_DEBUG       4
+
+// 반환값: mGBA(또는 호스트)에서 로그 출력이 가능하면 true
+bool dbg_init(void);
+
+// printf 형식으로 한 줄 출력 (줄바꿈은 자동, 최대 255자)
+void dbg_log(int level, const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+
+#define dbg_printf(...) dbg_log(LOG_INFO, __VA_ARGS__)
+
+#endif // DEBUG_H
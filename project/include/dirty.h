@@ -0,0 +1,70 @@
+#ifndef DIRTY_H
+#define DIRTY_H
+
+#include "gba.h"
+
+// =========================================================================
+// 더티 렉탱글 관리자 (Dirty Rectangle Tracker)
+// -------------------------------------------------------------------------
+// week2.c는 '이전 위치를 배경색으로 덮고 새 위치에 그리기'를 손으로 했습니다.
+// 물체가 하나고 배경이 단색일 때만 통하는 방법입니다.
+// 이 모듈은 여러 물체가 무효화(Invalidate)한 영역을 모아서, 배경 원본으로
+// '합친 영역'만 다시 칠합니다.
+//
+// [1. 타일 단위 비트맵으로 합치기]
+//    화면을 8x8 타일로 나누고(30x20), 타일마다 1비트를 둡니다. (한 줄 = u32 하나)
+//    dirty_add는 해당 타일 비트를 OR 할 뿐이라, 겹치거나 맞닿은 영역은 자동으로 합쳐집니다.
+//    flush 때는 비트맵에서 '가로로 연속된 타일 + 아래로 같은 폭'을 사각형으로 뽑아냅니다.
+//
+// [2. 비용 추정과 VBlank 예산]
+//    VBlank는 68줄 = 83,776 사이클뿐입니다. 사각형마다 비용을
+//    (고정 비용 + 줄 수 x 줄 비용 + 픽셀 수 x 픽셀 비용)으로 추정해서,
+//    - DIRTY_HIGH 영역은 예산과 상관없이 항상 다시 칠하고
+//    - DIRTY_LOW  영역은 예산이 남을 때만 칠하며, 넘치면 다음 프레임으로 미룹니다.
+//
+// [주의] 페이지 플리핑(Mode 4/5)에서는 두 페이지가 번갈아 그려지므로,
+//        같은 영역을 두 프레임 연속으로 dirty_add 해야 양쪽 페이지가 모두 복구됩니다.
+// =========================================================================
+
+#define DIRTY_TILE_SHIFT    3  // 8x8 픽셀 타일
+#define DIRTY_TILE          (1 << DIRTY_TILE_SHIFT)
+#define DIRTY_ROWS          (SCREEN_H / DIRTY_TILE) // 20
+
+#define DIRTY_VBLANK_BUDGET (68 * 1232) // VBlank 68줄 (사이클)
+
+// 비용 모델 (사이클, 추정치). 픽셀 비용은 1/16 사이클 단위 (Mode 4는 절반)
+#define DIRTY_COST_RECT     300 // 함수 호출, 클리핑 등 사각형당 고정 비용
+#define DIRTY_COST_ROW      60  // 줄마다 주소 계산 + 커널 호출
+#define DIRTY_COST_FILL_PX  16  // 단색 채우기: 픽셀당 약 1 사이클 (stmia, 32비트 쓰기)
+#define DIRTY_COST_COPY_PX  64  // 이미지 복사: 픽셀당 약 4 사이클 (EWRAM 읽기 대기 포함)
+
+typedef enum {
+    DIRTY_HIGH = 0, // 이번 프레임에 반드시 복구 (예: 플레이어가 지나간 자리)
+    DIRTY_LOW  = 1, // 예산이 모자라면 미뤄도 되는 영역 (예: 배경 장식 애니메이션)
+} DirtyPriority;
+
+typedef struct {
+    u16 rects;       // 이번 flush에서 다시 칠한 사각형 수
+    u16 deferred;    // 예산 초과로 다음 프레임으로 미룬 사각형 수
+    u32 pixels;      // 다시 칠한 픽셀 수
+    u32 est_cycles;  // 추정 비용 합계
+} DirtyStats;
+
+// 배경 원본 지정 (둘 중 마지막으로 지정한 것을 사용)
+// image: fb.back과 같은 배치(한 줄 = fb.pitch개의 u16)의 전체 화면 이미지
+void dirty_set_background_color(u16 color);
+void dirty_set_background_image(const u16* image);
+
+// 영역 무효화 (픽셀 좌표, 화면 밖은 잘림)
+void dirty_add(int x, int y, int w, int h, DirtyPriority priority);
+
+// 전체 화면 무효화 목록 비우기 (배경을 통째로 다시 그렸을 때)
+void dirty_reset(void);
+
+// 예산(사이클) 안에서 다시 칠하기. 반환값: 미뤄진 사각형 수
+int dirty_flush(u32 budget_cycles);
+
+// 마지막 flush 통계
+const DirtyStats* dirty_stats(void);
+
+#endif // DIRTY_H
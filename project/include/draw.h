@@ -0,0 +1,71 @@
+#ifndef DRAW_H
+#define DRAW_H
+
+#include "gba.h"
+#include "fixed.h"
+
+// =========================================================================
+// 스팬 기반 래스터라이저 (Span Rasterizer, Mode 3/4/5)
+// -------------------------------------------------------------------------
+// 예전 draw_rect는 픽셀마다 '경계 검사 4번 + 곱셈 1번 + 16비트 저장 1번'을 했습니다.
+// 여기서는 모든 도형을 '가로줄 조각(Span)'으로 쪼개서 하나의 빠른 길로 보냅니다.
+//
+// [1. 클리핑은 한 번만]
+//    사각형은 화면과의 교집합을 먼저 구하고, 그 안에서는 검사 없이 그립니다.
+//    선/원은 스팬 하나당 한 번만 잘라냅니다. (픽셀당 X)
+//
+// [2. 스팬 = 머리 + 몸통 + 꼬리]
+//    - 머리: 시작 주소가 4바이트 경계가 아니면 16비트 1픽셀
+//    - 몸통: 색상 두 개를 u32 하나에 담아 2픽셀씩 32비트 저장
+//    - 꼬리: 픽셀이 하나 남으면 16비트 1픽셀
+//    (VRAM은 8비트 쓰기가 안 되지만 16/32비트 쓰기는 속도가 같으므로 32비트가 2배 이득)
+//
+// [3. 도형 -> 스팬]
+//    - 사각형: 줄마다 스팬 1개 (가로 전체면 화면 블록 통째로 한 번에)
+//    - 선 (Bresenham): 완만한 선은 같은 y의 연속 픽셀을 스팬으로 묶음
+//                      화면 밖 구간은 오차 항을 한 번에 계산해서 건너뜀 (그려지는 픽셀은 같음)
+//    - 원 (Midpoint): 테두리는 같은 y 구간을 스팬으로, 채운 원은 줄마다 스팬 1개
+//    - 볼록 다각형 / 삼각형: 왼쪽/오른쪽 변을 Q16.16으로 한 줄씩 진행, 줄마다 스팬 1개
+//
+// [4. 그리는 곳 = fb.back]
+//    모든 함수는 프레임버퍼 모듈(fb.h)의 Back Buffer에 그리고, 그 크기로 클리핑합니다.
+//    Mode 4에서는 color의 하위 8비트가 팔레트 인덱스이며, 픽셀 쌍(u16) 단위로 씁니다.
+//
+// [5. 다각형의 채우기 규칙 (top-left)]
+//    꼭짓점은 fixed(소수 좌표)이고, 픽셀 중심 (x + 0.5, y + 0.5)이 도형 안에 있으면 칠합니다.
+//    중심이 변 위에 정확히 걸치면 왼쪽 변과 위쪽 변만 포함합니다.
+//    그래서 꼭짓점을 공유하는 삼각형 띠/부채꼴은 틈도, 두 번 칠하는 픽셀도 없습니다.
+//    변 계산 준비(꼭짓점마다 나눗셈 1번)만 draw.c에서, 줄 루프는 IWRAM 커널(span.h)에서 돕니다.
+//
+// 선/원/사각형 좌표는 화면 픽셀(int), 다각형 꼭짓점은 fixed입니다.
+// 선은 ±16383, 다각형은 ±4095 픽셀 안의 좌표만 받습니다. (화면 밖으로 나간 부분은 잘림)
+// =========================================================================
+
+typedef struct {
+    fixed x, y;
+} DrawVertex;
+
+// 점 하나 (화면 밖이면 무시)
+void draw_pixel(int x, int y, u16 color);
+
+// 가로줄 / 세로줄 (양 끝 포함, 순서 무관)
+void draw_hline(int x0, int x1, int y, u16 color);
+void draw_vline(int x, int y0, int y1, u16 color);
+
+// 채운 사각형 (x, y = 왼쪽 위, w x h 크기)
+void draw_rect(int x, int y, int w, int h, u16 color);
+
+// 선 (Bresenham)
+void draw_line(int x0, int y0, int x1, int y1, u16 color);
+
+// 원 테두리 / 채운 원 (Midpoint Circle)
+void draw_circle(int cx, int cy, int r, u16 color);
+void draw_circle_fill(int cx, int cy, int r, u16 color);
+
+// 채운 볼록 다각형 (감는 방향 무관, count >= 3). 오목하거나 넓이가 0이면 결과 보장 안 함 / 무시
+void draw_polygon(const DrawVertex* v, int count, u16 color);
+
+// 채운 삼각형 (draw_polygon의 3꼭짓점 버전)
+void draw_triangle(fixed x0, fixed y0, fixed x1, fixed y1, fixed x2, fixed y2, u16 color);
+
+#endif // DRAW_H
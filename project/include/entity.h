@@ -0,0 +1,104 @@
+#ifndef ENTITY_H
+#define ENTITY_H
+
+#include "gba.h"
+#include "fixed.h"
+
+// =========================================================================
+// 엔티티 (SoA 풀 + 일괄 처리 + 격자 브로드페이즈)
+// -------------------------------------------------------------------------
+// 움직이는 물체마다 struct 하나(AoS)를 두면, "모두 이동" 같은 루프가
+// 쓰지도 않는 필드(색, 스프라이트 번호...)까지 캐시 없는 버스로 끌고 다닙니다.
+// 여기서는 필드별 배열(SoA)로 나눠서 한 패스가 필요한 배열만 차례로 읽습니다.
+//
+// [1. 저장 방식 (빽빽한 배열 + 핸들)]
+//    ent.x[0..count-1], ent.vx[...] 처럼 살아 있는 엔티티가 항상 앞쪽에 빈틈없이 모여 있어서
+//    일괄 처리 패스는 0부터 count까지 분기 없이 돕니다.
+//    - 생성: 빈 핸들 목록(free list)에서 하나 꺼내고 맨 뒤 칸에 씀       O(1)
+//    - 삭제: 맨 뒤 칸을 지운 자리로 옮기고 핸들 -> 칸 표를 고침         O(1)
+//    칸 번호는 삭제 때 바뀌므로, 오래 들고 있을 때는 핸들(EntityId)을 쓰고
+//    entity_slot()으로 그때그때 칸을 찾습니다. malloc은 쓰지 않습니다.
+//
+// [2. 일괄 처리]
+//    entity_integrate() : 위치 += 속도
+//    entity_clamp()     : 영역 밖으로 나간 것을 가장자리로 (ENT_BOUNCE면 속도 반전)
+//    두 패스와 격자 처리는 src/entity.iwram.c (IWRAM, ARM)에 있습니다.
+//
+// [3. 격자 브로드페이즈]
+//    월드를 32x32 픽셀 칸(ENT_GRID_W x ENT_GRID_H)으로 나누고, ENT_SOLID 엔티티를
+//    AABB가 걸친 칸마다 등록(계수 정렬)합니다. 충돌 후보는 같은 칸 안에서만 찾으므로
+//    N^2 대신 대략 N x (칸당 평균 수)번 비교합니다.
+//    두 물체가 여러 칸에 함께 걸쳐도, 겹친 영역의 왼쪽 위가 속한 칸에서만 보고해서 중복이 없습니다.
+//    격자 밖 좌표는 가장자리 칸에 모입니다. (느려질 뿐 결과는 정확)
+//
+// [4. 사용 예]
+//    entity_init();
+//    EntityId id = entity_create(x, y, 8, 8, ENT_SOLID | ENT_BOUNCE);
+//    ent.vx[entity_slot(id)] = FLOAT_TO_FIX(1.5);
+//    루프: entity_integrate(); entity_clamp(0, 0, fixed_screen_w, fixed_screen_h);
+//          int n = entity_collide(pairs, 64);
+// =========================================================================
+
+#define ENT_MAX         256
+
+#define ENT_CELL_SHIFT  5                   // 칸 크기 32픽셀
+#define ENT_GRID_W      16                  // 16 x 16칸 = 512 x 512 픽셀
+#define ENT_GRID_H      16
+#define ENT_GRID_CELLS  (ENT_GRID_W * ENT_GRID_H)
+#define ENT_GRID_SLOTS  (ENT_MAX * 4)       // 엔티티 하나가 칸 4개까지 (칸보다 작을 때)
+
+// flags
+#define ENT_SOLID       0x0001              // 충돌 검사 대상
+#define ENT_BOUNCE      0x0002              // clamp에서 벽에 닿으면 속도 반전
+#define ENT_USER(n)     (0x0100 << (n))     // 게임 쪽에서 쓰는 비트 (0~7)
+
+typedef u16 EntityId;
+#define ENT_NONE        0xFFFF
+
+typedef struct {
+    // 일괄 처리용 (칸 번호로 접근)
+    fixed x[ENT_MAX], y[ENT_MAX];   // 왼쪽 위
+    fixed vx[ENT_MAX], vy[ENT_MAX]; // 프레임당 이동량
+    fixed w[ENT_MAX], h[ENT_MAX];   // 크기 (INT_TO_FIX 값)
+    u16   flags[ENT_MAX];
+    u16   sprite[ENT_MAX];          // 그릴 때 쓸 타일/프레임 번호 (엔티티 모듈은 해석하지 않음)
+    EntityId id[ENT_MAX];           // 칸 -> 핸들
+    int   count;
+} Entities;
+
+typedef struct {
+    EntityId a, b;
+} EntityPair;
+
+extern Entities ent;
+
+// ---------------------------------------------------------
+// 1. 풀
+// ---------------------------------------------------------
+void entity_init(void);
+
+// 반환값: 핸들 (풀이 가득 차면 ENT_NONE). 속도 0, sprite 0으로 시작
+EntityId entity_create(fixed x, fixed y, int w, int h, u16 flags);
+
+// 삭제 (맨 뒤 엔티티가 이 칸으로 옮겨옴). 이미 삭제된 핸들은 무시
+void entity_destroy(EntityId id);
+
+// 핸들 -> 현재 칸 번호 (삭제된 핸들이면 -1)
+int  entity_slot(EntityId id);
+
+// ---------------------------------------------------------
+// 2. 일괄 처리 (IWRAM)
+// ---------------------------------------------------------
+IWRAM_CODE void entity_integrate(void);
+
+// 엔티티 전체가 [min, max) 안에 들어오도록 위치 고정
+IWRAM_CODE void entity_clamp(fixed min_x, fixed min_y, fixed max_x, fixed max_y);
+
+// ---------------------------------------------------------
+// 3. 충돌 (IWRAM)
+// ---------------------------------------------------------
+// ENT_SOLID 엔티티끼리 AABB가 겹치는 쌍을 최대 cap개 out에 기록. 반환값: 찾은 쌍 수 (cap 초과분 포함)
+// 위치를 바꾼 뒤(integrate/clamp 뒤) 부를 것
+IWRAM_CODE int entity_collide(EntityPair* out, int cap);
+
+#endif // ENTITY_H
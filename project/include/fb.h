@@ -0,0 +1,57 @@
+#ifndef FB_H
+#define FB_H
+
+#include "gba.h"
+
+// =========================================================================
+// 프레임버퍼 (Bitmap Mode 3/4/5 + Page Flipping)
+// -------------------------------------------------------------------------
+// Mode 3는 화면이 한 장뿐이라, 그리는 도중의 모습이 그대로 보입니다(티어링).
+// 그래서 지우기/다시 그리기를 전부 VBlank(약 68줄) 안에 끝내야 했습니다.
+//
+// Mode 4/5는 VRAM에 페이지가 두 장 있고, REG_DISPCNT의 DCNT_PAGE 비트로
+// 어느 쪽을 보여줄지 고릅니다. 따라서
+//   1) 안 보이는 페이지(Back Buffer)에 VDraw 동안 한 프레임을 통째로 그리고
+//   2) VBlank에 비트 하나만 뒤집으면(Flip) 완성된 그림이 한 번에 나타납니다.
+//
+// [모드 비교]
+//    Mode 3: 240x160, 16bpp, 1장 (플립 없음, Back = Front)
+//    Mode 4: 240x160,  8bpp, 2장 (픽셀 = 팔레트 인덱스, 채우기 대역폭 절반)
+//    Mode 5: 160x128, 16bpp, 2장 (작은 화면 대신 트루컬러)
+//
+// [주의: Mode 4와 8비트 쓰기]
+//    VRAM에 8비트로 쓰면 같은 값이 양쪽 바이트에 복사되어 옆 픽셀이 망가집니다.
+//    그래서 draw 모듈은 Mode 4에서 항상 '픽셀 두 개(u16)' 단위로 쓰고,
+//    홀수 끝 픽셀은 읽어서 한쪽 바이트만 바꾼 뒤 다시 씁니다.
+//
+// 모든 draw_xxx 함수는 이 모듈의 fb.back에 그립니다.
+// =========================================================================
+
+typedef enum {
+    FB_MODE3 = 3,
+    FB_MODE4 = 4,
+    FB_MODE5 = 5,
+} FbMode;
+
+typedef struct {
+    u16*   back;   // 지금 그림을 그릴 페이지 (Mode 3에서는 화면 그 자체)
+    int    width;  // 픽셀 단위 크기
+    int    height;
+    int    pitch;  // 한 줄의 u16 개수 (Mode 4는 픽셀 2개가 u16 하나라서 width / 2)
+    FbMode mode;
+} Framebuffer;
+
+extern Framebuffer fb;
+
+// 모드 설정 + 화면 켜기 (REG_DISPCNT를 이 모듈이 관리)
+// extra: 함께 켤 비트 (예: OBJ 켜기). BG2_ENABLE은 자동으로 포함.
+void fb_init(FbMode mode, u32 extra);
+
+// Back Buffer를 한 색으로 채우기 (Mode 4에서는 color = 팔레트 인덱스)
+void fb_clear(u16 color);
+
+// 보여줄 페이지를 바꾸고 fb.back을 반대편으로 교체.
+// VBlank 안에서 호출해야 함 (보통 sync_vblank() 직후). Mode 3에서는 아무 일도 안 함.
+void fb_flip(void);
+
+#endif // FB_H
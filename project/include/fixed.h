@@ -2,6 +2,7 @@
 #define FIXED_H
 
 #include "gba.h" // u32, bool 등 기본 타입 사용을 위해 포함
+#include "fx.h"  // FX_CONST (컴파일 시간 상수 변환), 다른 Q 포맷 타입들 (fixed = fx8)
 
 // =========================================================================
 // 💡 고정 소수점(Fixed Point) 라이브러리 (Q24.8 Format)
@@ -52,8 +53,9 @@ typedef int fixed;
 
 // [실수 -> 고정 소수점] (Data Import)
 // 사용: 물리 상수 초기화 (예: 중력 9.8, 마찰력 0.1)
-// 주의: float 연산이 포함되므로 '초기화 단계'에서만 사용할 것. 루프 내부 금지.
-#define FLOAT_TO_FIX(f)  ((fixed)((f) * (float)FIX_SCALE))
+// 컴파일러가 미리 계산(반올림)하므로 ROM에 float 코드가 남지 않음.
+// 상수가 아닌 값(변수)을 넣으면 컴파일 에러가 남. (fx.h의 FX_CONST 참고)
+#define FLOAT_TO_FIX(f)  ((fixed)FX_CONST(f, FIX_SHIFT))
 
 // [고정 소수점 -> 정수 (버림)] (Render to Hardware)
 // 사용: 최종적으로 화면(VRAM)에 좌표를 찍을 때
@@ -94,9 +96,17 @@ static inline fixed fix_mul(fixed a, fixed b) {
     return (fixed)(((long long)a * b) >> FIX_SHIFT);
 }
 
+// [곱셈 (작은 값 전용)]
+// a * b가 32비트에 들어간다고 확실할 때 (예: |a|, |b| < 128.0)
+// 64비트 확장 없이 곱셈 한 번 + 시프트 한 번. Thumb 모드에서 __aeabi_lmul 호출을 피함.
+static inline fixed fix_mul_small(fixed a, fixed b) {
+    return (a * b) >> FIX_SHIFT;
+}
+
 // [나눗셈]
 // 원리: (A * 256) / (B * 256) = A / B (스케일 소실됨)
 // 미리 A에 256을 한번 더 곱해놓고 나눠야 스케일(256배)이 유지됨.
+// 주의: 64비트 나눗셈이라 GBA에서는 수백 사이클. 루프 안에서는 fixmath.h의 fix_div_fast 사용.
 static inline fixed fix_div(fixed a, fixed b) {
     return (fixed)(((long long)a << FIX_SHIFT) / b);
 }
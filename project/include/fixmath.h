@@ -0,0 +1,96 @@
+#ifndef FIXMATH_H
+#define FIXMATH_H
+
+#include "fixed.h"
+
+// =========================================================================
+// 고정 소수점 확장 수학 (나눗셈 / 삼각함수 / 제곱근 / 배치 커널)
+// -------------------------------------------------------------------------
+// fixed.h의 fix_div는 64비트 나눗셈이라 ARM7TDMI에서는 __aeabi_ldivmod 호출
+// (수백 사이클)이 됩니다. 나눗셈 하드웨어가 없으므로 다음 방법들을 씁니다.
+//
+// [1. 역수 테이블 + Newton 보정 (fix_div_fast)]
+//    b를 [0.5, 1) 구간으로 정규화(clz)하고, 상위 8비트로 역수 테이블을 찾은 뒤
+//    Newton 반복 y = y * (2 - b * y)를 두 번 하면 거의 30비트 정밀도가 됩니다.
+//    곱셈만 쓰므로 ARM 모드의 smull/umull(몇 사이클)로 끝나고,
+//    마지막에 나머지를 확인해서 fix_div와 '완전히 같은' 결과를 냅니다.
+//
+// [2. BIOS Div / Sqrt]
+//    범위가 작을 때(|a| < 2^23, 약 ±32768.0)는 BIOS 32비트 나눗셈이 간단합니다.
+//
+// [3. 삼각함수 테이블 (빌드 시 생성)]
+//    각도는 한 바퀴 = 512 단위의 정수입니다. (FIX_ANGLE_FULL)
+//    tools/gen_luts.c가 빌드 시 double로 sin/역수/atan 테이블을 만들어 ROM에 넣습니다.
+//
+// [4. 배치 커널 (SoA)]
+//    위치 배열, 속도 배열처럼 같은 연산을 N개에 하는 경우 함수 호출을 한 번으로 줄이고,
+//    IWRAM ARM 코드에서 4개씩 풀어서(Unroll) 처리합니다.
+// =========================================================================
+
+#define FIX_ANGLE_FULL      512 // 한 바퀴
+#define FIX_ANGLE_HALF      256
+#define FIX_ANGLE_QUARTER   128
+#define FIX_ANGLE_MASK      (FIX_ANGLE_FULL - 1)
+
+#define FIX_TRIG_SHIFT      12 // sin_lut 정밀도 (Q12, 1.0 = 4096)
+
+extern const s16 sin_lut[FIX_ANGLE_FULL];
+extern const u16 recip_lut[256];
+extern const u16 atan_lut[130];
+
+// -------------------------------------------------------------------------
+// 1. 나눗셈 / 제곱근
+// -------------------------------------------------------------------------
+
+// fix_div와 같은 결과 (0을 향해 버림). b = 0이면 부호에 맞는 최댓값 반환
+fixed fix_div_fast(fixed a, fixed b);
+
+// BIOS Div 사용. |a| < 2^23 (약 ±32768.0)일 때만 정확함
+fixed fix_div_bios(fixed a, fixed b);
+
+// a / b를 Q16.16으로 (fix_div_fast와 같은 방식, 소수부 16비트). 기울기처럼 누적할 값용
+// 범위를 넘으면 부호에 맞는 최댓값
+s32 fix_div_q16(fixed a, fixed b);
+
+// 제곱근 (a >= 0). a < 2^24 (약 65536.0)이면 소수부 8비트까지 정확, 그 이상은 4비트
+fixed fix_sqrt(fixed a);
+
+// -------------------------------------------------------------------------
+// 2. 삼각함수 (각도: 0 ~ 511 = 0 ~ 360도, 범위 밖은 자동으로 순환)
+// -------------------------------------------------------------------------
+
+// Q12 원본 값 (아핀 행렬처럼 정밀도가 더 필요할 때)
+static inline int fix_sin_q12(int angle) {
+    return sin_lut[angle & FIX_ANGLE_MASK];
+}
+
+static inline int fix_cos_q12(int angle) {
+    return sin_lut[(angle + FIX_ANGLE_QUARTER) & FIX_ANGLE_MASK];
+}
+
+// fixed (Q24.8) 결과
+static inline fixed fix_sin(int angle) {
+    return fix_sin_q12(angle) >> (FIX_TRIG_SHIFT - FIX_SHIFT);
+}
+
+static inline fixed fix_cos(int angle) {
+    return fix_cos_q12(angle) >> (FIX_TRIG_SHIFT - FIX_SHIFT);
+}
+
+// (x, y) 방향의 각도 0 ~ 511 (수학 좌표계: +x = 0, +y = 128). (0, 0)이면 0
+int fix_atan2(fixed y, fixed x);
+
+// -------------------------------------------------------------------------
+// 3. 배치 커널 (IWRAM, ARM). n은 아무 값이나 가능 (4의 배수가 아니어도 됨)
+// -------------------------------------------------------------------------
+
+// dst[i] = a[i] * b[i]
+void fix_mul_n(fixed* dst, const fixed* a, const fixed* b, int n);
+
+// acc[i] += v[i] * k   (예: pos += vel * dt)
+void fix_madd_n(fixed* acc, const fixed* v, fixed k, int n);
+
+// dst[i] = a[i] + (b[i] - a[i]) * t   (t = 0 ~ FIX_ONE)
+void fix_lerp_n(fixed* dst, const fixed* a, const fixed* b, fixed t, int n);
+
+#endif // FIXMATH_H
@@ -0,0 +1,132 @@
+#ifndef FX_H
+#define FX_H
+
+#include "gba.h"
+
+// =========================================================================
+// Q 포맷 고정 소수점 타입 모음 (fx8 / fx12 / fx16 / fx8s)
+// -------------------------------------------------------------------------
+// fixed.h의 fixed는 Q24.8 하나뿐입니다. 하지만
+//  - 느린 속도(프레임당 0.01픽셀 같은)는 소수부 8비트로 표현이 안 되고 (-> fx16)
+//  - 엔티티 수백 개의 좌표 배열은 32비트가 아깝습니다 (-> fx8s, 16비트)
+// 그래서 소수부 비트 수만 다른 타입들을 매크로로 찍어냅니다.
+//
+//    타입   저장     포맷     정수 범위            최소 단위
+//    fx8    s32     Q24.8    약 +-8,388,608      1/256   (= fixed)
+//    fx12   s32     Q20.12   약 +-524,288        1/4096  (sin_lut과 같음)
+//    fx16   s32     Q16.16   약 +-32,768         1/65536
+//    fx8s   s16     Q8.8     약 +-128            1/256   (배열 저장용)
+//
+// [1. 생성되는 함수] (T = 타입 이름)
+//    T_from_int, T_to_int, T_add, T_sub, T_mul, T_div
+//    A_to_B (예: fx8_to_fx16): 시프트 한 번뿐이라 비용 없음 (fx8 <-> fx8s는 0회)
+//
+// [2. 상수는 컴파일 시간에만]
+//    FX8(9.8), FX16(0.01) 처럼 씁니다. 인자가 상수가 아니면 '컴파일 에러'가 나므로
+//    실수(float) 연산 코드가 ROM에 섞여 들어갈 수 없습니다. (반올림 적용)
+//
+// [3. 오버플로 검사 (make DEBUG=1)]
+//    디버그 빌드에서는 모든 연산 결과를 64비트로 계산해서 타입 범위를 확인하고,
+//    넘치면 mGBA 로그에 FATAL을 남기고 멈춥니다(트랩).
+//    make DEBUG=1 FX_CHECK=saturate 로 빌드하면 멈추지 않고 최댓값으로 포화시키며,
+//    타입별 넘친 횟수와 '지금까지 나온 가장 큰 값'을 기록합니다. fx_report()로 출력해서
+//    가장 작은 안전한 포맷을 고르는 데 쓰세요.
+//    릴리스 빌드에서는 검사 코드가 전부 사라집니다 (평범한 정수 연산).
+// =========================================================================
+
+typedef enum {
+    FX_ID_FX8,
+    FX_ID_FX12,
+    FX_ID_FX16,
+    FX_ID_FX8S,
+    FX_ID_COUNT,
+} FxId;
+
+// -------------------------------------------------------------------------
+// 1. 컴파일 시간 상수
+// -------------------------------------------------------------------------
+// 상수가 아닌 인자로 호출되면 남게 되는 함수 -> error 속성 때문에 컴파일 실패
+extern s32 fx_float_not_constant(void)
+    __attribute__((error("FX 상수 매크로에는 컴파일 시간 상수만 넣을 수 있습니다")));
+
+#define FX_CONST(f, shift)                                                     \
+    __builtin_choose_expr(__builtin_constant_p(f),                             \
+        (s32)((f) * (double)(1L << (shift)) + (((f) < 0) ? -0.5 : 0.5)),       \
+        fx_float_not_constant())
+
+#define FX8(f)          ((fx8)FX_CONST(f, 8))
+#define FX12(f)         ((fx12)FX_CONST(f, 12))
+#define FX16(f)         ((fx16)FX_CONST(f, 16))
+#define FX8S(f)         ((fx8s)FX_CONST(f, 8))
+
+// -------------------------------------------------------------------------
+// 2. 검사 훅
+// -------------------------------------------------------------------------
+#ifdef DEBUG_MODE
+
+// 범위 안이면 그대로, 넘치면 트랩(기본) 또는 포화(FX_SATURATE). src/fx.c
+s32 fx_checked(long long value, FxId id, const char* op);
+
+#define FX_RESULT(v, id, op)    fx_checked((v), (id), (op))
+
+#else
+
+#define FX_RESULT(v, id, op)    ((s32)(v))
+
+#endif // DEBUG_MODE
+
+// 타입별 넘친 횟수 / 최대 크기 출력 (디버그 빌드에서만 내용이 있음)
+void fx_report(void);
+
+// d비트 왼쪽(+) 또는 오른쪽(-)으로 시프트 (d는 상수라 한쪽만 남음)
+#define FX_SHIFT_BY(v, d)   (((d) >= 0) ? ((v) << ((d) & 63)) : ((v) >> (-(d) & 63)))
+
+// -------------------------------------------------------------------------
+// 3. 타입 생성 매크로
+// -------------------------------------------------------------------------
+#define FX_DEFINE(T, S, SHIFT, ID)                                             \
+    typedef S T;                                                               \
+    static inline T T##_from_int(int n) {                                      \
+        return (T)FX_RESULT((long long)n << (SHIFT), ID, #T "_from_int");      \
+    }                                                                          \
+    static inline int T##_to_int(T a) {                                        \
+        return a >> (SHIFT);                                                   \
+    }                                                                          \
+    static inline T T##_add(T a, T b) {                                        \
+        return (T)FX_RESULT((long long)a + b, ID, #T "_add");                  \
+    }                                                                          \
+    static inline T T##_sub(T a, T b) {                                        \
+        return (T)FX_RESULT((long long)a - b, ID, #T "_sub");                  \
+    }                                                                          \
+    static inline T T##_mul(T a, T b) {                                        \
+        return (T)FX_RESULT(((long long)a * b) >> (SHIFT), ID, #T "_mul");     \
+    }                                                                          \
+    static inline T T##_div(T a, T b) {                                        \
+        return (T)FX_RESULT(((long long)a << (SHIFT)) / b, ID, #T "_div");     \
+    }
+
+#define FX_DEFINE_CONVERT(FROM, FROM_SHIFT, TO, TO_SHIFT, TO_ID)               \
+    static inline TO FROM##_to_##TO(FROM a) {                                  \
+        return (TO)FX_RESULT(FX_SHIFT_BY((long long)a, (TO_SHIFT) - (FROM_SHIFT)), \
+                             TO_ID, #FROM "_to_" #TO);                         \
+    }
+
+FX_DEFINE(fx8,  s32,  8, FX_ID_FX8)
+FX_DEFINE(fx12, s32, 12, FX_ID_FX12)
+FX_DEFINE(fx16, s32, 16, FX_ID_FX16)
+FX_DEFINE(fx8s, s16,  8, FX_ID_FX8S)
+
+FX_DEFINE_CONVERT(fx8,  8,  fx12, 12, FX_ID_FX12)
+FX_DEFINE_CONVERT(fx8,  8,  fx16, 16, FX_ID_FX16)
+FX_DEFINE_CONVERT(fx8,  8,  fx8s,  8, FX_ID_FX8S)
+FX_DEFINE_CONVERT(fx12, 12, fx8,   8, FX_ID_FX8)
+FX_DEFINE_CONVERT(fx12, 12, fx16, 16, FX_ID_FX16)
+FX_DEFINE_CONVERT(fx12, 12, fx8s,  8, FX_ID_FX8S)
+FX_DEFINE_CONVERT(fx16, 16, fx8,   8, FX_ID_FX8)
+FX_DEFINE_CONVERT(fx16, 16, fx12, 12, FX_ID_FX12)
+FX_DEFINE_CONVERT(fx16, 16, fx8s,  8, FX_ID_FX8S)
+FX_DEFINE_CONVERT(fx8s,  8, fx8,   8, FX_ID_FX8)
+FX_DEFINE_CONVERT(fx8s,  8, fx12, 12, FX_ID_FX12)
+FX_DEFINE_CONVERT(fx8s,  8, fx16, 16, FX_ID_FX16)
+
+#endif // FX_H
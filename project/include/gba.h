@@ -11,11 +11,16 @@
 
 #include <stdbool.h> // 표준 bool, true, false 사용 (C99/C23 호환)
 #include <stddef.h>  // 표준 NULL 사용
+#include <stdint.h>  // uintptr_t: 포인터 정렬 검사용 (호스트 64비트 빌드와 호환)
 
 typedef unsigned char  u8;  // 8비트 (1바이트): 타일 인덱스, 작은 정수 등
 typedef unsigned short u16; // 16비트 (2바이트): 색상(RGB555), 레지스터 제어 등 주력 타입
 typedef unsigned int   u32; // 32비트 (4바이트): 메모리 주소, 큰 데이터, DMA 전송 시 사용
 
+typedef signed char    s8;  // 부호 있는 버전: 룩업 테이블, 좌표 오프셋 등
+typedef signed short   s16;
+typedef signed int     s32;
+
 
 // =========================================================================
 // 2. 메모리 맵 (Memory Map)
@@ -24,14 +29,62 @@ typedef unsigned int   u32; // 32비트 (4바이트): 메모리 주소, 큰 데
 // 이를 Memory Mapped I/O (MMIO)라고 합니다.
 // =========================================================================
 
+#ifdef GBA_HOST
+// [호스트 빌드 (make host)]
+// x86-64 리눅스에서 같은 소스를 돌리기 위해, 고정 주소 대신
+// 프로세스 안의 가짜 메모리(host/host.c)를 가리키도록 바꿔치기합니다.
+// 레지스터 매크로들은 그대로 'REG_BASE + 오프셋'을 쓰므로 수정할 필요가 없습니다.
+#include "host.h"
+
+#define REG_BASE        ((uintptr_t)host_io)   // 가짜 I/O 레지스터 블록 (1KB)
+#define PAL_BASE        ((uintptr_t)host_pal)  // 가짜 팔레트 RAM (1KB)
+#define VRAM_BASE       ((uintptr_t)host_vram) // 가짜 VRAM (96KB)
+#define OAM_BASE        ((uintptr_t)host_oam)  // 가짜 OAM (1KB)
+#else
 #define REG_BASE        0x04000000 // I/O 레지스터들의 시작 주소
+#define PAL_BASE        0x05000000 // 팔레트 RAM (BG 256색 + OBJ 256색, 각 u16)
 #define VRAM_BASE       0x06000000 // 비디오 메모리(화면 데이터) 시작 주소
+#define OAM_BASE        0x07000000 // 스프라이트 속성 메모리 (128개 x 8바이트)
+#endif
 
 // VRAM 포인터
 // u16 포인터인 이유: VRAM은 보통 16비트(색상 값) 단위로 읽고 쓰기 때문입니다.
 // volatile 필수: 컴파일러가 "아까 썼으니까 안 써도 되겠지?"라고 최적화하는 것을 막습니다.
 #define VRAM            ((volatile u16*)VRAM_BASE)
 
+// 팔레트 포인터 (Mode 4의 픽셀 값 = BG 팔레트 인덱스)
+#define PAL_BG          ((volatile u16*)PAL_BASE)
+#define PAL_OBJ         ((volatile u16*)(PAL_BASE + 0x0200))
+
+// Mode 4/5의 두 번째 페이지 (첫 번째 페이지는 VRAM_BASE)
+#define VRAM_PAGE1      ((volatile u16*)(VRAM_BASE + 0xA000))
+
+// 스프라이트(OBJ) 타일 메모리 (0x06010000, 32KB = 4bpp 타일 1024개)
+// 비트맵 모드(3/4/5)에서는 앞쪽 16KB를 화면이 쓰므로 타일 512번부터만 사용 가능
+#define TILE_OBJ        ((volatile u16*)(VRAM_BASE + 0x10000))
+
+// 타일 모드(0/1/2) 배경 메모리: 앞 64KB를 16KB 캐릭터 블록(타일) 4개,
+// 또는 2KB 스크린 블록(맵, 32x32 칸) 32개로 봄. 둘은 같은 메모리를 겹쳐 씀
+// (스크린 블록 8개 = 캐릭터 블록 1개). 어느 블록을 무엇에 쓸지는 bg.c가 관리.
+#define CHARBLOCK(n)    ((volatile u16*)(VRAM_BASE + (n) * 0x4000))
+#define SCREENBLOCK(n)  ((volatile u16*)(VRAM_BASE + (n) * 0x0800))
+
+// OAM 포인터 (u16 4개 = 스프라이트 1개: attr0, attr1, attr2, affine 파라미터)
+// 주의: OAM은 8비트 쓰기가 무시되고, VDraw 중에는 접근이 느리므로 VBlank에 통째로 씀
+#define OAM             ((volatile u16*)OAM_BASE)
+
+// 세이브 메모리 (카트리지 SRAM / Flash, 0x0E000000 ~, 8비트 버스)
+// 바이트 단위로만 접근할 것 (16/32비트로 읽으면 같은 바이트가 반복되어 나옴)
+// Flash는 특정 주소에 쓰는 값이 곧 명령이라(save.h), 호스트 빌드에서는 함수 호출로 칩을 흉내 냄
+#ifdef GBA_HOST
+#define SRAM_READ(off)      host_save_read(off)
+#define SRAM_WRITE(off, v)  host_save_write((off), (u8)(v))
+#else
+#define SRAM                ((volatile u8*)0x0E000000)
+#define SRAM_READ(off)      (SRAM[off])
+#define SRAM_WRITE(off, v)  (SRAM[off] = (u8)(v))
+#endif
+
 // =========================================================================
 // 3. 하드웨어 레지스터 (Hardware Registers)
 // -------------------------------------------------------------------------
@@ -50,7 +103,13 @@ typedef unsigned int   u32; // 32비트 (4바이트): 메모리 주소, 큰 데
 // 주소: 0x04000006
 // 타입: u16 (0~227 범위)
 // 역할: 현재 전자총이 그리고 있는 가로줄 번호를 읽음 (Read-Only). VSync 구현의 핵심.
+// 호스트 빌드: 읽을 때마다 한 줄씩 진행하는 가상 스캔라인 카운터로 대체됩니다.
+//             (sync_vblank 같은 폴링 루프가 에뮬레이터 없이도 그대로 동작)
+#ifdef GBA_HOST
+#define REG_VCOUNT      (*host_vcount())
+#else
 #define REG_VCOUNT      (*(volatile u16*)(REG_BASE + 0x0006))
+#endif
 
 // [키 입력 상태]
 // 주소: 0x04000130
@@ -58,6 +117,113 @@ typedef unsigned int   u32; // 32비트 (4바이트): 메모리 주소, 큰 데
 // 역할: 버튼이 눌렸는지 확인. (주의: 눌리면 0, 안 눌리면 1 -> Active Low)
 #define REG_KEYINPUT    (*(volatile u16*)(REG_BASE + 0x0130))
 
+// [키 인터럽트 조건]
+// 주소: 0x04000132
+// 역할: 하위 10비트 = 감시할 키, KEYCNT_IRQ = 인터럽트 발생 허용,
+//       KEYCNT_AND = 모든 키가 동시에 눌려야 발생 (없으면 아무 키나 하나)
+//       Stop 상태(BIOS SWI 0x03)에서 깨어나는 유일한 방법 중 하나
+#define REG_KEYCNT      (*(volatile u16*)(REG_BASE + 0x0132))
+
+// [디스플레이 상태]
+// 주소: 0x04000004
+// 타입: u16
+// 역할: 하위 비트 = 현재 VBlank/HBlank/VCount 일치 여부(읽기),
+//       비트 3~5 = 각 상황에서 인터럽트 발생 허용, 상위 8비트 = VCount 비교 대상 줄
+#define REG_DISPSTAT    (*(volatile u16*)(REG_BASE + 0x0004))
+
+// [인터럽트 제어]
+// IE  (0x04000200): 어떤 인터럽트를 받을지 (비트별 허용)
+// IF  (0x04000202): 어떤 인터럽트가 발생했는지. 해당 비트에 1을 '써야' 지워짐 (Acknowledge)
+// IME (0x04000208): 인터럽트 전체 스위치 (0 = 모두 무시)
+#define REG_IE          (*(volatile u16*)(REG_BASE + 0x0200))
+#define REG_IF          (*(volatile u16*)(REG_BASE + 0x0202))
+#define REG_IME         (*(volatile u16*)(REG_BASE + 0x0208))
+
+// [카트리지 버스 대기 상태]
+// 주소: 0x04000204
+// 역할: 하위 2비트 = SRAM/Flash 영역 대기 사이클, 나머지 = ROM 대기 / 프리페치
+#define REG_WAITCNT     (*(volatile u16*)(REG_BASE + 0x0204))
+
+// [BIOS 인터럽트 영역 (IWRAM 끝자락)]
+// 0x03007FFC: BIOS가 인터럽트 발생 시 호출할 함수 주소 (ARM 모드로 호출됨)
+// 0x03007FF8: IntrWait 계열 BIOS 함수가 확인하는 플래그. ISR이 직접 OR 해줘야 함
+#ifdef GBA_HOST
+#define REG_ISR_MAIN    host_isr
+#define REG_IFBIOS      host_ifbios
+#else
+#define REG_ISR_MAIN    (*(void (*volatile*)(void))0x03007FFC)
+#define REG_IFBIOS      (*(volatile u16*)0x03007FF8)
+#endif
+
+// [DMA (Direct Memory Access) 채널 0~3]
+// 주소: 0x040000B0 + 채널 * 12 (SAD, DAD, CNT 순서로 4바이트씩)
+// 역할: CPU 대신 메모리를 복사/채우는 전용 하드웨어. 전송 중에는 CPU가 멈춤.
+//       SAD = 원본 주소, DAD = 대상 주소, CNT = 하위 16비트 개수 + 상위 16비트 제어
+// 주의: 호스트 빌드에서는 포인터가 64비트라 레지스터에 담을 수 없으므로
+//       직접 쓰지 말고 아래 dma_transfer()를 사용할 것.
+#define REG_DMA_SAD(ch) (*(volatile u32*)(REG_BASE + 0x00B0 + (ch) * 12))
+#define REG_DMA_DAD(ch) (*(volatile u32*)(REG_BASE + 0x00B4 + (ch) * 12))
+#define REG_DMA_CNT(ch) (*(volatile u32*)(REG_BASE + 0x00B8 + (ch) * 12))
+
+// [타이머 0~3]
+// 주소: 0x04000100 + 채널 * 4 (CNT_L = 카운터/리로드 값, CNT_H = 제어)
+// 역할: 16비트 카운터. 캐스케이드(Cascade)로 이어 붙이면 32비트 카운터가 됨.
+#define REG_TM_CNT_L(n) (*(volatile u16*)(REG_BASE + 0x0100 + (n) * 4))
+#define REG_TM_CNT_H(n) (*(volatile u16*)(REG_BASE + 0x0102 + (n) * 4))
+
+// [배경 0~3 제어 / 스크롤]
+// BGxCNT (0x04000008 + n * 2): 우선순위, 타일(캐릭터 블록), 맵(스크린 블록), 색 깊이, 맵 크기
+// BGxHOFS/VOFS (0x04000010 + n * 4): 스크롤 (9비트, 쓰기 전용 -> 읽으면 값이 안 나옴)
+#define REG_BGCNT(n)    (*(volatile u16*)(REG_BASE + 0x0008 + (n) * 2))
+#define REG_BGHOFS(n)   (*(volatile u16*)(REG_BASE + 0x0010 + (n) * 4))
+#define REG_BGVOFS(n)   (*(volatile u16*)(REG_BASE + 0x0012 + (n) * 4))
+
+// [아핀 배경 2, 3 (Mode 1: BG2, Mode 2: BG2 + BG3)]
+// BGxPA~PD (0x04000020 + (n - 2) * 0x10, s16 8.8): 화면 -> 텍스처 역변환 행렬
+// BGxX/Y   (0x04000028 / 2C + (n - 2) * 0x10, s32 20.8): 화면 (0, 0)에 해당하는 텍스처 좌표
+// 참조점(X/Y)은 쓰는 순간과 매 프레임 시작에만 내부 카운터로 복사되고, 줄마다 PB/PD만큼 누적됨
+#define REG_BGPA(n)     (*(volatile s16*)(REG_BASE + 0x0020 + ((n) - 2) * 0x10))
+#define REG_BGPB(n)     (*(volatile s16*)(REG_BASE + 0x0022 + ((n) - 2) * 0x10))
+#define REG_BGPC(n)     (*(volatile s16*)(REG_BASE + 0x0024 + ((n) - 2) * 0x10))
+#define REG_BGPD(n)     (*(volatile s16*)(REG_BASE + 0x0026 + ((n) - 2) * 0x10))
+#define REG_BGX(n)      (*(volatile s32*)(REG_BASE + 0x0028 + ((n) - 2) * 0x10))
+#define REG_BGY(n)      (*(volatile s32*)(REG_BASE + 0x002C + ((n) - 2) * 0x10))
+
+// [윈도우]
+// WINxH (0x04000040 / 42): 왼쪽 << 8 | 오른쪽(포함 안 함),  WINxV (0x04000044 / 46): 위 << 8 | 아래
+// WININ (0x04000048): 윈도우 0/1 안에서 보일 레이어, WINOUT (0x0400004A): 바깥 / OBJ 윈도우 안
+// 줄마다 WIN0H를 바꾸면(HBlank DMA) 원, 삼각형 같은 모양의 창을 만들 수 있음 (raster.h)
+#define REG_WIN0H       (*(volatile u16*)(REG_BASE + 0x0040))
+#define REG_WIN1H       (*(volatile u16*)(REG_BASE + 0x0042))
+#define REG_WIN0V       (*(volatile u16*)(REG_BASE + 0x0044))
+#define REG_WIN1V       (*(volatile u16*)(REG_BASE + 0x0046))
+#define REG_WININ       (*(volatile u16*)(REG_BASE + 0x0048))
+#define REG_WINOUT      (*(volatile u16*)(REG_BASE + 0x004A))
+
+// [색 효과 (Special Effects)]
+// MOSAIC   (0x0400004C): 모자이크 크기. BG 가로/세로(비트 0~7), OBJ 가로/세로(8~15), 값 n = n+1 픽셀 블록
+//                        BG_MOSAIC / ATTR0_MOSAIC 비트를 켠 레이어에만 적용
+// BLDCNT   (0x04000050): 효과 종류 + 첫 번째 대상(위 레이어) / 두 번째 대상(아래 레이어)
+// BLDALPHA (0x04000052): 반투명 계수 EVA(위, 비트 0~4) / EVB(아래, 8~12). 결과 = (위 x EVA + 아래 x EVB) / 16
+// BLDY     (0x04000054): 밝기 계수 EVY (0 ~ 16). 흰색/검은색 쪽으로 EVY/16만큼 섞음
+#define REG_MOSAIC      (*(volatile u16*)(REG_BASE + 0x004C))
+#define REG_BLDCNT      (*(volatile u16*)(REG_BASE + 0x0050))
+#define REG_BLDALPHA    (*(volatile u16*)(REG_BASE + 0x0052))
+#define REG_BLDY        (*(volatile u16*)(REG_BASE + 0x0054))
+
+// [사운드 (Direct Sound A/B)]
+// SOUNDCNT_L (0x04000080): DMG(사각파/노이즈) 채널 볼륨/좌우 -> Direct Sound만 쓰면 0
+// SOUNDCNT_H (0x04000082): Direct Sound A/B 볼륨, 좌우 출력, 사용할 타이머, FIFO 초기화
+// SOUNDCNT_X (0x04000084): 사운드 전체 켜기 (꺼져 있으면 다른 사운드 레지스터가 쓰기 금지)
+// FIFO_A/B   (0x040000A0 / A4): 8비트 부호 있는 샘플 32바이트 큐. 타이머가 넘칠 때마다 1바이트씩 재생,
+//                               절반(16바이트)이 비면 DMA1/DMA2(DMA_AT_SPECIAL)에 4워드를 요청
+#define REG_SOUNDCNT_L  (*(volatile u16*)(REG_BASE + 0x0080))
+#define REG_SOUNDCNT_H  (*(volatile u16*)(REG_BASE + 0x0082))
+#define REG_SOUNDCNT_X  (*(volatile u16*)(REG_BASE + 0x0084))
+#define REG_SOUNDBIAS   (*(volatile u16*)(REG_BASE + 0x0088))
+#define REG_FIFO_A      (*(volatile u32*)(REG_BASE + 0x00A0))
+#define REG_FIFO_B      (*(volatile u32*)(REG_BASE + 0x00A4))
+
 // =========================================================================
 // 4. 설정 상수 (Configuration Constants)
 // =========================================================================
@@ -68,8 +234,159 @@ typedef unsigned int   u32; // 32비트 (4바이트): 메모리 주소, 큰 데
 
 // 디스플레이 모드 설정 비트
 // REG_DISPCNT에 OR(|) 연산으로 설정함
+#define MODE_0          0x0000 // 타일 모드 (BG0~3 모두 일반 타일 배경)
+#define MODE_1          0x0001 // 타일 모드 (BG0, BG1 일반 + BG2 아핀)
+#define MODE_2          0x0002 // 타일 모드 (BG2, BG3 아핀)
 #define MODE_3          0x0003 // 비트맵 모드 (240x160, 트루컬러)
+#define MODE_4          0x0004 // 비트맵 모드 (240x160, 8비트 팔레트, 페이지 2장)
+#define MODE_5          0x0005 // 비트맵 모드 (160x128, 트루컬러, 페이지 2장)
+#define DCNT_PAGE       0x0010 // Mode 4/5: 1이면 두 번째 페이지(0x0600A000)를 화면에 표시
+#define DCNT_OBJ_1D     0x0040 // OBJ 타일을 1차원(연속)으로 배치 (0이면 32x32 타일 격자)
+#define DCNT_BLANK      0x0080 // 강제 블랭크: 화면을 흰색으로 끄고 VRAM/OAM을 자유롭게 접근
+#define BG0_ENABLE      0x0100 // 배경 레이어 0 켜기
+#define BG1_ENABLE      0x0200
 #define BG2_ENABLE      0x0400 // 배경 레이어 2 켜기 (Mode 3는 BG2를 사용함)
+#define BG3_ENABLE      0x0800
+#define BG_ENABLE(n)    (0x0100 << (n))
+#define DCNT_OBJ        0x1000 // 스프라이트(OBJ) 레이어 켜기
+#define DCNT_WIN0       0x2000 // 윈도우 0 켜기
+#define DCNT_WIN1       0x4000
+#define DCNT_OBJWIN     0x8000 // OBJ 윈도우 (OBJ_MODE_WINDOW 스프라이트 모양의 창)
+
+// REG_DISPSTAT 비트
+#define DSTAT_IN_VBL    0x0001 // (읽기) VBlank 중
+#define DSTAT_IN_HBL    0x0002 // (읽기) HBlank 중
+#define DSTAT_IN_VCT    0x0004 // (읽기) REG_VCOUNT == 비교 대상 줄
+#define DSTAT_VBL_IRQ   0x0008 // VBlank 인터럽트 허용
+#define DSTAT_HBL_IRQ   0x0010 // HBlank 인터럽트 허용
+#define DSTAT_VCT_IRQ   0x0020 // VCount 일치 인터럽트 허용
+#define DSTAT_VCT(n)    ((n) << 8)
+
+// 인터럽트 비트 (REG_IE / REG_IF / REG_IFBIOS 공통)
+#define IRQ_VBLANK      0x0001
+#define IRQ_HBLANK      0x0002
+#define IRQ_VCOUNT      0x0004
+#define IRQ_TIMER0      0x0008
+#define IRQ_TIMER1      0x0010
+#define IRQ_TIMER2      0x0020
+#define IRQ_TIMER3      0x0040
+#define IRQ_SERIAL      0x0080
+#define IRQ_DMA0        0x0100
+#define IRQ_DMA1        0x0200
+#define IRQ_DMA2        0x0400
+#define IRQ_DMA3        0x0800
+#define IRQ_KEYPAD      0x1000
+#define IRQ_GAMEPAK     0x2000
+#define IRQ_COUNT       14
+
+// DMA 제어 비트 (REG_DMA_CNT 상위 16비트 + 하위 16비트 개수를 한 번에 씀)
+#define DMA_DST_INC     0x00000000 // 대상 주소 증가
+#define DMA_DST_DEC     0x00200000 // 대상 주소 감소
+#define DMA_DST_FIXED   0x00400000 // 대상 주소 고정
+#define DMA_DST_RELOAD  0x00600000 // 증가 + 반복 시 원래 주소로 복귀
+#define DMA_SRC_INC     0x00000000 // 원본 주소 증가
+#define DMA_SRC_DEC     0x00800000 // 원본 주소 감소
+#define DMA_SRC_FIXED   0x01000000 // 원본 주소 고정 (= 채우기, Fill)
+#define DMA_REPEAT      0x02000000 // 타이밍마다 반복
+#define DMA_16          0x00000000 // 16비트 단위 전송
+#define DMA_32          0x04000000 // 32비트 단위 전송
+#define DMA_NOW         0x00000000 // 즉시 시작
+#define DMA_AT_VBLANK   0x10000000 // VBlank 시작 시
+#define DMA_AT_HBLANK   0x20000000 // HBlank마다
+#define DMA_AT_SPECIAL  0x30000000 // 사운드 FIFO 등 특수 타이밍
+#define DMA_IRQ         0x40000000 // 완료 시 인터럽트
+#define DMA_ENABLE      0x80000000 // 전송 시작
+
+// OAM 속성 비트 (스프라이트 1개 = attr0 / attr1 / attr2)
+// attr0: Y(8비트) | 모드 | 색 | 모양,  attr1: X(9비트) | 뒤집기 | 크기,  attr2: 타일 | 우선순위 | 팔레트
+#define ATTR0_Y(y)      ((y) & 0x00FF)
+#define ATTR0_HIDE      0x0200 // 숨기기 (일반 스프라이트 전용)
+#define ATTR0_AFFINE    0x0100 // 아핀 스프라이트 (attr1의 9~13비트 = 행렬 번호)
+#define ATTR0_AFF_DBL   0x0300 // 아핀 + 그리는 영역 2배 (회전해도 모서리가 잘리지 않음)
+#define ATTR0_BLEND     0x0400 // 반투명 OBJ (REG_BLDCNT 설정과 관계없이 EVA/EVB로 아래와 섞임)
+#define ATTR0_WINDOW    0x0800 // OBJ 윈도우 모양으로만 쓰임 (그려지지 않음)
+#define ATTR0_MOSAIC    0x1000 // 모자이크 적용 (REG_MOSAIC의 OBJ 크기)
+#define ATTR0_8BPP      0x2000 // 256색 (0이면 16색 x 팔레트 16개)
+#define ATTR0_SQUARE    0x0000
+#define ATTR0_WIDE      0x4000
+#define ATTR0_TALL      0x8000
+#define ATTR1_X(x)      ((x) & 0x01FF)
+#define ATTR1_HFLIP     0x1000
+#define ATTR1_VFLIP     0x2000
+#define ATTR1_SIZE(n)   ((n) << 14) // 0 ~ 3 (모양과 조합해서 8x8 ~ 64x64)
+#define ATTR1_AFF_ID(n) ((n) << 9)  // 아핀 스프라이트의 행렬 번호 0 ~ 31 (뒤집기 비트 자리)
+#define ATTR2_TILE(n)   ((n) & 0x03FF)
+#define ATTR2_PRIO(n)   ((n) << 10) // BG와의 우선순위 0 ~ 3 (0 = 맨 앞)
+#define ATTR2_PALBANK(n) ((n) << 12)
+
+// 배경 제어 비트 (REG_BGCNT)
+#define BG_PRIO(n)      (n)          // 0 ~ 3 (0 = 맨 앞)
+#define BG_CBB(n)       ((n) << 2)   // 타일을 읽을 캐릭터 블록 0 ~ 3
+#define BG_MOSAIC       0x0040
+#define BG_4BPP         0x0000       // 16색 x 팔레트 16개 (타일 32바이트)
+#define BG_8BPP         0x0080       // 256색 (타일 64바이트)
+#define BG_SBB(n)       ((n) << 8)   // 맵을 읽을 스크린 블록 0 ~ 31
+#define BG_SIZE_32x32   0x0000       // 256 x 256 픽셀, 스크린 블록 1개
+#define BG_SIZE_64x32   0x4000       // 512 x 256, 2개 (좌, 우)
+#define BG_SIZE_32x64   0x8000       // 256 x 512, 2개 (위, 아래)
+#define BG_SIZE_64x64   0xC000       // 512 x 512, 4개 (좌상, 우상, 좌하, 우하)
+#define BG_AFF_WRAP     0x2000       // 아핀 배경: 맵 밖을 반복 (0이면 투명)
+#define BG_AFF_16x16    0x0000       // 아핀 배경 크기: 128 x 128 픽셀 (맵 칸 = u8 타일 번호, 8bpp 고정)
+#define BG_AFF_32x32    0x4000       // 256 x 256
+#define BG_AFF_64x64    0x8000       // 512 x 512
+#define BG_AFF_128x128  0xC000       // 1024 x 1024
+
+// 윈도우 비트 (REG_WININ / REG_WINOUT: 하위 바이트 = 윈도우 0 / 바깥, 상위 바이트 = 윈도우 1 / OBJ 윈도우)
+#define WIN_BG(n)       (1 << (n))   // 이 영역에서 BGn 표시
+#define WIN_OBJ         0x0010
+#define WIN_BLD         0x0020       // 이 영역에서 색 효과(블렌드/밝기) 적용
+#define WIN_H(l, r)     (((l) << 8) | (r))
+#define WIN_V(t, b)     (((t) << 8) | (b))
+
+// 색 효과 비트 (REG_BLDCNT: 하위 6비트 = 첫 번째 대상, 비트 8~13 = 두 번째 대상)
+#define BLD_BG(n)       (1 << (n))
+#define BLD_OBJ         0x0010
+#define BLD_BD          0x0020       // 배경색 (팔레트 0번, 모든 레이어 뒤)
+#define BLD_ALL         0x003F
+#define BLD_OFF         0x0000
+#define BLD_ALPHA       0x0040       // 반투명: 첫 번째 대상 x EVA + 바로 아래의 두 번째 대상 x EVB
+#define BLD_WHITE       0x0080       // 밝게: 첫 번째 대상을 흰색 쪽으로 EVY만큼
+#define BLD_BLACK       0x00C0       // 어둡게: 검은색 쪽으로
+#define BLD_BOTTOM(m)   ((m) << 8)   // 두 번째 대상 레이어
+#define BLDALPHA_BUILD(eva, evb) ((u16)((eva) | ((evb) << 8)))
+#define MOSAIC_BUILD(bh, bv, oh, ov) ((u16)((bh) | ((bv) << 4) | ((oh) << 8) | ((ov) << 12)))
+
+// 맵 칸 (Screen Entry, u16): 타일 번호 10비트 | 뒤집기 | 팔레트 뱅크
+#define SE_TILE(n)      ((n) & 0x03FF)
+#define SE_HFLIP        0x0400
+#define SE_VFLIP        0x0800
+#define SE_PALBANK(n)   ((n) << 12)
+
+// 타이머 제어 비트 (REG_TM_CNT_H)
+#define TM_FREQ_1       0x0000 // 1 클럭마다 증가 (16.78MHz)
+#define TM_FREQ_64      0x0001
+#define TM_FREQ_256     0x0002
+#define TM_FREQ_1024    0x0003
+#define TM_CASCADE      0x0004 // 이전 타이머가 넘칠 때마다 증가 (32비트 연결용)
+#define TM_IRQ          0x0040 // 넘칠 때 인터럽트
+#define TM_ENABLE       0x0080
+
+// 사운드 제어 비트 (REG_SOUNDCNT_H / REG_SOUNDCNT_X)
+#define SDS_A100        0x0004 // Direct Sound A 볼륨 100% (없으면 50%)
+#define SDS_B100        0x0008
+#define SDS_AR          0x0100 // A를 오른쪽 스피커로
+#define SDS_AL          0x0200 // A를 왼쪽 스피커로
+#define SDS_ATMR1       0x0400 // A의 재생 속도 = 타이머 1 (없으면 타이머 0)
+#define SDS_ARESET      0x0800 // FIFO A 비우기 (쓰기 전용)
+#define SDS_BR          0x1000
+#define SDS_BL          0x2000
+#define SDS_BTMR1       0x4000
+#define SDS_BRESET      0x8000
+#define SNDSTAT_ENABLE  0x0080 // SOUNDCNT_X: 사운드 전체 켜기
+
+// 카트리지 버스 대기 비트 (REG_WAITCNT)
+#define WAIT_SRAM_MASK  0x0003
+#define WAIT_SRAM_8     0x0003 // SRAM/Flash 접근 8사이클 (Flash 칩은 이 값이어야 안전)
 
 // =========================================================================
 // 5. 색상 매크로 (Color Macros)
@@ -106,6 +423,12 @@ typedef unsigned int   u32; // 32비트 (4바이트): 메모리 주소, 큰 데
 #define KEY_DOWN        0x0080 // 7번 비트
 #define KEY_R           0x0100 // 8번 비트
 #define KEY_L           0x0200 // 9번 비트
+#define KEY_MASK        0x03FF // 키 10개 전체
+#define KEY_DPAD        (KEY_RIGHT | KEY_LEFT | KEY_UP | KEY_DOWN)
+
+// REG_KEYCNT 비트
+#define KEYCNT_IRQ      0x4000
+#define KEYCNT_AND      0x8000
 
 // =========================================================================
 // 7. 인라인 유틸리티 함수 (Inline Utilities)
@@ -122,4 +445,74 @@ static inline void sync_vblank() {
     while (REG_VCOUNT < 160);  // VDraw 중이면 대기
 }
 
+// DMA 전송 함수
+// ctrl = 개수(하위 16비트) | DMA_xxx 플래그. 예) DMA_32 | DMA_SRC_FIXED | 1200
+// 1. 이전 설정이 남아있으면 오동작하므로 먼저 CNT를 0으로 끔
+// 2. 주소를 쓰고 마지막에 CNT(+DMA_ENABLE)를 써야 전송이 시작됨
+// 3. 레지스터 네 번 쓰는 동안은 인터럽트를 끔
+//    (메인의 mem_copy32와 VBlank의 sprite_vblank가 둘 다 DMA3를 씀. 사이에 끼어들면
+//     메인이 인터럽트 쪽 SAD/DAD로 전송을 켜서 자기 복사는 사라지고 OAM이 다시 써짐)
+//    즉시(DMA_NOW) 전송은 끝날 때까지 CPU가 멈추므로 IME를 되돌릴 때는 이미 끝나 있음
+// 호스트 빌드에서는 host.c가 같은 의미로 메모리를 직접 복사함
+// (DMA_AT_HBLANK / DMA_AT_VBLANK는 가상 스캔라인이 그 시점을 지날 때 실행)
+static inline void dma_transfer(int ch, const volatile void* src, volatile void* dst, u32 ctrl) {
+#ifdef GBA_HOST
+    host_dma(ch, src, dst, ctrl | DMA_ENABLE);
+#else
+    u16 ime = REG_IME;
+    REG_IME = 0;
+    REG_DMA_CNT(ch) = 0;
+    REG_DMA_SAD(ch) = (u32)src;
+    REG_DMA_DAD(ch) = (u32)dst;
+    REG_DMA_CNT(ch) = ctrl | DMA_ENABLE;
+    REG_IME = ime;
+#endif
+}
+
+// DMA 채널 정지 (DMA_REPEAT로 걸어 둔 HBlank / VBlank 전송을 끌 때)
+static inline void dma_stop(int ch) {
+#ifdef GBA_HOST
+    host_dma(ch, NULL, NULL, 0);
+#else
+    REG_DMA_CNT(ch) = 0;
+#endif
+}
+
+// =========================================================================
+// 8. 코드 / 데이터 배치 속성 (Section Attributes)
+// -------------------------------------------------------------------------
+// ROM(카트리지)은 16비트 버스 + 대기 상태(Wait State)가 있어 느립니다.
+// 자주 도는 내부 루프는 IWRAM(32KB, 32비트 버스, 대기 0)에 올려 ARM 모드로 실행하는 것이 정석입니다.
+// - IWRAM_CODE: 함수를 .iwram 섹션에 배치 (시작 시 crt0가 ROM -> IWRAM 복사)
+//               ROM에서 IWRAM까지는 BL 명령 범위(±4MB)를 벗어나므로 long_call 필요
+// - ARM_CODE:   -mthumb 빌드에서도 이 함수만 32비트 ARM 명령어로 컴파일
+// - IWRAM_DATA: 초기값 있는 전역을 IWRAM에 (기본 .data/.bss도 IWRAM이라 명시용)
+// - EWRAM_DATA: 초기값 있는 전역을 EWRAM(256KB, 16비트 버스, 대기 2)에 배치
+// - EWRAM_BSS:  초기값 없는 큰 버퍼를 EWRAM에 (crt0가 0으로 채움, ROM 공간을 쓰지 않음)
+//               IWRAM은 스택과 같이 쓰므로, 자주 안 쓰는 큰 배열은 EWRAM으로 보낼 것
+//
+// [파일 단위 배치]
+//   src/xxx.iwram.c 처럼 이름에 .iwram을 붙이면 makefile이 그 파일 전체를
+//   -marm -mlong-calls로 컴파일하고, 링커 스크립트(gba_cart.ld)의 *iwram.* 규칙에 따라
+//   코드(.text)와 데이터가 통째로 IWRAM에 들어갑니다. 함수마다 속성을 붙일 필요가 없음.
+//
+// [확인] 링크가 끝나면 tools/memmap.sh가 섹션 크기, IWRAM/EWRAM 여유, ROM에 남은
+//        큰 함수 20개를 출력합니다 (make memmap으로 다시 볼 수 있음).
+// 호스트 빌드에서는 아무 의미가 없으므로 비워 둡니다.
+// =========================================================================
+
+#ifdef GBA_HOST
+#define IWRAM_CODE
+#define ARM_CODE
+#define IWRAM_DATA
+#define EWRAM_DATA
+#define EWRAM_BSS
+#else
+#define IWRAM_CODE      __attribute__((section(".iwram"), long_call))
+#define ARM_CODE        __attribute__((target("arm")))
+#define IWRAM_DATA      __attribute__((section(".iwram")))
+#define EWRAM_DATA      __attribute__((section(".ewram")))
+#define EWRAM_BSS       __attribute__((section(".sbss")))
+#endif
+
 #endif
\ No newline at end of file
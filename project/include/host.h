@@ -0,0 +1,87 @@
+#ifndef HOST_H
+#define HOST_H
+
+// =========================================================================
+// 호스트(PC) 시뮬레이션 레이어 (make host 전용)
+// -------------------------------------------------------------------------
+// GBA_HOST가 정의된 빌드에서만 gba.h가 이 헤더를 포함합니다.
+// 실제 구현은 host/host.c에 있으며, 다음 세 가지를 제공합니다.
+//
+// [1. 가짜 메모리 맵]
+//    VRAM(96KB), 팔레트(1KB), OAM(1KB), I/O 레지스터 블록(1KB)을 평범한 배열로 만들어 두고,
+//    gba.h의 REG_BASE / PAL_BASE / VRAM_BASE / OAM_BASE가 이 배열을 가리키게 합니다.
+//
+// [2. 결정적(Deterministic) 프레임 드라이버]
+//    REG_VCOUNT를 읽을 때마다 스캔라인이 1줄씩 진행됩니다 (0 ~ 227 순환).
+//    159 -> 160으로 넘어가는 순간이 한 프레임의 끝(VBlank 시작)이며,
+//    이때 프레임 시간 측정, 키 입력 스크립트 재생, 종료 판정을 수행합니다.
+//
+// [3. 환경 변수 설정]
+//    HOST_FRAMES=N      : N 프레임 후 종료 (기본값 600 = 10초)
+//    HOST_KEYS=path     : 키 입력 스크립트 파일 (형식은 host.c 참고)
+//    HOST_DUMP=path.ppm : 종료 시 화면을 PPM 이미지로 저장
+//    HOST_WAV=path.wav  : Direct Sound FIFO에서 재생된 샘플을 WAV로 저장 (타이머 0 속도, 16비트 스테레오)
+//    HOST_SAV=path.sav  : 세이브 칩 내용을 파일로 (시작 시 읽고, 종료 시 저장. 없으면 빈 칩)
+//    HOST_SAVE_TYPE=t   : 카트리지 세이브 칩 종류 sram / flash64 / flash128 (기본값 flash128)
+//    HOST_SAVE_CUT=N    : N번째 세이브 쓰기(바이트 쓰기 / 섹터 지우기) 도중 전원 차단 흉내
+//                         -> 그 쓰기는 일부만 반영된 채 파일을 저장하고 종료 (전원 차단 퍼즈 테스트용)
+//
+// 종료 시 프레임당 CPU 시간(평균/최소/최대)과 VRAM 해시를 출력하므로,
+// CI에서 벤치마크와 렌더러 회귀 테스트(해시 비교)에 그대로 쓸 수 있습니다.
+// =========================================================================
+
+#include <stdint.h>
+
+#define HOST_IO_SIZE    0x00400 // I/O 레지스터 영역 (0x04000000 ~ 0x040003FF)
+#define HOST_PAL_SIZE   0x00400 // 팔레트 RAM 1KB
+#define HOST_VRAM_SIZE  0x18000 // VRAM 96KB
+#define HOST_OAM_SIZE   0x00400 // OAM 1KB
+
+extern uint16_t host_io[HOST_IO_SIZE / 2];
+extern uint16_t host_pal[HOST_PAL_SIZE / 2];
+extern uint16_t host_vram[HOST_VRAM_SIZE / 2];
+extern uint16_t host_oam[HOST_OAM_SIZE / 2];
+
+// 가상 스캔라인 카운터: 호출할 때마다 1줄 진행 후 REG_VCOUNT 위치를 반환
+// 줄이 바뀔 때 REG_DISPSTAT 상태 비트를 갱신하고, 허용된 VBlank/HBlank/VCount
+// 인터럽트를 발생시킴 (타이머 등 다른 인터럽트는 흉내 내지 않음)
+volatile uint16_t* host_vcount(void);
+
+// BIOS의 ISR 주소(0x03007FFC) / IntrWait 플래그(0x03007FF8) 대체
+extern void (*volatile host_isr)(void);
+extern volatile uint16_t host_ifbios;
+
+// 인터럽트 발생: REG_IF에 표시하고, IME/IE가 허용하면 host_isr 호출
+void host_raise_irq(uint16_t mask);
+
+// 지금까지 처리된(ISR이 호출된) 인터럽트 수 (Halt 흉내용)
+uint32_t host_irq_count(void);
+
+// 지금까지 끝난 프레임 수
+uint32_t host_frame_count(void);
+
+// dma_transfer() / dma_stop()의 호스트 구현: ctrl(개수 + DMA_xxx 플래그)대로 즉시 복사.
+// DMA_AT_HBLANK / DMA_AT_VBLANK는 가상 스캔라인이 그 시점을 지날 때마다 실행 (DMA_REPEAT면 계속)
+// DMA_AT_SPECIAL(채널 1, 2 -> FIFO_A/B)은 흉내 낸 FIFO가 절반 이상 비었을 때 4워드씩 실행
+// DMA_ENABLE이 없으면 채널 정지
+void host_dma(int ch, const volatile void* src, volatile void* dst, uint32_t ctrl);
+
+// 프로그램 시작 이후 경과 시간을 GBA 클럭(16.78MHz) 단위로 환산한 값
+uint32_t host_cycles(void);
+
+// 세이브 칩 (host/save.c): SRAM_READ / SRAM_WRITE 매크로의 호스트 구현
+// Flash는 명령 순서(0xAA@5555, 0x55@2AAA, 명령@5555)를 해석하고, 섹터 지우기는
+// 가상 스캔라인으로 몇 줄 동안 바쁜 상태(읽으면 0x00)를 흉내 냄. 바이트 쓰기는 1을 0으로만 바꿈
+#define HOST_SAVE_SRAM      1 // 32KB SRAM
+#define HOST_SAVE_FLASH64   2 // 64KB Flash (Macronix MX29L512)
+#define HOST_SAVE_FLASH128  3 // 128KB Flash (Macronix MX29L010, 64KB 뱅크 2개)
+
+uint8_t host_save_read(uint32_t off);
+void    host_save_write(uint32_t off, uint8_t v);
+int     host_save_type(void); // HOST_SAVE_TYPE으로 고른 칩
+
+// host.c 내부용: 줄마다 바쁜 시간 진행 / 종료 보고
+void host_save_line(void);
+void host_save_report(void);
+
+#endif // HOST_H
@@ -0,0 +1,93 @@
+#ifndef INPUT_H
+#define INPUT_H
+
+#include "gba.h"
+
+// =========================================================================
+// 키 입력: 프레임 스냅샷 + 눌림/뗌 감지 + 자동 반복 + 입력 녹화/재생
+// -------------------------------------------------------------------------
+// REG_KEYINPUT을 여기저기서 직접 읽으면 같은 프레임 안에서도 값이 달라질 수 있고,
+// '방금 눌렸는지'를 알려면 코드마다 이전 값을 따로 들고 있어야 합니다.
+//
+// [1. 스냅샷]
+//    key_poll()을 프레임마다 한 번(VBlank 직후) 부르면 레지스터를 한 번만 읽어
+//    key_curr(이번 프레임) / key_prev(지난 프레임)에 저장합니다.
+//    둘 다 Active High (눌림 = 1)로 뒤집어 두므로 나머지 함수는 비트 연산 한두 개입니다.
+//      key_held(k)     : 지금 눌려 있음
+//      key_hit(k)      : 이번 프레임에 눌림   (지난 프레임엔 안 눌림)
+//      key_released(k) : 이번 프레임에 뗌
+//      key_repeat(k)   : 눌린 순간 + delay 프레임 뒤부터 rate 프레임마다 (메뉴 커서용)
+//
+// [2. Stop에서 깨우기]
+//    key_sleep(KEY_L | KEY_R | KEY_SELECT)는 화면을 끄고 BIOS Stop으로 들어가서
+//    지정한 키가 '모두' 눌릴 때까지 거의 전력을 쓰지 않고 기다립니다. (키패드 인터럽트)
+//
+// [3. 녹화 / 재생]
+//    key_poll()이 얻은 값을 (키 상태, 이어진 프레임 수) 묶음(RLE)으로 버퍼에 기록합니다.
+//    키를 바꾸는 일은 드물어서 1분 플레이도 보통 수십~수백 개면 충분합니다.
+//    재생 중에는 레지스터 대신 테이프 값을 돌려주므로 게임 로직이 똑같이 다시 실행됩니다.
+//    key_tape_log()는 테이프를 호스트 키 스크립트 형식으로 로그에 출력합니다:
+//      KEYS 0 RIGHT
+//      KEYS 30 RIGHT A
+//    'KEYS '를 뗀 줄을 파일로 저장하면 HOST_KEYS=파일 로 그대로 재생됩니다.
+//    프레임 번호는 VBlank 횟수(irq_frame_count) 기준이라 호스트 프레임 번호와 일치합니다.
+// =========================================================================
+
+// 프레임 스냅샷 (Active High). 직접 읽어도 되지만 쓰지 말 것
+extern u16 key_curr;
+extern u16 key_prev;
+extern u16 key_rpt;
+
+// 자동 반복 기본값 (프레임)
+#define KEY_REPEAT_DELAY 20
+#define KEY_REPEAT_RATE  4
+
+// RLE 테이프 한 칸: keys 상태가 count 프레임 동안 이어짐
+typedef struct {
+    u16 keys;
+    u16 count;
+} KeyRun;
+
+// ---------------------------------------------------------
+// 1. 스냅샷
+// ---------------------------------------------------------
+// 프레임마다 한 번. 재생 중이면 레지스터 대신 테이프에서 읽음
+void key_poll(void);
+
+static inline u16 key_held(u16 k)     { return key_curr & k; }
+static inline u16 key_hit(u16 k)      { return key_curr & ~key_prev & k; }
+static inline u16 key_released(u16 k) { return ~key_curr & key_prev & k; }
+static inline u16 key_repeat(u16 k)   { return key_rpt & k; }
+
+// 자동 반복 설정. mask에 없는 키는 key_repeat에 나타나지 않음 (기본: 방향키)
+void key_repeat_config(u16 mask, int delay, int rate);
+
+// ---------------------------------------------------------
+// 2. 절전
+// ---------------------------------------------------------
+// wake_keys가 모두 눌릴 때까지 Stop (화면/사운드/타이머 정지).
+// 들어올 때 wake_keys를 누르고 있으면 먼저 다 뗄 때까지 기다림. 키패드 인터럽트 핸들러는 원래대로 복원
+// 깨어난 뒤 그 키들은 '이미 눌려 있던 것'으로 처리되어 key_hit에 잡히지 않음
+void key_sleep(u16 wake_keys);
+
+// ---------------------------------------------------------
+// 3. 녹화 / 재생
+// ---------------------------------------------------------
+// buf에 최대 cap개 기록 시작 (꽉 차면 녹화가 멈춤)
+void key_record_start(KeyRun* buf, int cap);
+
+// 녹화 종료. 반환값: 기록한 칸 수
+int  key_record_stop(void);
+
+// 첫 칸이 기록된 프레임 (irq_frame_count 값)
+u32  key_record_frame(void);
+
+// tape[0..count-1] 재생 시작. 끝나면 자동으로 레지스터 입력으로 돌아감
+void key_play_start(const KeyRun* tape, int count);
+void key_play_stop(void);
+bool key_playing(void);
+
+// 테이프를 "KEYS <프레임> <키 이름...>" 줄로 출력 (debug.h). first_frame = 첫 칸의 프레임 번호
+void key_tape_log(const KeyRun* tape, int count, u32 first_frame);
+
+#endif // INPUT_H
@@ -0,0 +1,62 @@
+#ifndef IRQ_H
+#define IRQ_H
+
+#include "gba.h"
+
+// =========================================================================
+// 인터럽트 (IRQ) 시스템
+// -------------------------------------------------------------------------
+// sync_vblank()는 REG_VCOUNT를 계속 읽으며 기다리므로(Busy Polling),
+// 남는 시간 내내 CPU가 최대 전력으로 헛돌고, 그동안 다른 일도 못 합니다.
+//
+// [동작 구조]
+//    1. 하드웨어가 인터럽트를 올리면 BIOS가 0x03007FFC에 적힌 함수를 ARM 모드로 호출
+//    2. 우리의 디스패처(IWRAM, ARM)가 IE & IF를 보고 등록된 핸들러를 호출
+//    3. IF에 1을 써서 확인(Ack)하고, BIOS용 플래그(0x03007FF8)에도 기록
+//       -> 이 기록이 있어야 VBlankIntrWait 같은 BIOS 대기 함수가 깨어남
+//
+// [대기 방식]
+//    vblank_wait()는 BIOS VBlankIntrWait로 CPU를 재웁니다 (Halt, 저전력).
+//    idle job이 등록되어 있으면, 자는 대신 다음 VBlank가 올 때까지
+//    job을 조금씩 실행하고, 일이 바닥나면 그때 잠듭니다.
+//
+// [주의]
+//    - 핸들러는 인터럽트가 꺼진 상태에서 실행되므로 짧게 작성할 것 (중첩 없음)
+//    - 타이머 인터럽트는 irq_set 외에 해당 타이머의 TM_IRQ 비트도 켜야 함
+//    - 호스트 빌드에서는 VBlank/HBlank/VCount만 흉내 냅니다 (host.h 참고)
+// =========================================================================
+
+typedef void (*IrqHandler)(void);
+
+// idle job: 한 조각 실행 후, 아직 남은 일이 있으면 true 반환
+typedef bool (*IdleJob)(void* ctx);
+
+#define IRQ_MAX_IDLE_JOBS 8
+
+// 디스패처 설치 + VBlank 인터럽트 켜기 + IME = 1
+void irq_init(void);
+
+// mask의 각 인터럽트에 핸들러 등록 후 허용 (handler = NULL이면 허용만)
+// VBlank/HBlank/VCount는 REG_DISPSTAT의 발생 허용 비트도 함께 켬
+void irq_set(u16 mask, IrqHandler handler);
+
+// mask의 인터럽트 끄기 (VBlank는 프레임 카운터용으로 끌 수 없음)
+void irq_clear(u16 mask);
+
+// mask에서 가장 낮은 비트 인터럽트에 등록된 핸들러 (잠깐 바꿨다가 되돌릴 때)
+IrqHandler irq_get(u16 mask);
+
+// VCount 일치 인터럽트의 대상 줄 (0 ~ 227)
+void irq_set_vcount(int line);
+
+// 지금까지 지나간 VBlank 수 (VBlank 인터럽트에서 증가)
+u32 irq_frame_count(void);
+
+// 다음 VBlank 시작까지 대기 (sync_vblank의 인터럽트 버전)
+void vblank_wait(void);
+
+// 남는 시간에 실행할 작업 등록. 반환값: 등록 성공 여부
+// job이 false를 반환하면 자동으로 목록에서 빠짐
+bool irq_add_idle_job(IdleJob job, void* ctx);
+
+#endif // IRQ_H
@@ -0,0 +1,52 @@
+#ifndef MEM_H
+#define MEM_H
+
+#include "gba.h"
+
+// =========================================================================
+// 메모리 커널 (Bulk Fill / Copy)
+// -------------------------------------------------------------------------
+// clear_screen처럼 C 루프로 VRAM을 한 칸씩 채우면, 매 반복마다
+// 저장 + 증가 + 비교 + 분기 명령이 ROM(16비트 버스)에서 실행되어 느립니다.
+// 이 모듈은 같은 일을 세 가지 '빠른 길' 중 하나로 처리합니다.
+//
+// [전략 (Strategy)]
+//    MEM_CPU     : 평범한 C 루프. 몇 워드짜리 작은 작업은 이게 제일 쌈 (준비 비용 0)
+//    MEM_STMIA   : IWRAM에 올린 ARM 코드가 stmia로 8워드(32바이트)씩 한 번에 씀
+//    MEM_DMA     : DMA3에 맡김. 채우기(원본 고정)에 특히 강함. 전송 중 CPU 정지
+//    MEM_FASTSET : BIOS CpuFastSet (SWI 0x0C). 내부는 stmia와 같지만 호출 비용이 큼
+//    MEM_AUTO    : 크기에 따라 위 전략 중 하나를 자동 선택 (기본값)
+//
+// [정렬 (Alignment)]
+//    - fill32/copy32: 주소가 4바이트 정렬되어 있어야 함
+//    - fill16/copy16: 2바이트 정렬이면 OK. 앞/뒤의 어긋난 halfword는 따로 처리하고
+//                     가운데 몸통만 32비트 커널로 넘김
+//
+// 자동 선택 기준값은 sandbox/bench_mem.c 결과를 보고 정한 것입니다.
+// =========================================================================
+
+typedef enum {
+    MEM_AUTO = 0,
+    MEM_CPU,
+    MEM_STMIA,
+    MEM_DMA,
+    MEM_FASTSET,
+    MEM_STRATEGY_COUNT
+} MemStrategy;
+
+// 자동 선택 기준 (워드 단위)
+#define MEM_SMALL_WORDS 16  // 이보다 작으면 CPU 루프
+#define MEM_LARGE_WORDS 512 // 이 이상이면 DMA(채우기) / CpuFastSet(복사)
+
+// 전략 강제 지정 (벤치마크용). MEM_AUTO로 되돌리면 자동 선택.
+void        mem_set_strategy(MemStrategy strategy);
+MemStrategy mem_get_strategy(void);
+const char* mem_strategy_name(MemStrategy strategy);
+
+// count는 '원소 개수' (fill16/copy16 = halfword 개수, fill32/copy32 = word 개수)
+void mem_fill16(volatile void* dst, u16 value, u32 count);
+void mem_fill32(volatile void* dst, u32 value, u32 count);
+void mem_copy16(volatile void* dst, const volatile void* src, u32 count);
+void mem_copy32(volatile void* dst, const volatile void* src, u32 count);
+
+#endif // MEM_H
@@ -0,0 +1,132 @@
+#ifndef OBJTILE_H
+#define OBJTILE_H
+
+#include "gba.h"
+
+// =========================================================================
+// OBJ 타일 VRAM 할당기 (공유 시트 + 애니메이션 프레임 스트리밍 + 조각 모으기)
+// -------------------------------------------------------------------------
+// 스프라이트 타일이 들어가는 OBJ VRAM은 32KB(4bpp 타일 1024개)뿐이고, 비트맵 모드에서는 그 절반입니다.
+// 캐릭터마다 걷기 / 공격 / 피격 애니메이션 프레임을 전부 올려 두면 금방 모자랍니다.
+//
+// [1. 블록 할당 (first-fit, 1D 매핑)]
+//    1D 매핑(DCNT_OBJ_1D)에서 스프라이트 하나의 타일은 시작 번호부터 연속으로 놓여야 하므로
+//    "연속된 타일 n개" 단위로 할당합니다. 사용 여부는 타일당 1비트 (u32 32개).
+//    앞에서부터 처음 맞는 빈자리를 쓰고(first-fit), 8bpp 블록은 짝수 번호에서 시작합니다.
+//    반환값은 VRAM 위치가 아니라 핸들(번호)입니다 -> 아래 조각 모으기가 블록을 옮길 수 있도록.
+//
+// [2. 공유 시트 (참조 카운트)]
+//    objtile_sheet(src, ...)는 같은 원본(src)이 이미 올라가 있으면 참조만 하나 늘리고 같은 핸들을 돌려줌.
+//    적 10마리가 같은 시트를 쓰면 VRAM에는 한 벌. 마지막 objtile_release에서 블록이 반환됩니다.
+//    시트는 할당하는 자리에서 바로 복사합니다. (새 블록은 아직 아무 스프라이트도 보고 있지 않음)
+//
+// [3. 프레임 스트리밍]
+//    objtile_stream()은 전체 프레임이 아니라 "한 프레임 분량"만 VRAM에 잡습니다. (스프라이트마다 하나)
+//    objtile_set_frame()으로 프레임이 바뀌면 업로드를 예약하고, objtile_vblank()가 그 프레임 타일만
+//    DMA3로 덮어씁니다. 프레임이 그대로면 아무것도 보내지 않음.
+//    VDraw 중에 화면에 나가고 있는 타일을 고치면 위아래가 다른 프레임으로 찢어지므로 반드시 VBlank에서.
+//    단, 인터럽트 핸들러가 아니라 메인 루프에서 vblank_wait() 바로 다음에 부릅니다.
+//    할당 비트 / 업로드 큐 / 통계를 메인 루프의 objtile_xxx와 같이 고치고, 조각 모으기와 같은 DMA3를 쓰므로
+//    핸들러에서 부르면 메인 쪽 작업 도중에 끼어들어 상태가 깨질 수 있음. (이 모듈은 인터럽트를 끄지 않음)
+//    VBlank 한 번에 OBJTILE_VBLANK_BYTES까지만 보내고 나머지는 다음 VBlank로 미룸 (한 프레임 늦게 바뀜)
+//
+// [4. 조각 모으기 (compaction)]
+//    할당 / 해제가 반복되면 빈 타일은 충분한데 연속된 빈자리가 없어 실패할 수 있습니다.
+//    objtile_compact(max_tiles)는 가장 뒤에 있는 블록을 앞쪽 빈자리로 옮기는 일을
+//    max_tiles 타일만큼만 하고 멈춥니다. (프레임마다 조금씩 -> 한 프레임이 튀지 않음)
+//    빈자리 찾기도 호출당 OBJTILE_COMPACT_SCAN만큼만 하고, 다음 호출은 멈춘 블록부터 이어서 함.
+//    한 바퀴 동안 옮길 것이 없으면 블록이 비워질 때까지 바로 돌아옴 (max_tiles보다 큰 블록은 옮기지 않음)
+//    - 옮긴 뒤에도 예전 자리는 OBJTILE_RETIRE_VBLANKS번의 VBlank 동안 비우지 않습니다.
+//      (이미 만들어 둔 OAM이 예전 번호를 가리킨 채 한두 프레임 더 나갈 수 있으므로)
+//    - 그래서 타일 번호는 매 프레임 objtile_tile(h)로 다시 읽어 sprite_add에 넘길 것.
+//      고정 슬롯(sprite_set)처럼 번호를 한 번만 쓰는 곳에는 OBJTILE_PINNED (옮기지 않음)
+//
+// [5. 프레임 흐름]
+//    (VBlank 핸들러) sprite_vblank();            // 또는 메인 루프에서 objtile_vblank 앞에
+//    루프: vblank_wait(); objtile_vblank();       // OAM 다음에 타일 (해제 대기 계산이 OAM 전송 기준)
+//    ... objtile_set_frame(h, anim_frame);
+//        sprite_add(x, y, SPR_32x32, ATTR2_TILE(objtile_tile(h)), 0, 0);
+//        objtile_compact(OBJTILE_COMPACT_STEP);     // 여유가 있는 프레임에
+//
+// 업로드 / 조각 모으기 시간은 PROFILE 빌드에서 "objtile" 구간으로 잡히고,
+// 조각화 정도 / 최대 사용량 / 프레임당 업로드 바이트는 objtile_stats()로 읽습니다.
+// =========================================================================
+
+#define OBJTILE_TILES         1024            // OBJ VRAM 전체 (4bpp 타일 = 32바이트 단위)
+#define OBJTILE_BITMAP_FIRST  512             // 비트맵 모드(3/4/5)에서 쓸 수 있는 첫 타일
+#define OBJTILE_MAX_BLOCKS    64
+#define OBJTILE_MAX_RETIRED   32              // 비우기를 기다리는 자리 수
+#define OBJTILE_VBLANK_BYTES  (6 * 1024)      // VBlank 한 번에 올리는 최대 바이트 (DMA 약 3,000 사이클)
+#define OBJTILE_RETIRE_VBLANKS 3              // 옮기거나 놓은 자리를 다시 쓰기까지 기다리는 VBlank 수
+#define OBJTILE_COMPACT_STEP  64              // objtile_compact 권장 한도 (타일 64개 = 2KB 복사)
+#define OBJTILE_COMPACT_SCAN  512             // objtile_compact 한 번의 검사량 상한 (비트 검사 + 블록 훑기)
+
+#define OBJTILE_8BPP   0x01 // 타일 2개(64바이트)가 한 칸, 짝수 번호에서 시작
+#define OBJTILE_PINNED 0x02 // 조각 모으기에서 옮기지 않음
+
+typedef struct {
+    u16 first;          // 할당 범위 [first, OBJTILE_TILES)
+    u16 used;           // 사용 중 타일 (비우기 대기 포함)
+    u16 peak;           // used 최댓값
+    u16 free_tiles;
+    u16 largest_free;   // 가장 긴 연속 빈자리 (이 크기까지는 조각 모으기 없이 할당 가능)
+    u8  fragmentation;  // 100 - largest_free * 100 / free_tiles (%), 0 = 빈자리가 한 덩어리
+    u8  blocks;         // 살아 있는 블록 (시트 + 스트림)
+    u32 frame_bytes;    // 직전 프레임에 OBJ VRAM에 쓴 바이트 (시트 복사 + 조각 모으기 복사 + VBlank 업로드)
+    u32 peak_frame_bytes;
+    u32 total_bytes;    // 누적 업로드 (시트 복사 + 스트리밍 + 조각 모으기 복사)
+    u32 uploads;        // 스트리밍 업로드 수
+    u32 unchanged;      // 같은 프레임이라 보내지 않은 objtile_set_frame 수
+    u32 deferred;       // VBlank 한도 때문에 다음 VBlank로 미룬 업로드 수
+    u32 shared;         // 이미 올라간 시트를 다시 요청해 참조만 늘린 수
+    u32 moves;          // 조각 모으기로 옮긴 블록 수
+    u32 moved_tiles;
+    u32 failures;       // 자리가 없어 실패한 할당
+} ObjTileStats;
+
+// ---------------------------------------------------------
+// 1. 초기화
+// ---------------------------------------------------------
+// first: 할당을 시작할 타일. 타일 모드(0/1/2) = 0, 비트맵 모드 = OBJTILE_BITMAP_FIRST
+void objtile_init(int first);
+
+// ---------------------------------------------------------
+// 2. 블록
+// ---------------------------------------------------------
+// 공유 시트: tiles = 4bpp 타일 데이터(타일당 32바이트, 4바이트 정렬), count = 4bpp 타일 수
+// 반환값: 핸들 (자리가 없으면 -1)
+int  objtile_sheet(const void* tiles, int count, u8 flags);
+
+// 스트리밍 슬롯: frames = 프레임 0부터 연속으로 놓인 타일 데이터, tiles_per_frame = 한 프레임의 4bpp 타일 수
+// 프레임 0은 바로 복사됨
+int  objtile_stream(const void* frames, int tiles_per_frame, int frame_count, u8 flags);
+
+// 참조 하나 반환. 0이 되면 자리는 OBJTILE_RETIRE_VBLANKS번의 VBlank 뒤에 비워짐
+void objtile_release(int h);
+
+// 지금 시작 타일 번호 (ATTR2_TILE에 넘길 값). 조각 모으기 뒤에 바뀔 수 있으므로 매 프레임 읽을 것
+int  objtile_tile(int h);
+
+// ---------------------------------------------------------
+// 3. 스트리밍 / 프레임
+// ---------------------------------------------------------
+// 프레임 바꾸기 (범위 밖은 무시). 바뀐 경우에만 다음 VBlank 업로드 예약
+void objtile_set_frame(int h, int frame);
+
+// 메인 루프에서 vblank_wait() 직후, sprite_vblank() 다음에 호출: 예약된 프레임 업로드 + 비우기 대기 처리
+// VBlank 인터럽트 핸들러에서 부르지 말 것 (3절)
+void objtile_vblank(void);
+
+// 조각 모으기 한 단계: 최대 max_tiles 타일까지 옮김. 반환값: 옮긴 타일 수 (0 = 더 옮길 것이 없음)
+int  objtile_compact(int max_tiles);
+
+// ---------------------------------------------------------
+// 4. 통계
+// ---------------------------------------------------------
+// 빈자리 / 조각화 항목은 부를 때 계산 (비트 1024개 훑기)
+const ObjTileStats* objtile_stats(void);
+
+// 통계와 블록 배치를 로그로 출력
+void objtile_report(void);
+
+#endif // OBJTILE_H
@@ -0,0 +1,93 @@
+#ifndef PROF_H
+#define PROF_H
+
+#include "gba.h"
+
+// =========================================================================
+// 프레임 프로파일러 (Named Zones + Ring Buffer + Overlay / CSV Log)
+// -------------------------------------------------------------------------
+// "한 프레임이 어디에 쓰이는가"(입력, 갱신, VBlank 대기, 그리기)를 재는 도구입니다.
+//
+// [1. 시간 측정]
+//    timer.h의 TM2/TM3 캐스케이드 32비트 카운터를 계속 돌려 두고 시각(사이클)을 읽습니다.
+//    호스트 빌드에서는 같은 함수가 clock_gettime을 16.78MHz 사이클로 환산합니다.
+//    주의: 프로파일 중에 cycle_counter_start()를 부르면 카운터가 0으로 돌아가서
+//          그 순간 열려 있던 구간 값이 망가집니다.
+//
+// [2. 구간 (Zone)]
+//    PROF_BEGIN("update");  ...  PROF_END("update");
+//    - 이름마다 처음 한 번만 등록(문자열 비교)하고, 이후에는 호출 위치의 static id를 씀
+//    - 중첩 가능 (스택). 바깥 구간 시간에는 안쪽 시간도 포함됨
+//    - 한 프레임에 여러 번 들어가면 합산 + 횟수 기록
+//
+// [3. 프레임 경계와 링 버퍼]
+//    PROF_FRAME()을 매 프레임 한 번 호출하면, 그 프레임의 구간별 합계가
+//    PROF_HISTORY 프레임짜리 링 버퍼에 저장되고 다음 프레임 기록이 시작됩니다.
+//
+// [4. 출력]
+//    - PROF_OVERLAY(y): 지난 프레임을 화면 y줄에 가로 막대로 그림 (화면 폭 = 1프레임)
+//    - PROF_DUMP(): 링 버퍼 전체를 mGBA 로그에 CSV로 출력 ("PROF,"로 시작하는 줄)
+//      tools/prof_csv.c로 로그 파일에서 그 줄만 뽑으면 바로 CSV 파일이 됩니다.
+//
+// [5. 끄면 비용 0]
+//    make PROFILE=1 로 빌드할 때만 PROFILE이 정의됩니다.
+//    정의되지 않으면 PROF_xxx 매크로는 전부 빈 문장이 되어 코드가 남지 않습니다.
+// =========================================================================
+
+#define PROF_MAX_ZONES  8
+#define PROF_HISTORY    64 // 링 버퍼 프레임 수
+#define PROF_MAX_DEPTH  8  // 중첩 깊이
+
+#define PROF_BAR_H      4  // 오버레이 막대 높이 (픽셀)
+
+typedef struct {
+    u32 total;                   // 이 프레임 전체 (PROF_FRAME 사이 간격)
+    u32 cycles[PROF_MAX_ZONES];  // 구간별 합계
+    u16 calls[PROF_MAX_ZONES];   // 구간별 진입 횟수
+} ProfFrame;
+
+#ifdef PROFILE
+
+// 카운터 시작 + 기록 초기화
+void prof_init(void);
+
+// 이름 -> id (처음 보는 이름이면 등록). 자리가 없으면 -1
+int  prof_zone_id(const char* name);
+
+void prof_begin(int id);
+void prof_end(int id);
+
+// 프레임 마감 -> 링 버퍼에 저장
+void prof_frame(void);
+
+// 가장 최근에 마감된 프레임 (아직 없으면 NULL)
+const ProfFrame* prof_last(void);
+
+void prof_draw_overlay(int y);
+void prof_dump_log(void);
+
+// 호출 위치마다 id를 static으로 캐시 (첫 호출에서만 이름 검색)
+#define PROF_ZONE_ID_(name, out)                                               \
+    static s8 prof_id_ = -2;                                                   \
+    if (prof_id_ == -2) prof_id_ = (s8)prof_zone_id(name);                     \
+    out = prof_id_
+
+#define PROF_BEGIN(name)    do { int id_; PROF_ZONE_ID_(name, id_); prof_begin(id_); } while (0)
+#define PROF_END(name)      do { int id_; PROF_ZONE_ID_(name, id_); prof_end(id_); } while (0)
+#define PROF_FRAME()        prof_frame()
+#define PROF_OVERLAY(y)     prof_draw_overlay(y)
+#define PROF_DUMP()         prof_dump_log()
+#define PROF_INIT()         prof_init()
+
+#else
+
+#define PROF_BEGIN(name)    do { } while (0)
+#define PROF_END(name)      do { } while (0)
+#define PROF_FRAME()        do { } while (0)
+#define PROF_OVERLAY(y)     do { } while (0)
+#define PROF_DUMP()         do { } while (0)
+#define PROF_INIT()         do { } while (0)
+
+#endif // PROFILE
+
+#endif // PROF_H
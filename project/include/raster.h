@@ -0,0 +1,111 @@
+#ifndef RASTER_H
+#define RASTER_H
+
+#include "gba.h"
+
+// =========================================================================
+// 스캔라인 효과 (HBlank DMA 테이블)
+// -------------------------------------------------------------------------
+// 물결, 줄 단위 패럴랙스, 하늘 그라데이션을 Mode 3 픽셀로 다시 그리면 매 프레임 수만 번 쓰기지만,
+// 하드웨어는 줄마다 레지스터를 다시 읽어서 그리므로 "줄마다 값만 바꿔 주면" 같은 효과가 납니다.
+//
+// [1. 구조]
+//    채널 하나 = 대상 레지스터 하나(또는 붙어 있는 두 개) + 줄별 값 테이블(160줄 + 1).
+//    VBlank에 raster_vblank()가
+//      1) 0번 줄 값을 레지스터에 직접 쓰고
+//      2) DMA를 HBlank + 반복 모드로 걸어서 줄 n의 HBlank마다 테이블[n + 1]을 복사하게 합니다.
+//    VDraw 동안 CPU는 전혀 관여하지 않습니다. (DMA가 줄당 몇 사이클 버스를 빌릴 뿐)
+//
+// [2. 이중 버퍼]
+//    테이블은 채널마다 두 벌입니다. raster_begin() ~ raster_commit() 사이에 뒤쪽 테이블을 만들고,
+//    다음 VBlank에 앞뒤를 바꿉니다. 그리는 중인 테이블을 고치는 일이 없으므로 찢어짐이 없습니다.
+//    begin은 vblank_wait() 직후(이전 commit이 반영된 뒤)에 부를 것.
+//
+// [3. 효과 합성]
+//    한 테이블에 여러 효과를 차례로 얹습니다:
+//      raster_fill     : 기본값으로 채움
+//      raster_bands    : 줄 구간별 값 더하기 (패럴랙스: 구간마다 다른 스크롤)
+//      raster_wave     : 사인파 더하기 (물결)
+//      raster_gradient : 두 색 사이 보간으로 덮어쓰기 (하늘 그라데이션)
+//      raster_lane     : 직접 계산할 때 (원형 윈도우 WIN0H 등)
+//    폭 2 채널은 붙어 있는 레지스터 두 개(예: BG0HOFS + BG0VOFS)를 32비트 DMA 한 번으로 바꾸며,
+//    lane 0 = 앞 레지스터, lane 1 = 뒤 레지스터입니다.
+//
+// [4. DMA 채널]
+//    DMA0(우선순위 최고)을 먼저 쓰고, 두 번째 채널은 DMA2입니다.
+//    DMA3은 mem.h의 복사용, DMA1/2는 Direct Sound FIFO용입니다.
+//    스테레오 사운드(FIFO B = DMA2)가 돌고 있으면 두 번째 채널은 열리지 않고(-1),
+//    반대로 두 번째 채널이 열려 있으면 sound_init(true)가 모노로 시작합니다. (sound.h 4절)
+//
+// [5. 사용 예]
+//    int scroll = raster_open(&REG_BGHOFS(0), 2);   // BG0 HOFS + VOFS
+//    irq_set(IRQ_VBLANK, raster_vblank);
+//    루프: vblank_wait();
+//          raster_begin();
+//          raster_fill(scroll, 0, cam_x);
+//          raster_wave(scroll, 0, 96, RASTER_LINES, 4, 32, frame * 8);  // 아래쪽 물결
+//          raster_commit();
+// =========================================================================
+
+#define RASTER_LINES     SCREEN_H
+#define RASTER_CHANNELS  2
+#define RASTER_MAX_WIDTH 2   // 채널당 레지스터(u16) 수
+
+// 패럴랙스 구간: y줄부터 다음 구간 전까지 value를 더함
+typedef struct {
+    u16 y;
+    s16 value;
+} RasterBand;
+
+typedef struct {
+    u16 channels;      // 열린 채널 수
+    u16 transfers;     // 프레임당 HBlank DMA 전송 횟수
+    u32 dma_cycles;    // 그 전송들이 VDraw 중 버스를 빌리는 시간 (추정, 사이클/프레임)
+    u32 commits;       // 반영된 테이블 수
+    u32 late;          // VBlank 전에 다음 begin이 와서 같은 테이블을 다시 쓴 횟수
+} RasterStats;
+
+// ---------------------------------------------------------
+// 1. 채널
+// ---------------------------------------------------------
+// reg부터 width개(1 또는 2)의 u16 레지스터/팔레트 칸. 반환값: 채널 번호 (자리가 없으면 -1)
+// 채널의 DMA를 사운드가 쓰고 있으면 그 채널은 건너뜀 (LOG_WARN)
+// 양쪽 테이블은 현재 값이 아니라 0으로 시작 (레지스터 대부분이 쓰기 전용)
+int  raster_open(volatile u16* reg, int width);
+
+// DMA를 멈추고 채널 반환. 레지스터는 마지막으로 쓴 값으로 남음
+void raster_close(int ch);
+
+// DMA 채널 dma를 열린 스캔라인 채널이 쓰고 있는지 (sound_init이 확인)
+bool raster_uses_dma(int dma);
+
+// ---------------------------------------------------------
+// 2. 테이블 만들기 (뒤쪽 버퍼)
+// ---------------------------------------------------------
+void raster_begin(void);
+void raster_commit(void);
+
+// 뒤쪽 테이블에서 lane의 0번 줄 위치. 줄 y = p[y * width]
+u16* raster_lane(int ch, int lane);
+
+void raster_fill(int ch, int lane, u16 value);
+void raster_bands(int ch, int lane, const RasterBand* bands, int count);
+
+// 줄 y0 ~ y1-1에 사인파 더하기. amp 픽셀, 파장 wavelength줄, phase는 fixmath 각도(512 = 한 바퀴)
+void raster_wave(int ch, int lane, int y0, int y1, int amp, int wavelength, int phase);
+
+// 줄 y0 ~ y1-1을 c0 -> c1 (BGR555) 보간으로 덮어씀
+void raster_gradient(int ch, int lane, int y0, int y1, u16 c0, u16 c1);
+
+// ---------------------------------------------------------
+// 3. VBlank / 비용
+// ---------------------------------------------------------
+// VBlank 인터럽트에서 호출: 테이블 교체 + 0번 줄 쓰기 + HBlank DMA 재설정
+void raster_vblank(void);
+
+const RasterStats* raster_stats(void);
+
+// 채널별 대상 / 폭 / DMA 비용을 로그로 출력 (debug.h)
+void raster_report(void);
+
+#endif // RASTER_H
@@ -0,0 +1,125 @@
+#ifndef SAVE_H
+#define SAVE_H
+
+#include "gba.h"
+
+// =========================================================================
+// 세이브 (카트리지 SRAM / Flash + 추가 전용 저널)
+// -------------------------------------------------------------------------
+// 세이브 칩은 0x0E000000의 8비트 버스에 붙어 있어 바이트 단위로만 읽고 씁니다.
+//   SRAM 32KB : 그냥 쓰면 됨 (배터리로 유지)
+//   Flash 64KB / 128KB : 쓰기 전에 0xAA@5555, 0x55@2AAA, 명령@5555 순서로 명령을 보냄
+//     - 바이트 쓰기(0xA0)는 비트를 1 -> 0으로만 바꿈. 되돌리려면 4KB 섹터를 통째로 지워야 함(0x80, 0x30)
+//     - 섹터 지우기는 수십 ms (1~2프레임), 바이트 쓰기는 수십 us
+//     - 128KB 칩은 64KB 뱅크 2개 (0xB0 명령으로 전환)
+//
+// [1. 저널]
+//    세이브 데이터를 제자리에 덮어쓰면, 쓰는 도중 전원이 꺼질 때 옛 데이터도 새 데이터도 잃습니다.
+//    그래서 매번 새 레코드를 뒤에 덧붙이고(Append), 읽을 때는 '마지막으로 온전한 레코드'를 고릅니다.
+//      섹터(4KB) = 헤더 [표식, 지운 횟수, ~지운 횟수] + 레코드 ...
+//      레코드     = [표식, 길이, 번호(seq)] + 데이터 + [CRC16, 커밋 바이트]
+//    커밋 바이트(0xFF -> 0x00)는 맨 마지막에 씁니다. 커밋이 없거나 CRC가 틀리면 없는 레코드로 봄
+//    섹터가 차면 다음 섹터를 지우고 이어 씀 -> 섹터들이 고리(Ring)처럼 돌아가며 고르게 닳음
+//    처음 포맷할 때는 가장 덜 닳은 섹터부터 시작. 섹터 헤더에 지운 횟수를 남겨 두므로 save_report로 확인
+//
+// [2. 비동기 쓰기]
+//    save_write()는 데이터를 복사해 두고 바로 돌아옵니다. 실제 쓰기는 save_update()가
+//    한 번에 SAVE_STEP_BYTES씩, 섹터 지우기는 끝났는지 확인만 하고 돌아오므로 프레임을 막지 않음
+//      지우기 시작 -> (1~2프레임) 지워졌는지 확인 -> 섹터 헤더 -> 레코드 조각들 -> 커밋
+//    쓰는 중에 또 save_write()를 부르면 마지막 것 하나만 기다렸다가 이어서 씀
+//    save_update()는 메인 루프에서 프레임마다 부르거나, VBlank 핸들러에 넣어도 됨 (한 번 = 짧은 조각)
+//    (save_write / save_busy / save_load는 그 경우를 위해 상태를 보거나 고치는 동안 인터럽트를 잠깐 끔:
+//     데이터 복사 시간만큼. save_load는 칩에서 읽는 시간까지)
+//
+// [3. 복구]
+//    save_init()이 모든 섹터를 훑어 커밋된 레코드 중 번호가 가장 큰 것을 찾고, CRC까지 맞으면 채택
+//    (틀리면 그 다음 번호로). 그 레코드 뒤가 깨끗하지 않으면(쓰다 끊긴 흔적) 다음 쓰기는 새 섹터에서
+//
+// [4. 사용 예]
+//    if (save_init(SAVE_FLASH128) < 0) { ... 칩 없음 ... }
+//    int len = save_load(&game, sizeof(game));     // 0 = 새 게임
+//    ...
+//    save_write(&game, sizeof(game));               // 체크포인트
+//    루프: save_update();
+//
+// 호스트 빌드: HOST_SAV / HOST_SAVE_TYPE / HOST_SAVE_CUT (host.h)로 파일 저장, 칩 종류,
+//             전원 차단 지점을 정할 수 있음 (sandbox/save_journal.c 참고)
+// =========================================================================
+
+#define SAVE_SECTOR_SIZE    0x1000  // 4KB (Flash 지우기 단위)
+#define SAVE_MAX_SECTORS    32
+#define SAVE_MAX_DATA       2048    // 레코드 하나의 최대 데이터 크기 (바이트)
+#define SAVE_STEP_BYTES     64      // save_update 한 번에 칩에 쓰는 최대 바이트
+#define SAVE_FILL_BYTES     1024    // SRAM 섹터 비우기(0xFF 채우기) 한 번 분량
+#define SAVE_ERASE_FRAMES   120     // Flash 섹터 지우기 대기 한도 (넘으면 실패)
+
+// 값은 host.h의 HOST_SAVE_xxx와 같음
+typedef enum {
+    SAVE_NONE = 0,
+    SAVE_SRAM,       // 32KB
+    SAVE_FLASH64,    // 64KB
+    SAVE_FLASH128,   // 128KB (뱅크 2개)
+    SAVE_TYPE_COUNT
+} SaveType;
+
+typedef struct {
+    u32 seq;          // 마지막으로 커밋된 레코드 번호 (0 = 없음)
+    u32 commits;      // 이번 실행에서 커밋한 레코드 수
+    u32 bytes;        // 칩에 쓴 바이트 (섹터 헤더 + 레코드)
+    u32 erases;       // 지운 섹터 수
+    u32 latency;      // 마지막 커밋: save_write ~ 커밋까지 save_update 횟수 (= 프레임)
+    u32 latency_max;
+    u32 step_cycles;  // 마지막 save_update 비용 (사이클)
+    u32 step_max;
+    u32 wear_min;     // 섹터별 지운 횟수 최소 / 최대
+    u32 wear_max;
+    u16 errors;       // 쓰기/지우기 실패 (다음 섹터에서 다시 시도)
+    u16 dropped;      // 다시 시도해도 실패해서 버린 요청
+} SaveStats;
+
+// ---------------------------------------------------------
+// 1. 초기화 / 복구
+// ---------------------------------------------------------
+// 칩 확인(Flash는 ID 읽기) + 저널 복구. 반환값: 복구한 데이터 길이 (없으면 0, 칩이 맞지 않으면 -1)
+// SRAM 카트에 Flash 명령을 보내면 데이터가 바뀌므로 type은 카트에 맞게 고정해서 쓸 것
+int  save_init(SaveType type);
+
+// 마지막으로 커밋된 데이터를 dst에 최대 max바이트 복사. 반환값: 레코드 길이 (없으면 0, 쓰는 중이면 -1)
+// 기록이 진행 중이면(지우기 / 헤더 / 레코드 어느 단계든) -1. 읽는 동안 인터럽트를 끔
+int  save_load(void* dst, int max);
+
+// 저널 전체를 지우고 처음부터 (다음 save_write가 가장 덜 닳은 섹터부터 씀). 즉시 실행(블로킹)
+void save_erase_all(void);
+
+// ---------------------------------------------------------
+// 2. 비동기 쓰기
+// ---------------------------------------------------------
+// 데이터를 복사해 두고 바로 반환. len이 0 이하거나 SAVE_MAX_DATA보다 크면 false
+bool save_write(const void* src, int len);
+
+// 프레임마다 한 번 (또는 VBlank 핸들러): 쓰기 상태 기계를 한 조각 진행
+void save_update(void);
+
+// 쓰는 중이거나 기다리는 요청이 있음
+bool save_busy(void);
+
+// ---------------------------------------------------------
+// 3. 통계
+// ---------------------------------------------------------
+const SaveStats* save_stats(void);
+const char*      save_type_name(SaveType type);
+
+// 칩 종류, 커밋 수, 지연(프레임), 조각 비용, 섹터 마모를 로그로 출력 (debug.h)
+void save_report(void);
+
+// ---------------------------------------------------------
+// 4. 버스 접근 (IWRAM, save.c 내부용)
+// ---------------------------------------------------------
+// Flash 명령 중에는 카트 버스를 오래 붙잡으므로 ROM이 아닌 IWRAM에서 실행
+// off = 칩 안의 주소 (Flash는 현재 뱅크 안 0 ~ 0xFFFF)
+IWRAM_CODE void save_bus_read(u32 off, u8* dst, int n);
+IWRAM_CODE void save_bus_write(u32 off, const u8* src, int n);   // SRAM
+IWRAM_CODE void save_flash_cmd(u8 cmd);                          // 0xAA@5555, 0x55@2AAA, cmd@5555
+IWRAM_CODE bool save_flash_program(u32 off, const u8* src, int n); // 바이트마다 0xA0 + 완료 확인
+
+#endif // SAVE_H
@@ -0,0 +1,144 @@
+#ifndef SCHED_H
+#define SCHED_H
+
+#include "gba.h"
+#include "timer.h" // CYCLES_PER_FRAME, 사이클 카운터
+
+// =========================================================================
+// 프레임 예산 협력형 스케줄러 (Protothread 방식 태스크)
+// -------------------------------------------------------------------------
+// main()의 while (1) 안에 입력 -> 갱신 -> 대기 -> 그리기를 순서대로 박아 두면,
+// 압축 풀기 / 맵 스트리밍 / AI 같은 "급하지 않지만 무거운 일"을 끼워 넣을 자리가 없고
+// 한 번에 다 하면 그 프레임만 튀어서(프레임 드랍) 화면이 끊깁니다.
+//
+// [1. 한 프레임 (sched_frame)]
+//    1) 대기 중인 상태 전환 반영 (state.h)          <- 프레임 경계에서만 장면이 바뀜
+//    2) 맨 위 상태의 update + SCHED_CRITICAL 태스크  <- 예산과 관계없이 매 프레임
+//    3) 나머지 태스크를 우선순위 순서로, 예산이 남아 있는 동안 조각(slice)씩 실행
+//    4) vblank_wait()
+//    5) 맨 위 상태의 render                         <- VBlank 안에서 VRAM/OAM 갱신
+//    예산 = "직전 VBlank 직후부터 잰 사이클" 상한 (timer.h 사이클 카운터).
+//    태스크마다 최근 조각 비용을 기억해 두고, 남은 예산보다 크면 그 프레임은 건너뜀(미룸)
+//
+// [2. 태스크 = 스택 없는 코루틴 (protothread)]
+//    switch / case __LINE__로 "어디까지 했는지"만 기억하는 함수입니다.
+//    스택을 따로 두지 않으므로 태스크 하나에 몇 바이트면 되고, 호스트 빌드에서도 그대로 동작.
+//    대신 지역 변수는 양보(YIELD)를 건너 살아남지 않으므로 ctx 구조체에 둘 것.
+//    switch를 쓰므로 TASK_BEGIN ~ TASK_END 안에서 다른 switch로 양보 매크로를 감싸면 안 됨.
+//
+//      static TaskStatus unpack_task(Task* t, void* ctx) {
+//          Unpack* u = ctx;
+//          TASK_BEGIN(t);
+//          while (u->done < u->size) {
+//              unpack_chunk(u, 1024);       // 조각 하나 = 1KB
+//              TASK_YIELD(t);               // 예산이 남았으면 같은 프레임에 다시 불림
+//          }
+//          TASK_END(t);
+//      }
+//      sched_spawn(unpack_task, &unpack, SCHED_LOW, "unpack");
+//
+//    TASK_YIELD        : 조각 하나 끝. 예산이 남으면 이번 프레임에 또 실행
+//    TASK_NEXT_FRAME   : 이번 프레임은 여기까지 (AI처럼 프레임당 한 번이면 되는 일)
+//    TASK_WAIT_FRAMES  : n프레임 쉼
+//    TASK_WAIT_UNTIL   : 조건이 참이 될 때까지 프레임마다 한 번 확인
+//    TASK_END / TASK_EXIT : 끝 (슬롯 반환)
+//
+// [3. 우선순위]
+//    SCHED_CRITICAL : 매 프레임 반드시 한 번 (입력, 게임 로직). 예산을 넘겨도 실행
+//    SCHED_HIGH / SCHED_NORMAL / SCHED_LOW : 예산 안에서 이 순서로
+//    계속 밀린 태스크는 SCHED_AGING 프레임마다 한 단계씩 앞으로 (굶주림 방지)
+// =========================================================================
+
+#define SCHED_MAX_TASKS 16
+#define SCHED_AGING     8                               // 밀린 프레임 수 -> 우선순위 한 단계 상승
+#define SCHED_BUDGET    (CYCLES_PER_FRAME * 7 / 8)      // 기본 예산 (프레임의 7/8, 나머지는 여유)
+
+typedef enum {
+    SCHED_CRITICAL = 0,
+    SCHED_HIGH,
+    SCHED_NORMAL,
+    SCHED_LOW,
+    SCHED_PRIO_COUNT,
+} SchedPrio;
+
+typedef enum {
+    TASK_YIELDED = 0, // 조각 하나 끝, 같은 프레임에 또 실행 가능
+    TASK_WAITING,     // 다음 프레임(또는 wake 프레임)까지 쉼
+    TASK_DONE,        // 끝
+} TaskStatus;
+
+typedef struct Task Task;
+typedef TaskStatus (*TaskFn)(Task* t, void* ctx);
+
+struct Task {
+    TaskFn      fn;
+    void*       ctx;
+    const char* name;
+    u16         pc;        // 재개 위치 (__LINE__), 0 = 처음
+    u8          prio;
+    u8          deferred;  // 예산이 없어 연속으로 밀린 프레임 수
+    u32         wake;      // 이 프레임 번호 전에는 실행하지 않음
+    u32         cost;      // 최근 조각 비용 추정 (사이클, 지수 평균)
+    u32         cycles;    // 이번 통계 구간에 쓴 사이클
+    u16         slices;    // 이번 통계 구간의 조각 수
+    u16         skips;     // 이번 통계 구간에 밀린 프레임 수
+    u16         gen;       // 슬롯을 다시 쓸 때마다 증가 (오래된 핸들 구별)
+};
+
+typedef struct {
+    u32 frames;
+    u32 overruns;    // 예산을 넘긴 프레임 (CRITICAL + 상태 update만으로 넘은 경우 포함)
+    u32 last_used;   // 직전 프레임에서 VBlank 전까지 쓴 사이클
+    u32 peak_used;
+    u32 deferrals;   // 태스크가 예산 때문에 밀린 횟수
+} SchedStats;
+
+// ---------------------------------------------------------
+// 1. 태스크 매크로
+// ---------------------------------------------------------
+#define TASK_BEGIN(t)        switch ((t)->pc) { case 0:
+#define TASK_END(t)          } (t)->pc = 0; return TASK_DONE
+#define TASK_EXIT(t)         do { (t)->pc = 0; return TASK_DONE; } while (0)
+
+#define TASK_YIELD(t) \
+    do { (t)->pc = __LINE__; return TASK_YIELDED; case __LINE__:; } while (0)
+
+#define TASK_NEXT_FRAME(t) \
+    do { (t)->pc = __LINE__; return TASK_WAITING; case __LINE__:; } while (0)
+
+#define TASK_WAIT_FRAMES(t, n) \
+    do { sched_sleep((t), (n)); (t)->pc = __LINE__; return TASK_WAITING; case __LINE__:; } while (0)
+
+#define TASK_WAIT_UNTIL(t, cond) \
+    do { (t)->pc = __LINE__; case __LINE__: if (!(cond)) return TASK_WAITING; } while (0)
+
+// ---------------------------------------------------------
+// 2. 스케줄러
+// ---------------------------------------------------------
+// 태스크 목록 / 통계 초기화 + 사이클 카운터 시작 (PROF_INIT보다 먼저 부를 것)
+void sched_init(void);
+
+// 예산 (사이클, VBlank 직후부터). 0이면 SCHED_BUDGET
+void sched_set_budget(u32 cycles);
+
+// 반환값: 태스크 핸들 = 슬롯 번호 + 세대 (자리가 없으면 -1)
+// 끝난 태스크의 핸들은 슬롯이 다른 태스크에 다시 쓰여도 그 태스크를 가리키지 않음 (kill해도 무시)
+int  sched_spawn(TaskFn fn, void* ctx, SchedPrio prio, const char* name);
+void sched_kill(int id);
+bool sched_alive(int id);
+
+// 한 프레임 (위 1번 순서). 메인 루프는 for (;;) sched_frame();
+void sched_frame(void);
+
+// 이번 프레임 예산 중 남은 사이클 (태스크가 조각 크기를 정할 때)
+u32  sched_remaining(void);
+
+// TASK_WAIT_FRAMES용: n프레임 뒤에 깨움
+void sched_sleep(Task* t, int frames);
+
+const SchedStats* sched_stats(void);
+
+// 태스크별 사이클 / 조각 / 밀린 프레임을 로그로 출력하고 구간 통계 초기화 (최대 사용량은 예산 대비 %)
+void sched_report(void);
+
+#endif // SCHED_H
@@ -0,0 +1,110 @@
+#ifndef SFX_H
+#define SFX_H
+
+#include "gba.h"
+
+// =========================================================================
+// 색 효과: 페이드 / 반투명 / 모자이크 (REG_BLDCNT, REG_BLDALPHA, REG_BLDY, REG_MOSAIC)
+// -------------------------------------------------------------------------
+// 화면을 서서히 어둡게 하려고 Mode 3 픽셀 38,400개를 매 프레임 다시 칠하면 프레임 대부분을 씁니다.
+// 하드웨어는 화면을 내보내면서 색을 섞어 주므로, 레지스터 값 몇 개만 바꾸면 같은 결과가 나옵니다.
+//   밝기   : 첫 번째 대상 레이어를 흰색/검은색 쪽으로 EVY/16만큼 (페이드 인/아웃)
+//   반투명 : 위 레이어 x EVA/16 + 아래 레이어 x EVB/16 (크로스페이드, 유령, 물)
+//   모자이크: BG_MOSAIC / ATTR0_MOSAIC을 켠 레이어를 n+1 픽셀 블록으로 (픽셀라이즈 전환)
+//
+// [1. Shadow + VBlank 반영]
+//    모든 설정은 Shadow 값만 바꾸고, sfx_vblank()가 바뀐 경우에만 레지스터 4개를 한꺼번에 씀.
+//    화면 중간에 계수가 바뀌어 위아래가 다른 밝기로 찢어지는 일이 없음
+//
+// [2. 곡선 (Ramp)]
+//    페이드 / 반투명 / 모자이크는 각각 "from -> to를 frames 프레임 동안" 곡선 하나씩을 가집니다.
+//    sfx_update()가 프레임마다 t(0 ~ 1, 고정소수점)를 진행하고 곡선 모양을 적용해 정수 계수로 반올림:
+//      SFX_LINEAR   : t
+//      SFX_EASE_IN  : t^2            (천천히 시작 - 페이드 아웃에 자연스러움)
+//      SFX_EASE_OUT : 1 - (1 - t)^2  (천천히 끝남 - 페이드 인)
+//      SFX_SMOOTH   : 3t^2 - 2t^3    (양쪽 모두 부드럽게 - 모자이크 왕복)
+//    나눗셈은 시작할 때 한 번(1/frames)뿐이고, 프레임마다 곱셈 몇 번이면 끝납니다.
+//
+// [3. 주의]
+//    - 밝기와 반투명은 REG_BLDCNT 하나를 같이 쓰므로 동시에 쓸 수 없음 (나중에 설정한 쪽이 이김)
+//      단, 반투명 OBJ(ATTR0_BLEND)는 밝기 모드에서도 반투명으로 그려짐
+//    - 비트맵 모드(3/4/5)의 화면은 BG2 한 장이므로 BLD_BG(2), 뒤에 보이는 것은 배경색(BLD_BD)
+//
+// [4. 사용 예]
+//    sfx_fade_out(BLD_BLACK, 30);                  // 화면 전환: 어둡게
+//    while (sfx_busy()) { vblank_wait(); sfx_vblank(); sfx_update(); }
+//    load_next_scene();
+//    sfx_fade_in(BLD_BLACK, 30);                   // 다시 밝게 (다음 장면을 그리는 동안 진행)
+//
+//    루프: vblank_wait(); sfx_vblank(); ... sfx_update(); ...
+// =========================================================================
+
+#define SFX_EV_MAX     16 // EVA / EVB / EVY 최댓값 (= 1.0)
+#define SFX_MOSAIC_MAX 15 // 모자이크 값 최댓값 (16픽셀 블록)
+
+typedef enum {
+    SFX_LINEAR = 0,
+    SFX_EASE_IN,
+    SFX_EASE_OUT,
+    SFX_SMOOTH,
+} SfxCurve;
+
+typedef struct {
+    u32 reg_writes;  // sfx_vblank가 쓴 레지스터 수 (누적)
+    u32 applies;     // 레지스터를 실제로 다시 쓴 VBlank 수
+    u32 updates;     // sfx_update 호출 수
+} SfxStats;
+
+// ---------------------------------------------------------
+// 1. 프레임
+// ---------------------------------------------------------
+// 효과 모두 끄기 (다음 sfx_vblank에 반영)
+void sfx_init(void);
+
+// 프레임마다 한 번: 진행 중인 곡선을 한 칸 진행하고 Shadow 갱신
+void sfx_update(void);
+
+// VBlank 핸들러 또는 vblank_wait 직후: Shadow가 바뀌었으면 레지스터 4개를 씀
+void sfx_vblank(void);
+
+// 진행 중인 곡선이 있음
+bool sfx_busy(void);
+
+// ---------------------------------------------------------
+// 2. 밝기 (페이드)
+// ---------------------------------------------------------
+// layers(BLD_BG(n) | BLD_OBJ | BLD_BD)를 mode(BLD_WHITE / BLD_BLACK) 쪽으로 EVY from -> to (0 ~ 16)
+void sfx_fade(u16 layers, u16 mode, int from, int to, int frames, SfxCurve curve);
+
+// 화면 전체를 흰색/검은색으로 사라지게 / 나타나게
+static inline void sfx_fade_out(u16 mode, int frames) {
+    sfx_fade(BLD_ALL, mode, 0, SFX_EV_MAX, frames, SFX_EASE_IN);
+}
+static inline void sfx_fade_in(u16 mode, int frames) {
+    sfx_fade(BLD_ALL, mode, SFX_EV_MAX, 0, frames, SFX_EASE_OUT);
+}
+
+// ---------------------------------------------------------
+// 3. 반투명
+// ---------------------------------------------------------
+// top 레이어를 bottom 레이어 위에 EVA / EVB (0 ~ 16)로 섞기 (즉시)
+void sfx_alpha(u16 top, u16 bottom, int eva, int evb);
+
+// 현재 계수에서 (eva, evb)까지 frames 동안. 크로스페이드는 (16, 0) -> (0, 16)처럼 합을 16으로
+void sfx_alpha_ramp(int eva, int evb, int frames, SfxCurve curve);
+
+// ---------------------------------------------------------
+// 4. 모자이크
+// ---------------------------------------------------------
+// BG / OBJ 모자이크 값 (0 = 끔, 15 = 16픽셀 블록). 가로세로 같은 크기. 즉시
+void sfx_mosaic(int bg, int obj);
+
+// 현재 값에서 (bg, obj)까지 frames 동안
+void sfx_mosaic_ramp(int bg, int obj, int frames, SfxCurve curve);
+
+// ---------------------------------------------------------
+// 5. 통계
+// ---------------------------------------------------------
+const SfxStats* sfx_stats(void);
+
+#endif // SFX_H
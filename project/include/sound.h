@@ -0,0 +1,123 @@
+#ifndef SOUND_H
+#define SOUND_H
+
+#include "gba.h"
+#include "fixed.h"
+
+// =========================================================================
+// 사운드 믹서 (Direct Sound A/B + Timer0 + DMA1/DMA2)
+// -------------------------------------------------------------------------
+// GBA의 Direct Sound는 "8비트 샘플을 FIFO에 넣으면 타이머 속도로 재생"하는 장치뿐입니다.
+// 효과음/음악 여러 개를 동시에 내려면 CPU가 채널들을 하나의 파형으로 섞어(Mix) 줘야 합니다.
+//
+// [1. 재생 경로]
+//    Timer0 주기(924 사이클 = 18157Hz)마다 FIFO A/B에서 1바이트씩 재생
+//    FIFO가 절반 비면 DMA1(A) / DMA2(B)가 버퍼에서 4워드를 가져옴 (DMA_AT_SPECIAL)
+//    CPU는 전혀 관여하지 않음
+//
+// [2. 프레임 동기 이중 버퍼]
+//    280896 / 924 = 304 이므로 한 프레임에 정확히 304샘플이 재생됩니다.
+//    그래서 버퍼 한 벌 = 304샘플로 두면, VBlank마다
+//      sound_vblank() : 다 채운 버퍼로 DMA를 다시 걸기 (짧음, VBlank 핸들러 맨 앞)
+//      sound_update() : 반대쪽 버퍼를 다음 프레임 분량으로 믹싱 (메인 루프, vblank_wait 직후)
+//    를 반복하는 것만으로 끊김 없이 이어집니다. update가 한 프레임을 놓치면 방금 버퍼를 한 번 더 재생(late).
+//
+// [3. 믹서 (src/sound.iwram.c, IWRAM ARM)]
+//    채널(voice)마다: 위치(Q12) += 속도(Q12)  -> 샘플 * 볼륨을 32비트 누적 버퍼에 더함
+//    반복 지점/끝까지의 샘플 수를 미리 나눠 두므로 안쪽 루프에는 분기가 없고,
+//    비용 = 고정 비용(클리핑) + 채널 수 x 채널당 비용 으로 일정하게 늘어납니다. (sound_report)
+//    볼륨 64 = 원래 크기. 합이 8비트를 넘으면 잘림(클리핑)
+//
+// [4. DMA 채널]
+//    스테레오: A = 왼쪽(DMA1), B = 오른쪽(DMA2). 모노: A만 양쪽으로, DMA2는 비어 있음
+//    raster.h의 두 번째 채널도 DMA2를 쓰므로 서로 확인합니다.
+//    스캔라인 채널이 이미 DMA2를 잡고 있으면 sound_init(true)는 경고를 남기고 모노로 시작하고,
+//    스테레오로 돌고 있으면 raster_open은 두 번째 채널을 열지 않습니다(-1).
+//
+// [5. 사용 예]
+//    sound_init(true);
+//    VBlank 핸들러: sound_vblank(); ...
+//    int v = sound_play(&jump_sfx, 64, SOUND_PAN_CENTER, FIX_ONE);
+//    루프: vblank_wait(); sound_update(); ...
+//
+// 호스트 빌드: HOST_WAV=out.wav 로 실행하면 FIFO에서 재생된 결과가 WAV로 저장됩니다. (host.h)
+// =========================================================================
+
+#define SOUND_TIMER_PERIOD  924                                 // 사이클 / 샘플
+#define SOUND_RATE          (16777216 / SOUND_TIMER_PERIOD)     // 18157Hz
+#define SOUND_BUF_LEN       (280896 / SOUND_TIMER_PERIOD)       // 304 = 한 프레임
+#define SOUND_VOICES        8
+
+#define SOUND_POS_SHIFT     12          // 재생 위치 / 속도의 소수부 비트
+#define SOUND_NO_LOOP       0xFFFFFFFFu
+#define SOUND_VOL_MAX       64
+#define SOUND_PAN_LEFT      0
+#define SOUND_PAN_CENTER    64
+#define SOUND_PAN_RIGHT     128
+
+typedef struct {
+    const s8* data;
+    u32       length;     // 샘플 수 (2^20 미만)
+    u32       loop_start; // 끝에 닿으면 돌아갈 위치 (SOUND_NO_LOOP = 한 번만)
+    u32       rate;       // 녹음된 샘플레이트 (Hz). pitch FIX_ONE일 때 이 속도로 재생
+} SoundSample;
+
+typedef struct {
+    u32 mix_cycles;  // 마지막 sound_update의 믹싱 비용
+    u32 mix_max;     // 지금까지 최댓값
+    u16 voices;      // 마지막 믹싱에서 재생 중이던 채널 수
+    u16 late;        // 믹싱이 늦어 같은 버퍼를 다시 재생한 횟수
+    u32 frames;      // 믹싱한 프레임 수
+} SoundStats;
+
+// ---------------------------------------------------------
+// 1. 초기화 / 프레임
+// ---------------------------------------------------------
+// stereo = false면 FIFO A만 양쪽 스피커로 (DMA2 사용 안 함)
+// DMA2가 raster 채널에 쓰이고 있으면 stereo = true여도 모노 (LOG_WARN)
+void sound_init(bool stereo);
+
+// DMA 채널 ch를 사운드가 쓰고 있는지 (raster_open이 확인)
+bool sound_uses_dma(int ch);
+
+// VBlank 핸들러 맨 앞에서 호출: 채워 둔 버퍼로 DMA 재시작
+void sound_vblank(void);
+
+// 프레임마다 한 번 (vblank_wait 직후): 다음 버퍼 믹싱. 이미 채워져 있으면 아무 일도 안 함
+void sound_update(void);
+
+// ---------------------------------------------------------
+// 2. 채널
+// ---------------------------------------------------------
+// 빈 채널에서 재생 시작. vol 0 ~ 64, pan 0(왼쪽) ~ 128(오른쪽), pitch FIX_ONE = 원래 높이 (최대 8.0)
+// 반환값: 채널 번호 (빈 채널이 없으면 -1)
+int  sound_play(const SoundSample* s, int vol, int pan, fixed pitch);
+void sound_stop(int voice);
+void sound_set_volume(int voice, int vol, int pan);
+void sound_set_pitch(int voice, fixed pitch);
+bool sound_playing(int voice);
+
+// ---------------------------------------------------------
+// 3. 비용
+// ---------------------------------------------------------
+const SoundStats* sound_stats(void);
+
+// 믹싱 비용(사이클, 프레임 대비 %)과 채널 수를 로그로 출력 (debug.h)
+void sound_report(void);
+
+// 마지막 sound_update가 만든 8비트 버퍼 (SOUND_BUF_LEN개). right = FIFO B, 모노면 양쪽 모두 FIFO A
+// 파형 표시 / 검사용. 다음 sound_update까지만 유효
+const s8* sound_last_mix(bool right);
+
+// ---------------------------------------------------------
+// 4. 믹서 커널 (IWRAM, sound.c 내부용)
+// ---------------------------------------------------------
+// acc에 n샘플을 더하고 진행한 위치를 반환. 스테레오 acc = L, R 교대 / 모노 acc = 샘플마다 1칸
+IWRAM_CODE u32  sound_mix_stereo(s32* acc, int n, const s8* data, u32 pos, u32 inc, int vl, int vr);
+IWRAM_CODE u32  sound_mix_mono(s32* acc, int n, const s8* data, u32 pos, u32 inc, int vol);
+
+// 누적 버퍼 -> 8비트 (볼륨 64 = 1.0, 범위 밖은 잘림) + 누적 버퍼 비우기
+IWRAM_CODE void sound_clip_stereo(s8* out_l, s8* out_r, s32* acc, int n);
+IWRAM_CODE void sound_clip_mono(s8* out, s32* acc, int n);
+
+#endif // SOUND_H
@@ -0,0 +1,40 @@
+#ifndef SPAN_H
+#define SPAN_H
+
+#include "gba.h"
+
+// =========================================================================
+// IWRAM 스팬 커널 (16비트 픽셀 채우기, ARM 모드)
+// -------------------------------------------------------------------------
+// draw.c의 모든 도형은 결국 "가로줄 채우기"로 끝나므로, 그 가장 안쪽 루프만
+// src/span.iwram.c에 모아 IWRAM에서 ARM 명령어로 실행합니다. (gba.h 8절의 파일 단위 배치)
+//  - ROM Thumb: 명령어 하나 가져올 때마다 16비트 버스 + 대기 상태
+//  - IWRAM ARM: 32비트 버스, 대기 0, 레지스터 8개로 stmia 한 번에 8워드
+//
+// 클리핑은 호출하는 쪽(draw.c)에서 끝내고 넘겨야 합니다. (len >= 1, rows >= 1)
+// Mode 4는 픽셀 쌍(u16) 단위로 바꿔서 넘기면 같은 커널을 씁니다.
+//
+// 다각형 채우기는 줄마다 draw.c로 돌아오지 않도록 왼쪽/오른쪽 변의 x를
+// 커널 안에서 한 줄씩 진행합니다. (변이 바뀌는 꼭짓점에서만 호출이 끝남)
+// =========================================================================
+
+// 다각형의 왼쪽/오른쪽 변 (Q16.16, 줄 중심 기준으로 이미 0.5픽셀 뺀 값)
+// 줄의 픽셀 = [ceil(xl), ceil(xr))  -> 왼쪽 변은 포함, 오른쪽 변은 제외 (top-left 규칙)
+typedef struct {
+    s32 xl, dxl;
+    s32 xr, dxr;
+} SpanEdges;
+
+// p부터 len개의 u16을 color로 채움
+IWRAM_CODE void span_fill16(u16* p, int len, u16 color);
+
+// row부터 pitch(u16 단위) 간격으로 rows줄, 줄마다 len개를 채움 (사각형 내부)
+// 줄 루프까지 IWRAM 안에서 돌아서 호출은 사각형당 한 번
+IWRAM_CODE void span_fill_rows16(u16* row, int pitch, int len, int rows, u16 color);
+
+// row부터 rows줄을 변 e 사이로 채우고, e를 rows줄만큼 진행시켜 둠 (다음 구간에서 이어 씀)
+// x는 [0, width)로 잘림. 8 = Mode 4 (color = 팔레트 인덱스, 픽셀 쌍 단위), 16 = Mode 3/5
+IWRAM_CODE void span_fill_edges8(u16* row, int pitch, int rows, int width, SpanEdges* e, u16 color);
+IWRAM_CODE void span_fill_edges16(u16* row, int pitch, int rows, int width, SpanEdges* e, u16 color);
+
+#endif // SPAN_H
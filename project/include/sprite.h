@@ -0,0 +1,98 @@
+#ifndef SPRITE_H
+#define SPRITE_H
+
+#include "gba.h"
+
+// =========================================================================
+// 스프라이트 배칭 (Shadow OAM + VBlank DMA)
+// -------------------------------------------------------------------------
+// GBA의 하드웨어 스프라이트 128개는 OAM(1KB)에 적힌 속성대로 매 줄 그려집니다.
+// 하지만 OAM을 VDraw 중에 직접 고치면 반쯤 바뀐 상태가 화면에 보이고, 접근도 느립니다.
+// CS200의 BatchRenderer처럼 'RAM에 쌓았다가 한 번에 전송(Flush)'하는 구조로 만듭니다.
+//
+// [1. 프레임 흐름]
+//    sprite_begin();                  // 배치 비우기
+//    sprite_add(x, y, ...) x N;       // 월드 좌표로 추가 (화면 밖이면 여기서 버림)
+//    sprite_end();                    // 정렬 -> Shadow OAM 작성 -> 전송 예약
+//    (VBlank 인터럽트) sprite_vblank(); // DMA3 한 번으로 1KB 통째로 OAM에 복사
+//
+// [2. 정렬 (버킷 정렬, 한 번 훑기)]
+//    OAM은 번호가 작을수록 위에 그려지지만, BG 우선순위(attr2)가 섞이면 순서가 꼬입니다.
+//    그래서 키 = BG 우선순위(0~3) x 4 + layer(0~3), 총 16개 버킷에
+//    추가되는 순간 연결 리스트로 매달고(꼬리 삽입 = 같은 키는 추가 순서 유지),
+//    end에서 버킷 0부터 차례로 꺼내 씁니다. 비교 정렬 없이 O(N + 16).
+//
+// [3. 고정 슬롯 (HUD, 아핀 스프라이트 등)]
+//    sprite_alloc으로 예약한 OAM 번호는 배치가 건드리지 않습니다.
+//    예약 슬롯은 앞 번호부터 나가므로 배치된 스프라이트보다 위에 그려집니다.
+//
+// [4. 전송 타이밍]
+//    sprite_end가 Shadow를 쓰는 도중에 VBlank가 오면 이번 전송은 건너뛰고
+//    이전 프레임 내용을 유지합니다. (반쯤 쓴 테이블이 보이는 것 방지)
+//    irq_set(IRQ_VBLANK, sprite_vblank)로 등록하거나, 다른 VBlank 핸들러 안에서 호출하세요.
+//
+// REG_DISPCNT에 DCNT_OBJ(| DCNT_OBJ_1D)를 켜야 화면에 나타납니다.
+// 비트맵 모드(3/4/5)에서는 OBJ 타일 512번 이후만 쓸 수 있습니다.
+// =========================================================================
+
+#define SPRITE_MAX      128
+#define SPRITE_LAYERS   4  // BG 우선순위 안에서의 세부 순서 (0 = 맨 앞)
+#define SPRITE_BUCKETS  (4 * SPRITE_LAYERS)
+
+// 크기 = 모양(attr0) x 4 + 크기(attr1)
+typedef enum {
+    SPR_8x8   = 0,  SPR_16x16 = 1,  SPR_32x32 = 2,  SPR_64x64 = 3,  // 정사각형
+    SPR_16x8  = 4,  SPR_32x8  = 5,  SPR_32x16 = 6,  SPR_64x32 = 7,  // 가로로 긴
+    SPR_8x16  = 8,  SPR_8x32  = 9,  SPR_16x32 = 10, SPR_32x64 = 11, // 세로로 긴
+} SpriteSize;
+
+typedef struct {
+    u16 submitted; // sprite_add 호출 수
+    u16 culled;    // 화면 밖이라 버린 수
+    u16 dropped;   // 슬롯이 모자라 버린 수 (버킷 뒤쪽 = 우선순위 낮은 것부터)
+    u16 visible;   // 이번 프레임에 OAM에 들어간 수 (고정 슬롯 제외)
+} SpriteStats;
+
+// Shadow OAM을 모두 숨김 상태로 초기화하고 즉시 OAM에 복사
+void sprite_init(void);
+
+// 월드 -> 화면 변환용 카메라 위치 (sprite_add 좌표에서 빼줌)
+void sprite_set_camera(int x, int y);
+
+// ---------------------------------------------------------
+// 배치 (매 프레임)
+// ---------------------------------------------------------
+void sprite_begin(void);
+
+// attr2: ATTR2_TILE | ATTR2_PRIO | ATTR2_PALBANK,  flip: ATTR1_HFLIP | ATTR1_VFLIP
+// 반환값: 배치에 들어갔으면 true (화면 밖이거나 배치가 가득 차면 false)
+bool sprite_add(int x, int y, SpriteSize size, u16 attr2, u16 flip, int layer);
+
+// 아핀 스프라이트: (cx, cy) = 월드 좌표 중심, matrix = 아핀 행렬 번호 0 ~ 31 (affine.h)
+// dbl = true면 그리는 영역이 2배 (회전한 모서리가 잘리지 않음, 대신 슬롯당 픽셀 처리량 증가)
+bool sprite_add_affine(int cx, int cy, SpriteSize size, u16 attr2, int matrix, bool dbl, int layer);
+
+// 아핀 행렬 matrix(0 ~ 31)를 Shadow OAM에 기록 (8.8, 화면 -> 텍스처 역변환)
+// 행렬 k는 스프라이트 4k ~ 4k+3의 attr3 자리에 흩어져 있으며, 다음 sprite_end 전송에 함께 나감
+void sprite_set_matrix(int matrix, s16 pa, s16 pb, s16 pc, s16 pd);
+
+// 정렬 후 Shadow OAM 작성, 남는 슬롯은 숨김. 다음 VBlank에 전송됨
+void sprite_end(void);
+
+// VBlank 인터럽트 핸들러: 준비된 Shadow OAM을 DMA3로 OAM에 복사
+void sprite_vblank(void);
+
+const SpriteStats* sprite_stats(void);
+
+// ---------------------------------------------------------
+// 고정 슬롯
+// ---------------------------------------------------------
+// 반환값: 예약한 OAM 번호 (남은 슬롯이 없으면 -1). 처음엔 숨김 상태
+int  sprite_alloc(void);
+void sprite_free(int slot);
+
+// 고정 슬롯 내용 (화면 좌표, 컬링 없음). 다음 sprite_end 때 함께 전송됨
+void sprite_set(int slot, int x, int y, SpriteSize size, u16 attr2, u16 flip);
+void sprite_hide(int slot);
+
+#endif // SPRITE_H
@@ -0,0 +1,83 @@
+#ifndef STATE_H
+#define STATE_H
+
+#include "gba.h"
+
+// =========================================================================
+// 게임 상태 관리 (State Stack + 미리 잡아 둔 아레나)
+// -------------------------------------------------------------------------
+// 타이틀 -> 게임 -> 일시정지 -> 게임 ... 처럼 장면이 바뀔 때마다 malloc/free를 하면
+// 조각난 힙에서 자리를 찾느라 그 프레임만 느려지고, 결국 자리가 없어 실패할 수도 있습니다.
+//
+// [1. 상태 스택]
+//    맨 위 상태만 update / render를 받습니다. (아래 상태도 그리려면 STATE_RENDER_BELOW)
+//    push: 일시정지 메뉴처럼 위에 잠깐 올림 (아래 상태의 메모리는 그대로 유지)
+//    pop : 위 상태를 닫고 아래 상태로 복귀
+//    switch: pop + push (타이틀 -> 게임)
+//    요청은 큐에 넣어 두고, 다음 프레임 시작(sched_frame의 첫 단계)에 한꺼번에 반영합니다.
+//    -> update 도중 자기 자신을 pop해도 안전, 한 프레임 안에서 장면이 반쯤 바뀌는 일이 없음
+//
+// [2. 아레나 (스택 할당기)]
+//    STATE_ARENA_SIZE 바이트를 EWRAM에 한 번 잡아 두고, push할 때 상태의 size만큼 위로 올리고
+//    pop할 때 push 직전 위치로 되돌립니다. 할당/해제 = 포인터 하나, 조각화 없음.
+//    enter()에서 state_alloc()으로 더 받은 메모리(압축 해제 버퍼 등)도 pop 때 같이 돌아갑니다.
+//    새 메모리는 0으로 채워서 넘김 (mem_fill32, 바이트 수에 비례하는 고정 비용)
+//
+// [3. 사용 예]
+//    static void play_enter(void* mem)  { Play* p = mem; ... }
+//    static void play_update(void* mem) { ... if (key_hit(KEY_START)) state_push(&pause_state); }
+//    const GameState play_state = { "play", sizeof(Play), play_enter, NULL, play_update, play_render, 0 };
+//
+//    state_push(&play_state);
+//    for (;;) sched_frame();
+// =========================================================================
+
+#define STATE_MAX_DEPTH   4
+#define STATE_MAX_PENDING 4
+#define STATE_ARENA_SIZE  (32 * 1024)
+
+#define STATE_RENDER_BELOW 0x01 // 아래 상태도 먼저 그림 (반투명 메뉴 등)
+#define STATE_UPDATE_BELOW 0x02 // 아래 상태도 update (배경에서 계속 움직이는 장면)
+
+typedef struct {
+    const char* name;
+    u32         size;                // push할 때 아레나에서 받을 바이트 (0으로 채워짐)
+    void (*enter)(void* mem);        // NULL 가능
+    void (*leave)(void* mem);        // NULL 가능 (pop 직전)
+    void (*update)(void* mem);       // 맨 위일 때 매 프레임, VBlank 전
+    void (*render)(void* mem);       // 맨 위일 때 매 프레임, VBlank 직후
+    u8          flags;
+} GameState;
+
+typedef struct {
+    u32 transitions;  // 반영한 push / pop 수
+    u32 last_cycles;  // 마지막 전환 프레임에서 전환에 쓴 사이클 (leave + 0 채우기 + enter)
+    u32 peak_cycles;
+    u32 arena_used;   // 지금 사용 중 (바이트)
+    u32 arena_peak;
+    u32 failures;     // 아레나 / 스택 / 큐가 모자라 버린 요청
+} StateStats;
+
+// 스택과 아레나 비우기
+void state_init(void);
+
+// 전환 요청 (다음 state_apply에서 반영)
+void state_push(const GameState* s);
+void state_pop(void);
+void state_switch(const GameState* s);
+
+// 대기 중인 요청 반영. 반환값: 바뀐 것이 있으면 true (sched_frame이 부름)
+bool state_apply(void);
+
+// 맨 위 상태의 update / render (플래그에 따라 아래 상태 포함)
+void state_update(void);
+void state_render(void);
+
+// enter() 안에서 추가 메모리 (4바이트 정렬, 0으로 채움). 모자라면 NULL
+void* state_alloc(u32 bytes);
+
+const GameState* state_top(void);
+int              state_depth(void);
+const StateStats* state_stats(void);
+
+#endif // STATE_H
@@ -0,0 +1,126 @@
+#ifndef TEXT_H
+#define TEXT_H
+
+#include <stdarg.h>
+
+#include "gba.h"
+
+// =========================================================================
+// 글자 출력: 타일 배경 한 장 + 가변폭 ROM 글꼴 + 칸 단위 타일 캐시
+// -------------------------------------------------------------------------
+// Mode 3 VRAM에 글자를 픽셀로 찍으면 숫자 하나 바꿀 때도 지우고 다시 칠해야 합니다.
+// 대신 글자 전용 타일 배경(4bpp)을 하나 두고, 맵 칸(8x8)마다 "그 칸에 보이는 그림" 타일을 가리킵니다.
+//
+// [1. 가변폭 글자 -> 칸 타일]
+//    글자 폭이 제각각(2 ~ 6픽셀)이라 한 칸에 글자 여러 개가 걸치고, 글자 하나가 두 칸에 걸칩니다.
+//    칸의 그림은 "칸 왼쪽 끝 기준 첫 글자의 x(-7 ~ 0) + 이어지는 글자들(최대 6개)"로 완전히 정해지므로
+//    이 8바이트를 키로 삼아 타일을 만들고 캐시합니다.
+//      "SCORE 0100" 같은 문자열은 칸 10개 남짓 = 키 10개
+//      같은 키(빈 칸, 같은 위치의 같은 숫자 등)는 화면 어디서든 타일 하나를 같이 씀
+//    빈 칸(공백뿐)은 항상 타일 0 (투명)
+//
+// [2. 캐시 (캐릭터 블록 하나 = 타일 512개, LRU)]
+//    타일마다 "맵에서 가리키는 칸 수(참조)"를 세고, 참조가 0이 된 타일은 LRU 목록 끝에 붙입니다.
+//    새 키가 필요하면 해시에서 찾고(적중 = 맵 칸 2바이트만 씀),
+//    없으면 LRU 목록 맨 앞(가장 오래 안 쓴) 타일에 그려서 32바이트 올림.
+//    화면에 보이는 타일은 참조가 있어 절대 덮어쓰지 않으므로, VDraw 중에 불러도 찢어지지 않습니다.
+//
+// [3. 문자열 비교로 바뀐 칸만]
+//    필드(한 줄)마다 직전 문자열을 기억해 두고, 앞뒤로 같은 부분을 잘라냅니다.
+//      가운데 바뀐 부분의 폭이 같으면 (예: 고정폭 숫자 "0099" -> "0100") 그 픽셀 구간만
+//      폭이 다르면 바뀐 곳부터 줄 끝까지 (뒤 글자들이 밀리므로)
+//    그 구간에 걸친 칸만 키를 다시 계산하고, 키가 같은 칸은 건너뜁니다.
+//    -> 60Hz로 바뀌는 카운터 하나 = 칸 1 ~ 2개 = 맵 2 ~ 4바이트 (+ 캐시에 없을 때만 타일 32바이트)
+//
+// [4. 글꼴]
+//    ASCII 0x20 ~ 0x7E, 높이 8 (대문자 6줄, 아래로 빠지는 글자 1줄), 폭 = 글자 + 빈칸 1픽셀.
+//    숫자는 모두 같은 폭(5)이라 카운터가 좌우로 흔들리지 않음. 범위 밖 문자는 '?'
+//
+// [5. 서식 (정수 연산만)]
+//    txt_printf / txt_format: %d %i %u %x %X %c %s %% + 플래그 '-' '0', 폭, 정밀도, 'l'
+//    %f는 fixed(Q24.8, fixed.h) 값: 소수부를 10씩 곱해 자릿수를 뽑음 (정밀도 기본 2, 최대 4)
+//      다른 Q 포맷은 fx.h 변환으로 fixed로 바꿔서 넘길 것
+//    10으로 나누기는 역수 곱셈(x * 0xCCCCCCCD >> 35)이라 나눗셈 루틴을 부르지 않습니다.
+//
+// [6. 사용 예]
+//    REG_DISPCNT = MODE_0 | BG0_ENABLE;
+//    txt_init(0, bg_alloc_charblock(), bg_alloc_screenblocks(1), BG_PRIO(0));
+//    txt_color(0, COLOR_WHITE);
+//    txt_field_init(&hud, 1, 1, 12, 0);               // 맵 칸 (1, 1)부터 12칸, 팔레트 뱅크 0
+//    루프: txt_printf(&hud, "HP %3d  X %.1f", hp, ent.x[p]);
+//
+//    같은 맵 칸을 필드 두 개가 겹쳐 쓰면 안 됨. 필드 폭을 넘는 글자는 잘림
+// =========================================================================
+
+#define TXT_FIELD_MAX    64  // 필드 하나의 최대 글자 수
+#define TXT_COLS_MAX     32  // 필드 하나의 최대 폭 (칸, 맵 한 줄)
+#define TXT_CELL_GLYPHS  6   // 칸 하나에 걸칠 수 있는 글자 수 (최소 폭 2픽셀 -> 실제로는 5)
+#define TXT_POOL_TILES   512 // 4bpp 캐릭터 블록 하나 (0번은 빈 타일)
+#define TXT_INK          1   // 글자 픽셀의 팔레트 번호 (뱅크 안에서)
+
+#define TXT_FONT_FIRST   0x20
+#define TXT_FONT_COUNT   95
+
+// 글꼴 (src/font.c): 한 줄 = 1바이트, 비트 0이 왼쪽 픽셀 / 폭은 빈칸 1픽셀 포함
+extern const u8 txt_font_bits[TXT_FONT_COUNT][8];
+extern const u8 txt_font_width[TXT_FONT_COUNT];
+
+typedef struct {
+    u8   tx, ty;                       // 맵 칸 좌표 (왼쪽 끝)
+    u8   cols;                         // 폭 (칸)
+    u8   pal;                          // 팔레트 뱅크
+    u8   len;
+    char text[TXT_FIELD_MAX + 1];      // 지금 화면에 있는 문자열
+    u16  cell[TXT_COLS_MAX];           // 칸마다 쓰고 있는 타일 (0 = 빈 칸)
+} TextField;
+
+typedef struct {
+    u32 hits;        // 캐시에 있던 칸 (맵만 씀)
+    u32 uploads;     // 새로 그려 올린 타일 수
+    u32 evictions;   // 참조 없는 타일을 다른 키로 재사용한 수
+    u32 overflows;   // 타일이 모자라 빈 칸으로 둔 수 (화면에 보이는 칸이 512종류를 넘음)
+    u32 map_writes;  // 맵 칸 쓰기 수
+    u32 vram_bytes;  // VRAM에 쓴 바이트 (타일 32 + 맵 2, 누적)
+    u16 used;        // 참조가 있는 타일 수
+} TextStats;
+
+// ---------------------------------------------------------
+// 1. 초기화
+// ---------------------------------------------------------
+// bg를 4bpp 32x32 글자 배경으로 설정 (flags = BG_PRIO 등). 맵은 모두 빈 칸, 캐시 비움
+void txt_init(int bg, int cbb, int sbb, u16 flags);
+
+// 팔레트 뱅크 pal의 글자 색 (PAL_BG[pal * 16 + TXT_INK])
+void txt_color(int pal, u16 color);
+
+// ---------------------------------------------------------
+// 2. 필드 (한 줄)
+// ---------------------------------------------------------
+// 맵 칸 (tx, ty)부터 cols칸을 빈 문자열로
+void txt_field_init(TextField* f, int tx, int ty, int cols, int pal);
+
+// 문자열 출력: 직전 문자열과 비교해 바뀐 칸만 다시 씀
+void txt_print(TextField* f, const char* s);
+
+// 서식 출력 (위 5번). 반환값: 출력한 글자 수
+int  txt_printf(TextField* f, const char* fmt, ...);
+
+// 팔레트 뱅크 바꾸기 (모든 칸의 맵만 다시 씀, 타일은 그대로)
+void txt_field_color(TextField* f, int pal);
+
+// 필드를 빈 칸으로 하고 쓰던 타일 참조를 돌려줌
+void txt_field_clear(TextField* f);
+
+// ---------------------------------------------------------
+// 3. 서식 / 측정
+// ---------------------------------------------------------
+// snprintf와 같은 규칙 (항상 널 종료, 잘려도 size - 1까지). 반환값: 쓴 글자 수
+int  txt_format(char* buf, int size, const char* fmt, ...);
+int  txt_vformat(char* buf, int size, const char* fmt, va_list args);
+
+// 문자열 폭 (픽셀)
+int  txt_width(const char* s);
+
+const TextStats* txt_stats(void);
+
+#endif // TEXT_H
@@ -0,0 +1,60 @@
+#ifndef TIMER_H
+#define TIMER_H
+
+#include "gba.h"
+
+// =========================================================================
+// 사이클 카운터 (Cycle Counter)
+// -------------------------------------------------------------------------
+// 타이머 하나는 16비트라 65536 사이클(약 3.9ms)이면 넘쳐버립니다.
+// TM2를 1클럭마다 증가시키고, TM3을 캐스케이드로 연결하면
+// TM2가 넘칠 때마다 TM3이 1씩 올라가서 합쳐서 32비트 카운터가 됩니다. (약 256초)
+//
+// 사용법:
+//   cycle_counter_start();
+//   ... 측정할 코드 ...
+//   u32 cycles = cycle_counter_read();
+//
+// 호스트 빌드에서는 clock_gettime 경과 시간을 16.78MHz 클럭으로 환산합니다.
+// =========================================================================
+
+#define CYCLES_PER_FRAME  280896 // 228줄 * 1232 사이클
+#define CYCLES_PER_LINE   1232
+
+#ifdef GBA_HOST
+
+static u32 cycle_counter_base __attribute__((unused));
+
+static inline void cycle_counter_start(void) {
+    cycle_counter_base = host_cycles();
+}
+
+static inline u32 cycle_counter_read(void) {
+    return host_cycles() - cycle_counter_base;
+}
+
+#else
+
+static inline void cycle_counter_start(void) {
+    REG_TM_CNT_H(2) = 0;
+    REG_TM_CNT_H(3) = 0;
+    REG_TM_CNT_L(2) = 0;
+    REG_TM_CNT_L(3) = 0;
+    REG_TM_CNT_H(3) = TM_ENABLE | TM_CASCADE;
+    REG_TM_CNT_H(2) = TM_ENABLE | TM_FREQ_1;
+}
+
+// 상위/하위를 따로 읽는 사이에 하위가 넘칠 수 있으므로
+// 상위 값이 바뀌지 않을 때까지 다시 읽음
+static inline u32 cycle_counter_read(void) {
+    u16 hi, lo;
+    do {
+        hi = REG_TM_CNT_L(3);
+        lo = REG_TM_CNT_L(2);
+    } while (hi != REG_TM_CNT_L(3));
+    return ((u32)hi << 16) | lo;
+}
+
+#endif // GBA_HOST
+
+#endif // TIMER_H
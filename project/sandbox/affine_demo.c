@@ -0,0 +1,199 @@
+// affine_demo.c
+// 아핀 데모: 회전/확대하는 BG2 (Mode 2) + 행렬을 나눠 쓰는 회전 스프라이트 64개
+// ---------------------------------------------------------
+// 빌드: make test TARGET=affine_demo   /   make host TARGET=affine_demo
+//
+// 시작할 때 한 번:
+//   - 소프트웨어 행렬(fixmath 사인표)과 BIOS ObjAffineSet 결과를 512각도 x 확대율 몇 개로 비교
+//   - 새 행렬 32개를 한꺼번에 계산하는 비용 (소프트웨어 / BIOS)
+//   - 한 프레임에 키 40개를 요청해서 32칸을 넘는 부분이 -1로 돌아오는지 확인
+// 이후 매 프레임:
+//   - 스프라이트 64개 = 8개 그룹(그룹마다 회전 속도/확대율이 같음) + 멈춰 있는 8개
+//     -> 행렬은 프레임당 새로 8개만 계산, 나머지는 캐시 적중
+//   - 60프레임마다 캐시 통계와 affine_end 비용을 출력
+
+#include "gba.h"
+#include "bg.h"
+#include "affine.h"
+#include "sprite.h"
+#include "fixmath.h"
+#include "bios.h"
+#include "irq.h"
+#include "timer.h"
+#include "debug.h"
+
+#define SPRITE_COUNT 64
+#define GROUPS       8
+#define MAP_SIZE     16 // BG_AFF_16x16: 16 x 16칸 = 128 x 128 픽셀
+
+static void vblank(void) {
+    sprite_vblank();
+    affine_vblank();
+}
+
+// 아핀 BG는 8bpp 고정. 타일 0 = 어두운 칸, 타일 1 = 밝은 칸 (가운데 점 하나로 회전이 보이게)
+static void setup_bg(void) {
+    static u32 tiles[2 * 16];
+
+    for (int i = 0; i < 16; ++i) {
+        tiles[i]      = 0x01010101u;
+        tiles[16 + i] = 0x02020202u;
+    }
+    tiles[16 + 7] = 0x02030302u; // 타일 1의 가운데 (3, 4번 줄의 가운데 픽셀)
+    tiles[16 + 9] = 0x02030302u;
+
+    bg_init();
+    int cbb = bg_alloc_charblock();
+    int sbb = bg_alloc_screenblocks(1);
+
+    PAL_BG[1] = RGB(4, 6, 12);
+    PAL_BG[2] = RGB(10, 16, 26);
+    PAL_BG[3] = COLOR_GOLD;
+    bg_load_tiles(cbb, tiles, sizeof(tiles));
+    bg_setup(2, cbb, sbb, BG_8BPP | BG_AFF_16x16 | BG_AFF_WRAP);
+
+    // 맵 칸 = u8 타일 번호. VRAM은 8비트 쓰기가 안 되므로 2칸씩 u16으로
+    volatile u16* map = SCREENBLOCK(sbb);
+    for (int i = 0; i < MAP_SIZE * MAP_SIZE; i += 2) {
+        int y = i / MAP_SIZE, x = i % MAP_SIZE;
+        u16 a = (u16)((x + y) & 1), b = (u16)((x + 1 + y) & 1);
+        map[i / 2] = (u16)(a | (b << 8));
+    }
+}
+
+// 16x16 4bpp 스프라이트 (1D 배치 타일 4개): 테두리 + 오른쪽을 가리키는 막대
+static void setup_sprite(void) {
+    volatile u16* t = TILE_OBJ;
+
+    for (int tile = 0; tile < 4; ++tile) {
+        for (int row = 0; row < 8; ++row) {
+            int y = (tile >> 1) * 8 + row;
+            for (int half = 0; half < 2; ++half) {
+                u16 v = 0;
+                for (int p = 0; p < 4; ++p) {
+                    int x = (tile & 1) * 8 + half * 4 + p;
+                    int c = 0;
+                    if (x == 0 || y == 0 || x == 15 || y == 15) c = 1;
+                    else if ((y == 7 || y == 8) && x >= 8) c = 2;
+                    v |= (u16)(c << (p * 4));
+                }
+                t[tile * 16 + row * 2 + half] = v;
+            }
+        }
+    }
+
+    PAL_OBJ[1] = COLOR_WHITE;
+    PAL_OBJ[2] = COLOR_RED;
+}
+
+// 소프트웨어 행렬과 BIOS 결과의 최대 차이 (8.8 단위)
+static void compare_bios(void) {
+    static const fixed zooms[] = { FLOAT_TO_FIX(0.5), FIX_ONE, FLOAT_TO_FIX(1.5), INT_TO_FIX(2) };
+    int worst = 0, worst_even = 0;
+
+    for (int z = 0; z < 4; ++z) {
+        for (int a = 0; a < FIX_ANGLE_FULL; ++a) {
+            AffineMatrix soft, bios;
+            ObjAffineSrc src = { (s16)(FIX_ONE * FIX_ONE / zooms[z]), (s16)(FIX_ONE * FIX_ONE / zooms[z]),
+                                 (u16)(a << 7), 0 };
+
+            affine_rotscale(&soft, a, zooms[z], zooms[z]);
+            bios_obj_affine_set(&src, &bios, 1, 2);
+
+            int d[4] = { soft.pa - bios.pa, soft.pb - bios.pb, soft.pc - bios.pc, soft.pd - bios.pd };
+            for (int k = 0; k < 4; ++k) {
+                int v = d[k] < 0 ? -d[k] : d[k];
+                if (v > worst) worst = v;
+                if (!(a & 1) && v > worst_even) worst_even = v;
+            }
+        }
+    }
+    dbg_printf("[affine] soft vs BIOS ObjAffineSet: max diff %d/256 (even angles %d/256)", worst, worst_even);
+}
+
+// 새 행렬 32개를 한 번에 계산하는 비용 + 넘침 확인
+static void measure_batch(void) {
+    for (int mode = 0; mode < 2; ++mode) {
+        affine_use_bios(mode == 1);
+        affine_begin();
+        for (int i = 0; i < AFFINE_OBJ_SLOTS; ++i) affine_obj(i * 13 + mode, FIX_ONE + i, FIX_ONE);
+
+        cycle_counter_start();
+        affine_end();
+        u32 cycles = cycle_counter_read();
+
+        dbg_printf("[affine] %d new matrices (%s): %lu cycles", AFFINE_OBJ_SLOTS, mode ? "BIOS" : "soft",
+                   (unsigned long)cycles);
+    }
+    affine_use_bios(false);
+
+    affine_begin();
+    int ok = 0;
+    for (int i = 0; i < 40; ++i) ok += affine_obj(i * 7, FIX_ONE, FIX_ONE) >= 0;
+    affine_end();
+    dbg_printf("[affine] 40 keys in one frame: %d slots, %u overflow", ok, affine_stats()->overflow);
+}
+
+int main() {
+    dbg_init();
+    irq_init();
+    sprite_init();
+    affine_init();
+    setup_bg();
+    setup_sprite();
+
+    compare_bios();
+    measure_batch();
+
+    REG_DISPCNT = MODE_2 | BG2_ENABLE | DCNT_OBJ | DCNT_OBJ_1D;
+    irq_set(IRQ_VBLANK, vblank);
+
+    u32 hits = 0, misses = 0, end_cycles = 0;
+
+    for (int frame = 0;; ++frame) {
+        // 배경: 텍스처 중심(64, 64)을 화면 가운데에 두고 천천히 회전 + 확대 맥동
+        fixed bg_zoom = FIX_ONE + fix_sin(frame * 2) / 2;
+        affine_bg_set(2, INT_TO_FIX(64), INT_TO_FIX(64), SCREEN_W / 2, SCREEN_H / 2, frame, bg_zoom, bg_zoom);
+
+        sprite_begin();
+        affine_begin();
+
+        for (int i = 0; i < SPRITE_COUNT; ++i) {
+            int   g = i % (GROUPS + 1);
+            int   angle = 0;
+            fixed zoom  = FIX_ONE;
+
+            if (g < GROUPS) {
+                angle = frame * (g + 1) * (g & 1 ? -1 : 1);
+                zoom  = FIX_ONE + fix_sin(frame * 3 + g * 64) / 4;
+            }
+
+            int m = affine_obj(angle, zoom, zoom);
+            if (m < 0) continue;
+
+            int x = 24 + (i % 8) * 28, y = 16 + (i / 8) * 18;
+            sprite_add_affine(x, y, SPR_16x16, ATTR2_TILE(0), m, true, 0);
+        }
+
+        cycle_counter_start();
+        affine_end();
+        end_cycles += cycle_counter_read();
+        sprite_end();
+
+        hits   += affine_stats()->hits;
+        misses += affine_stats()->misses;
+
+        vblank_wait();
+
+        if (frame % 60 == 59) {
+            dbg_printf("[affine] 60 frames: %lu hits / %lu misses, %u live slots, affine_end avg %lu cycles",
+                       (unsigned long)hits, (unsigned long)misses, affine_stats()->live,
+                       (unsigned long)(end_cycles / 60));
+            hits       = 0;
+            misses     = 0;
+            end_cycles = 0;
+        }
+    }
+
+    return 0;
+}
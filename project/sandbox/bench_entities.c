@@ -0,0 +1,168 @@
+// bench_entities.c
+// 엔티티 벤치마크: SoA 풀 + 격자 브로드페이즈 vs 단순 AoS 구조체 배열
+// ---------------------------------------------------------
+// 빌드: make test TARGET=bench_entities   (mGBA 로그 창에 결과 출력)
+//       make host TARGET=bench_entities   (stdout에 출력, 사이클은 시간 환산값)
+//
+// 같은 초기 상태의 엔티티 N개를 두 방식으로 FRAMES프레임 동안 움직이며 측정합니다.
+//  - update:  이동 + 월드 경계에서 튕기기
+//  - collide: 겹치는 쌍 찾기 (AoS는 N^2 전부 비교, SoA는 32픽셀 격자)
+// 결과는 '밀리초당 처리한 엔티티 수'(16.78MHz 기준)와, 두 방식이 찾은 쌍이 같은지 검사한 값입니다.
+
+#include "gba.h"
+#include "fixed.h"
+#include "entity.h"
+#include "timer.h"
+#include "debug.h"
+
+#define FRAMES   16
+#define WORLD_W  480
+#define WORLD_H  320
+#define PAIR_CAP 1024
+
+#define CYCLES_PER_MS 16777
+
+// 예전 week2.c 방식: 엔티티 하나 = 구조체 하나
+typedef struct {
+    fixed x, y, vx, vy, w, h;
+    u16   flags, sprite, color;
+} Actor;
+
+static Actor      actors[ENT_MAX];
+static EntityPair pairs[PAIR_CAP];
+
+static u32 rng_state;
+
+static u32 rng(void) {
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return rng_state >> 16;
+}
+
+static void spawn(int n) {
+    rng_state = 0x1234567;
+    entity_init();
+
+    for (int i = 0; i < n; ++i) {
+        int   size = 8 + (int)(rng() % 9);
+        fixed x    = INT_TO_FIX((int)(rng() % (WORLD_W - size)));
+        fixed y    = INT_TO_FIX((int)(rng() % (WORLD_H - size)));
+        fixed vx   = (fixed)(rng() % 769) - 384; // -1.5 ~ 1.5 픽셀
+        fixed vy   = (fixed)(rng() % 769) - 384;
+
+        Actor a = { x, y, vx, vy, INT_TO_FIX(size), INT_TO_FIX(size), ENT_SOLID | ENT_BOUNCE, 0, 0 };
+        actors[i] = a;
+
+        int s = entity_slot(entity_create(x, y, size, size, ENT_SOLID | ENT_BOUNCE));
+        ent.vx[s] = vx;
+        ent.vy[s] = vy;
+    }
+}
+
+// ---------------------------------------------------------
+// 1. AoS 기준 구현
+// ---------------------------------------------------------
+static void aos_update(int n) {
+    for (int i = 0; i < n; ++i) {
+        Actor* a = &actors[i];
+
+        a->x += a->vx;
+        a->y += a->vy;
+
+        if (a->x < 0)                         { a->x = 0;                         if (a->vx < 0) a->vx = -a->vx; }
+        if (a->x > INT_TO_FIX(WORLD_W) - a->w) { a->x = INT_TO_FIX(WORLD_W) - a->w; if (a->vx > 0) a->vx = -a->vx; }
+        if (a->y < 0)                         { a->y = 0;                         if (a->vy < 0) a->vy = -a->vy; }
+        if (a->y > INT_TO_FIX(WORLD_H) - a->h) { a->y = INT_TO_FIX(WORLD_H) - a->h; if (a->vy > 0) a->vy = -a->vy; }
+    }
+}
+
+// 쌍의 순서와 무관한 요약값 (두 방식 결과 비교용)
+static u32 pair_key(int a, int b) {
+    u32 lo = (u32)(a < b ? a : b), hi = (u32)(a < b ? b : a);
+    u32 k  = (lo << 16 | hi) * 2654435761u;
+    return k ^ (k >> 15);
+}
+
+static int aos_collide(int n, u32* sum) {
+    int found = 0;
+
+    for (int i = 0; i < n; ++i) {
+        const Actor* a = &actors[i];
+        for (int j = i + 1; j < n; ++j) {
+            const Actor* b = &actors[j];
+            if (a->x < b->x + b->w && b->x < a->x + a->w && a->y < b->y + b->h && b->y < a->y + a->h) {
+                *sum += pair_key(i, j);
+                ++found;
+            }
+        }
+    }
+    return found;
+}
+
+// ---------------------------------------------------------
+// 2. 측정
+// ---------------------------------------------------------
+static u32 per_ms(int n, u32 cycles) {
+    return cycles ? (u32)((unsigned long long)n * FRAMES * CYCLES_PER_MS / cycles) : 0;
+}
+
+static void bench(int n) {
+    u32 aos_upd = 0, aos_col = 0, soa_upd = 0, soa_col = 0;
+    u32 aos_sum = 0, soa_sum = 0;
+    int aos_pairs = 0, soa_pairs = 0;
+
+    spawn(n);
+
+    for (int f = 0; f < FRAMES; ++f) {
+        cycle_counter_start();
+        aos_update(n);
+        aos_upd += cycle_counter_read();
+
+        cycle_counter_start();
+        aos_pairs += aos_collide(n, &aos_sum);
+        aos_col += cycle_counter_read();
+
+        cycle_counter_start();
+        entity_integrate();
+        entity_clamp(0, 0, INT_TO_FIX(WORLD_W), INT_TO_FIX(WORLD_H));
+        soa_upd += cycle_counter_read();
+
+        cycle_counter_start();
+        int found = entity_collide(pairs, PAIR_CAP);
+        soa_col += cycle_counter_read();
+
+        // 엔티티를 순서대로 만들었고 삭제가 없으므로 핸들 = AoS 번호
+        soa_pairs += found;
+        for (int i = 0; i < found && i < PAIR_CAP; ++i) soa_sum += pair_key(pairs[i].a, pairs[i].b);
+    }
+
+    dbg_printf("N=%3d update  aos %6lu/ms  soa %6lu/ms", n,
+               (unsigned long)per_ms(n, aos_upd), (unsigned long)per_ms(n, soa_upd));
+    dbg_printf("      collide aos %6lu/ms  soa %6lu/ms  (%d pairs in %d frames, %s)",
+               (unsigned long)per_ms(n, aos_col), (unsigned long)per_ms(n, soa_col), soa_pairs, FRAMES,
+               (aos_pairs == soa_pairs && aos_sum == soa_sum) ? "same as aos" : "!! MISMATCH");
+}
+
+int main() {
+    dbg_init();
+
+    dbg_printf("[bench_entities] %dx%d world, %d frames, entities per millisecond (higher is better)",
+               WORLD_W, WORLD_H, FRAMES);
+    bench(64);
+    bench(128);
+    bench(256);
+
+    // 삭제/재생성 후에도 칸과 핸들이 맞는지
+    spawn(ENT_MAX);
+    for (int i = 0; i < ENT_MAX; i += 3) entity_destroy((EntityId)i);
+    int bad = 0;
+    for (int s = 0; s < ent.count; ++s) bad += entity_slot(ent.id[s]) != s;
+    for (int i = 0; i < ENT_MAX; i += 3) bad += entity_slot((EntityId)i) != -1;
+    while (entity_create(0, 0, 8, 8, 0) != ENT_NONE) { }
+    dbg_printf("[bench_entities] pool check: %d live after refill, %d errors", ent.count, bad);
+
+    while (1) {
+        sync_vblank();
+    }
+
+    return 0;
+}
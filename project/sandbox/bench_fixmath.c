@@ -0,0 +1,192 @@
+// bench_fixmath.c
+// 고정 소수점 수학 정확도 + 처리량 벤치마크 (double 기준 비교)
+// ---------------------------------------------------------
+// 빌드: make host TARGET=bench_fixmath   (주 용도: PC에서 정확도 검증)
+//       make test TARGET=bench_fixmath   (GBA 사이클 측정, double은 소프트웨어 연산이라 느림)
+//
+// [정확도] 같은 입력을 double로 계산한 값과 비교해서 최대 오차를 출력합니다.
+//          - 나눗셈: fix_div(64비트 정확값)와 '완전히 같은지'도 확인
+//          - sin/cos: Q8 LSB 단위, atan2: 각도 단위(512 = 한 바퀴)
+//          - 배치 커널: 스칼라 fix_mul로 계산한 결과와 완전히 같은지 확인
+// [처리량] COUNT개를 처리하는 데 걸린 사이클 (REPS번 평균)
+
+#include <math.h>
+
+#include "gba.h"
+#include "fixmath.h"
+#include "timer.h"
+#include "debug.h"
+
+#define COUNT 256
+
+static fixed buf_a[COUNT], buf_b[COUNT], buf_c[COUNT], buf_d[COUNT];
+static volatile fixed sink; // 결과를 버리지 못하게 해서 최적화로 루프가 사라지는 것 방지
+
+static u32 rng_state = 0x2468ACE;
+
+static u32 rng(void) {
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return rng_state;
+}
+
+// -range ~ +range 사이의 0이 아닌 값
+static fixed rand_fixed(u32 range) {
+    fixed v = (fixed)(rng() % (2 * range + 1)) - (fixed)range;
+    return v ? v : 1;
+}
+
+static double to_double(fixed v) {
+    return v / (double)FIX_SCALE;
+}
+
+// 오차(double)를 소수 셋째 자리까지 정수 두 개로 (dbg_printf에 %f를 쓰지 않기 위해)
+#define MILLI(x) (long)(x), (long)(fabs((x) - (long)(x)) * 1000.0)
+
+// ---------------------------------------------------------
+// 1. 정확도
+// ---------------------------------------------------------
+static void check_div(void) {
+    int    mismatch = 0, bios_mismatch = 0, q16_mismatch = 0;
+    double worst    = 0.0;
+
+    for (int i = 0; i < 4096; ++i) {
+        fixed a = rand_fixed((i & 1) ? 0x7FFFFF : 0x7FFFFFFF >> (i & 15));
+        fixed b = rand_fixed((i & 2) ? 0x7FF : 0x7FFFFFFF >> (i & 15));
+
+        // 결과가 fixed 범위를 넘는 조합은 제외 (fix_div 자체가 의미 없음)
+        double ref = to_double(a) / to_double(b);
+        if (fabs(ref) >= 8388607.0) continue;
+
+        fixed fast = fix_div_fast(a, b);
+        if (fast != fix_div(a, b)) ++mismatch;
+        if (fabs(to_double(fast) - ref) * FIX_SCALE > worst) worst = fabs(to_double(fast) - ref) * FIX_SCALE;
+
+        if (a > -(1 << 23) && a < (1 << 23) && fix_div_bios(a, b) != fix_div(a, b)) ++bios_mismatch;
+
+        long long q16 = (long long)a * 65536 / b;
+        if (q16 > -0x7FFFFFFFLL && q16 < 0x7FFFFFFFLL && fix_div_q16(a, b) != (s32)q16) ++q16_mismatch;
+    }
+
+    dbg_printf("div      fast != fix_div: %d, bios != fix_div: %d, q16 != exact: %d, max err %ld.%03ld LSB",
+               mismatch, bios_mismatch, q16_mismatch, MILLI(worst));
+}
+
+static void check_trig(void) {
+    double pi = acos(-1.0);
+    double worst_sin = 0.0, worst_cos = 0.0;
+
+    for (int a = 0; a < FIX_ANGLE_FULL; ++a) {
+        double rad = 2.0 * pi * a / FIX_ANGLE_FULL;
+        double es  = fabs(fix_sin_q12(a) / 4096.0 - sin(rad)) * FIX_SCALE;
+        double ec  = fabs(fix_cos_q12(a) / 4096.0 - cos(rad)) * FIX_SCALE;
+        if (es > worst_sin) worst_sin = es;
+        if (ec > worst_cos) worst_cos = ec;
+    }
+
+    double worst_atan = 0.0;
+    for (int i = 0; i < 4096; ++i) {
+        fixed  y   = rand_fixed((i & 1) ? 0x7FFF : 0x7FFFFF);
+        fixed  x   = rand_fixed((i & 2) ? 0x7FFF : 0x7FFFFF);
+        double ref = atan2((double)y, (double)x) / (2.0 * pi) * FIX_ANGLE_FULL;
+        double err = fabs(fix_atan2(y, x) - ref);
+
+        if (err > FIX_ANGLE_HALF) err = FIX_ANGLE_FULL - err; // 0 / 511 경계
+        if (err > worst_atan) worst_atan = err;
+    }
+
+    double worst_sqrt = 0.0;
+    for (int i = 0; i < 4096; ++i) {
+        fixed  a   = (fixed)(rng() % ((i & 1) ? (1u << 24) : 0x7FFFFFFFu));
+        double ref = sqrt(to_double(a));
+        double err = fabs(to_double(fix_sqrt(a)) - ref) * FIX_SCALE;
+        if (a < (1 << 24) && err > worst_sqrt) worst_sqrt = err;
+    }
+
+    dbg_printf("sin/cos  max err %ld.%03ld / %ld.%03ld LSB (Q8)", MILLI(worst_sin), MILLI(worst_cos));
+    dbg_printf("atan2    max err %ld.%03ld angle units (512 = 360 deg)", MILLI(worst_atan));
+    dbg_printf("sqrt     max err %ld.%03ld LSB (a < 2^24)", MILLI(worst_sqrt));
+}
+
+static void check_batch(void) {
+    int   mismatch = 0;
+    fixed k        = rand_fixed(0x3FF);
+
+    for (int i = 0; i < COUNT; ++i) {
+        buf_a[i] = rand_fixed(0x7FFFF);
+        buf_b[i] = rand_fixed(0x7FFFF);
+    }
+
+    // n = COUNT - 3: 4개 단위로 안 떨어지는 꼬리 처리도 확인
+    fix_mul_n(buf_c, buf_a, buf_b, COUNT - 3);
+    for (int i = 0; i < COUNT - 3; ++i) if (buf_c[i] != fix_mul(buf_a[i], buf_b[i])) ++mismatch;
+
+    for (int i = 0; i < COUNT; ++i) buf_c[i] = buf_a[i];
+    fix_madd_n(buf_c, buf_b, k, COUNT - 1);
+    for (int i = 0; i < COUNT - 1; ++i) if (buf_c[i] != buf_a[i] + fix_mul(buf_b[i], k)) ++mismatch;
+
+    fix_lerp_n(buf_c, buf_a, buf_b, FIX_ONE / 3, COUNT - 2);
+    for (int i = 0; i < COUNT - 2; ++i) {
+        if (buf_c[i] != buf_a[i] + fix_mul(buf_b[i] - buf_a[i], FIX_ONE / 3)) ++mismatch;
+    }
+
+    dbg_printf("batch    mismatches vs scalar: %d", mismatch);
+}
+
+// ---------------------------------------------------------
+// 2. 처리량
+// ---------------------------------------------------------
+// 호스트는 GBA보다 수백 배 빠르므로 원소당 값은 0이 되기 쉬움.
+// 그래서 COUNT개 전체의 사이클을 REPS번 평균내서 출력 (GBA에서는 / COUNT 하면 원소당 값)
+#define REPS 16
+
+static void report(const char* label, u32 cycles) {
+    dbg_printf("%-18s %8lu cycles / %d elem", label, (unsigned long)(cycles / REPS), COUNT);
+}
+
+#define MEASURE(label, body)                                            \
+    do {                                                                \
+        cycle_counter_start();                                          \
+        for (int r = 0; r < REPS; ++r) {                                \
+            for (int i = 0; i < COUNT; ++i) { body; }                   \
+        }                                                               \
+        report(label, cycle_counter_read());                            \
+    } while (0)
+
+static void measure_throughput(void) {
+    for (int i = 0; i < COUNT; ++i) {
+        buf_a[i] = rand_fixed(0x7FFFF);
+        buf_b[i] = rand_fixed(0x7FF);
+    }
+
+    MEASURE("fix_div (64-bit)", sink = fix_div(buf_a[i], buf_b[i]));
+    MEASURE("fix_div_fast",     sink = fix_div_fast(buf_a[i], buf_b[i]));
+    MEASURE("fix_div_bios",     sink = fix_div_bios(buf_a[i], buf_b[i]));
+    MEASURE("fix_atan2",        sink = fix_atan2(buf_a[i], buf_b[i]));
+    MEASURE("fix_sqrt",         sink = fix_sqrt(buf_a[i] & 0xFFFFFF));
+    MEASURE("fix_mul (scalar)", sink = fix_mul(buf_a[i], buf_b[i]));
+
+    // 배치 커널: 한 번 호출 = COUNT개 (i 루프 없이)
+    MEASURE("fix_mul_n",        if (i == 0) fix_mul_n(buf_c, buf_a, buf_b, COUNT));
+    MEASURE("fix_madd_n",       if (i == 0) fix_madd_n(buf_d, buf_b, FIX_ONE / 60, COUNT));
+    MEASURE("fix_lerp_n",       if (i == 0) fix_lerp_n(buf_d, buf_a, buf_b, FIX_ONE / 2, COUNT));
+    sink = buf_c[0] + buf_d[0];
+}
+
+int main() {
+    REG_DISPCNT = MODE_3 | BG2_ENABLE;
+    dbg_init();
+
+    dbg_printf("[bench_fixmath] accuracy vs double");
+    check_div();
+    check_trig();
+    check_batch();
+
+    dbg_printf("[bench_fixmath] throughput, %d elements (16.78MHz cycles)", COUNT);
+    measure_throughput();
+
+    while (1) {
+        sync_vblank();
+    }
+
+    return 0;
+}
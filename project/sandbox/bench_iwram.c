@@ -0,0 +1,143 @@
+// bench_iwram.c
+// 코드 배치 벤치마크: 같은 C 루프를 ROM(Thumb) / IWRAM(ARM)에 두고 사이클 비교
+// ---------------------------------------------------------
+// 빌드: make test TARGET=bench_iwram   (mGBA 로그 창에 결과 출력, 링크 후 메모리 맵도 출력됨)
+//       make host TARGET=bench_iwram   (배치 속성이 비어 있으므로 두 값이 거의 같아야 정상)
+//
+// [비교 대상]
+//  - mac:   fixed 배열 곱셈 누적 (연산 위주, 명령어 가져오기 비용이 드러남)
+//  - rows:  사각형 내부 채우기 (VRAM 쓰기 위주). IWRAM 쪽은 draw.c가 쓰는 span_fill_rows16
+//  - draw_rect: 실제 API 경로 전체 (클리핑 + 커널 호출)
+// 각 항목은 REPS번 평균이며, 두 버전의 결과가 같은지도 검사합니다.
+
+#include <stdio.h>
+
+#include "gba.h"
+#include "fixed.h"
+#include "draw.h"
+#include "fb.h"
+#include "span.h"
+#include "timer.h"
+#include "debug.h"
+
+#define COUNT 256
+#define REPS  16
+
+static fixed buf_a[COUNT], buf_b[COUNT];
+static volatile fixed sink;
+
+// ---------------------------------------------------------
+// 1. 같은 본문, 다른 배치
+// ---------------------------------------------------------
+#define MAC_BODY                                                        \
+    fixed acc = 0;                                                      \
+    for (int i = 0; i < n; ++i) acc += fix_mul_small(a[i], b[i]);       \
+    return acc;
+
+static fixed mac_rom(const fixed* a, const fixed* b, int n) {
+    MAC_BODY
+}
+
+IWRAM_CODE ARM_CODE
+static fixed mac_iwram(const fixed* a, const fixed* b, int n) {
+    MAC_BODY
+}
+
+// 예전 draw.c의 줄 루프 (ROM Thumb에서 2픽셀씩 32비트 저장)
+static void rows_rom(u16* row, int pitch, int len, int rows, u16 color) {
+    u32 pair = color | ((u32)color << 16);
+
+    for (; rows > 0; --rows, row += pitch) {
+        u16* p = row;
+        int  n = len;
+
+        if ((uintptr_t)p & 2) { *p++ = color; --n; }
+        u32* w = (u32*)p;
+        for (int k = n >> 1; k > 0; --k) *w++ = pair;
+        if (n & 1) *(u16*)w = color;
+    }
+}
+
+// ---------------------------------------------------------
+// 2. 측정
+// ---------------------------------------------------------
+static void report(const char* label, u32 rom, u32 iwram) {
+    u32 pct = rom ? (u32)((unsigned long long)iwram * 100 / rom) : 0;
+    dbg_printf("%-14s rom %8lu  iwram %8lu  (%lu%%)", label,
+               (unsigned long)(rom / REPS), (unsigned long)(iwram / REPS), (unsigned long)pct);
+}
+
+#define MEASURE(out, body)                                              \
+    do {                                                                \
+        cycle_counter_start();                                          \
+        for (int r = 0; r < REPS; ++r) { body; }                        \
+        out = cycle_counter_read();                                     \
+    } while (0)
+
+static bool same_rows(const u16* p, int pitch, int len, int rows, u16 color) {
+    for (int y = 0; y < rows; ++y) {
+        for (int x = 0; x < len; ++x) if (p[y * pitch + x] != color) return false;
+    }
+    return true;
+}
+
+static void bench_mac(void) {
+    u32 rom, iwram;
+
+    for (int i = 0; i < COUNT; ++i) {
+        buf_a[i] = (fixed)((i * 37) & 0x3FFF) - 0x2000;
+        buf_b[i] = (fixed)((i * 91) & 0x3FFF) - 0x2000;
+    }
+
+    MEASURE(rom,   sink = mac_rom(buf_a, buf_b, COUNT));
+    MEASURE(iwram, sink = mac_iwram(buf_a, buf_b, COUNT));
+    report("mac x256", rom, iwram);
+
+    if (mac_rom(buf_a, buf_b, COUNT) != mac_iwram(buf_a, buf_b, COUNT)) dbg_printf("  !! mac mismatch");
+}
+
+static void bench_rows(int len, int rows) {
+    u16* dst = (u16*)VRAM + SCREEN_W * 8 + 3; // 일부러 비정렬 시작
+    char label[24];
+    bool ok = true;
+    u32  rom, iwram;
+
+    MEASURE(rom, rows_rom(dst, SCREEN_W, len, rows, (u16)r));
+    ok &= same_rows(dst, SCREEN_W, len, rows, REPS - 1);
+
+    MEASURE(iwram, span_fill_rows16(dst, SCREEN_W, len, rows, (u16)(r + 100)));
+    ok &= same_rows(dst, SCREEN_W, len, rows, REPS - 1 + 100);
+
+    snprintf(label, sizeof(label), "rows %dx%d", len, rows);
+    report(label, rom, iwram);
+    if (!ok) dbg_printf("  !! rows %dx%d wrong pixels", len, rows);
+}
+
+static void bench_draw_rect(int w, int h) {
+    u32 cycles;
+
+    MEASURE(cycles, draw_rect(5, 5, w, h, (u16)r));
+    dbg_printf("draw_rect %3dx%-3d      %8lu cycles", w, h, (unsigned long)(cycles / REPS));
+}
+
+int main() {
+    fb_init(FB_MODE3, 0);
+    dbg_init();
+
+    dbg_printf("[bench_iwram] same C loop: ROM Thumb vs IWRAM ARM (cycles, %d reps)", REPS);
+    bench_mac();
+    bench_rows(8, 8);
+    bench_rows(33, 32);
+    bench_rows(200, 100);
+
+    dbg_printf("[bench_iwram] draw_rect via IWRAM span kernel");
+    bench_draw_rect(8, 8);
+    bench_draw_rect(33, 32);
+    bench_draw_rect(200, 100);
+
+    while (1) {
+        sync_vblank();
+    }
+
+    return 0;
+}
@@ -0,0 +1,108 @@
+// bench_mem.c
+// 메모리 커널 벤치마크: 전략별(CPU / stmia / DMA / CpuFastSet) 사이클 비교
+// ---------------------------------------------------------
+// 빌드: make test TARGET=bench_mem   (mGBA 로그 창에 결과 출력)
+//       make host TARGET=bench_mem   (stdout에 출력, 사이클은 시간 환산값)
+//
+// 각 크기마다 REPEAT번 실행한 평균 사이클을 출력하고,
+// 결과가 올바른지(모든 원소가 기대값인지)도 함께 검사합니다.
+
+#include "gba.h"
+#include "mem.h"
+#include "timer.h"
+#include "debug.h"
+
+#define REPEAT      8
+#define HALF_SCREEN (SCREEN_W * SCREEN_H / 2) // 복사 원본/대상으로 화면을 반씩 사용
+
+typedef enum { OP_FILL16, OP_FILL32, OP_COPY32, OP_COUNT } Op;
+
+static const char* const op_names[OP_COUNT] = { "fill16", "fill32", "copy32" };
+
+// 크기 단위: fill16은 halfword, 나머지는 word
+static const u32 sizes[] = { 8, 120, 2400, HALF_SCREEN / 2 };
+
+#define SIZE_COUNT (sizeof(sizes) / sizeof(sizes[0]))
+
+static void run_op(Op op, u32 count, u32 seed) {
+    switch (op) {
+        case OP_FILL16: mem_fill16(VRAM + 1, (u16)seed, count);                 break; // 일부러 비정렬
+        case OP_FILL32: mem_fill32(VRAM, seed | (seed << 16), count);            break;
+        case OP_COPY32: mem_copy32(VRAM + HALF_SCREEN, VRAM, count);             break;
+        default: break;
+    }
+}
+
+static bool verify_op(Op op, u32 count, u32 seed) {
+    for (u32 i = 0; i < count; ++i) {
+        switch (op) {
+            case OP_FILL16:
+                if (VRAM[1 + i] != (u16)seed) return false;
+                break;
+            case OP_FILL32:
+                if (((volatile u32*)VRAM)[i] != (seed | (seed << 16))) return false;
+                break;
+            case OP_COPY32:
+                if (((volatile u32*)(VRAM + HALF_SCREEN))[i] != ((volatile u32*)VRAM)[i]) return false;
+                break;
+            default:
+                break;
+        }
+    }
+    return true;
+}
+
+static u32 measure(Op op, u32 count, MemStrategy strategy, bool* ok) {
+    u32 total = 0;
+
+    mem_set_strategy(strategy);
+    for (int r = 0; r < REPEAT; ++r) {
+        u32 seed = (u32)(r * 0x0421 + strategy) & 0x7FFF;
+
+        // 복사 원본을 매번 바꿔서 이전 결과가 우연히 통과하지 않도록 함
+        if (op == OP_COPY32) {
+            mem_set_strategy(MEM_CPU);
+            mem_fill16(VRAM, (u16)seed, HALF_SCREEN);
+            mem_set_strategy(strategy);
+        }
+
+        cycle_counter_start();
+        run_op(op, count, seed);
+        total += cycle_counter_read();
+
+        if (!verify_op(op, count, seed)) *ok = false;
+    }
+    mem_set_strategy(MEM_AUTO);
+    return total / REPEAT;
+}
+
+int main() {
+    REG_DISPCNT = MODE_3 | BG2_ENABLE;
+    dbg_init();
+
+    dbg_printf("[bench_mem] avg cycles over %d runs (16.78MHz)", REPEAT);
+    dbg_printf("%-7s %6s %9s %9s %9s %9s %9s", "op", "count", "cpu", "stmia", "dma", "fastset", "auto");
+
+    for (int op = 0; op < OP_COUNT; ++op) {
+        for (u32 i = 0; i < SIZE_COUNT; ++i) {
+            u32  cycles[MEM_STRATEGY_COUNT];
+            bool ok = true;
+
+            for (int s = 0; s < MEM_STRATEGY_COUNT; ++s) {
+                cycles[s] = measure((Op)op, sizes[i], (MemStrategy)s, &ok);
+            }
+
+            dbg_printf("%-7s %6lu %9lu %9lu %9lu %9lu %9lu%s",
+                       op_names[op], (unsigned long)sizes[i],
+                       (unsigned long)cycles[MEM_CPU], (unsigned long)cycles[MEM_STMIA],
+                       (unsigned long)cycles[MEM_DMA], (unsigned long)cycles[MEM_FASTSET],
+                       (unsigned long)cycles[MEM_AUTO], ok ? "" : "  << MISMATCH");
+        }
+    }
+
+    while (1) {
+        sync_vblank();
+    }
+
+    return 0;
+}
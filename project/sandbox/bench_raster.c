@@ -0,0 +1,227 @@
+// bench_raster.c
+// Mode 4 래스터라이저 검증 + 벤치마크: 삼각형/다각형 채우기, 잘린 선
+// ---------------------------------------------------------
+// 빌드: make test TARGET=bench_raster   (mGBA 로그 창에 결과 출력)
+//       make host TARGET=bench_raster   (stdout에 출력, 사이클은 시간 환산값)
+//
+// [검증] (Back Buffer에 그려서 픽셀을 직접 셈)
+//   - 부채꼴 삼각형들의 픽셀 수 합 == 같은 볼록 다각형을 한 번에 칠한 픽셀 수 == 합집합 픽셀 수
+//     -> 공유 변에서 틈도, 두 번 칠한 픽셀도 없음 (top-left 규칙)
+//   - 화면 밖으로 크게 나간 선: 클리핑한 draw_line == 픽셀마다 검사하는 기준 Bresenham
+// [처리량] 크기별 무작위 삼각형 TRIS개를 그리는 사이클
+//   -> 삼각형당 사이클, 프레임당 삼각형 수(60fps 예산 전부 사용 시), 픽셀당 사이클(채우기 속도)
+
+#include "gba.h"
+#include "fb.h"
+#include "draw.h"
+#include "fixmath.h"
+#include "timer.h"
+#include "debug.h"
+
+#define TRIS  64
+#define LINES 64
+
+typedef struct {
+    fixed x[3], y[3];
+} Tri;
+
+static Tri tris[TRIS];
+
+static u32 rng_state = 0x13579BD;
+
+static u32 rng(void) {
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return rng_state >> 8;
+}
+
+// Back Buffer에서 0이 아닌 픽셀 수
+static u32 count_pixels(void) {
+    const u8* p = (const u8*)fb.back;
+    u32       n = 0;
+
+    for (int i = 0; i < SCREEN_W * SCREEN_H; ++i) n += p[i] != 0;
+    return n;
+}
+
+// ---------------------------------------------------------
+// 1. 검증
+// ---------------------------------------------------------
+// 소수 좌표의 볼록 8각형과, 그 중심에서 나눈 삼각형 8개
+static void check_fan(void) {
+    DrawVertex poly[8];
+    fixed      cx = FLOAT_TO_FIX(119.37), cy = FLOAT_TO_FIX(80.61);
+
+    for (int i = 0; i < 8; ++i) {
+        int a = i * FIX_ANGLE_FULL / 8 + 5;
+        poly[i].x = cx + fix_cos(a) * 70 + (i * 37 & 0xFF);
+        poly[i].y = cy + fix_sin(a) * 70 - (i * 91 & 0x7F);
+    }
+
+    u32 sum = 0;
+    for (int i = 0; i < 8; ++i) {
+        const DrawVertex* a = &poly[i];
+        const DrawVertex* b = &poly[(i + 1) & 7];
+        fb_clear(0);
+        draw_triangle(cx, cy, a->x, a->y, b->x, b->y, 1);
+        sum += count_pixels();
+    }
+
+    fb_clear(0);
+    for (int i = 0; i < 8; ++i) {
+        const DrawVertex* a = &poly[i];
+        const DrawVertex* b = &poly[(i + 1) & 7];
+        draw_triangle(cx, cy, a->x, a->y, b->x, b->y, (u16)(i + 1));
+    }
+    u32 fan = count_pixels();
+
+    fb_clear(0);
+    draw_polygon(poly, 8, 1);
+    u32 whole = count_pixels();
+
+    dbg_printf("fan      sum %lu, union %lu, polygon %lu -> %s", (unsigned long)sum, (unsigned long)fan,
+               (unsigned long)whole, (sum == fan && fan == whole) ? "no gaps / no overlap" : "MISMATCH");
+}
+
+// 픽셀마다 화면 검사를 하는 기준 Bresenham (draw_line의 클리핑 전 동작과 같은 규칙)
+static void ref_line(int x0, int y0, int x1, int y1, u16 color) {
+    int dx = (x1 > x0) ? x1 - x0 : x0 - x1;
+    int dy = (y1 > y0) ? y1 - y0 : y0 - y1;
+
+    if (dx >= dy) {
+        if (x0 > x1) { int t; t = x0; x0 = x1; x1 = t; t = y0; y0 = y1; y1 = t; }
+        int sy = (y1 > y0) ? 1 : -1, err = dx >> 1, y = y0;
+        for (int x = x0; x <= x1; ++x) {
+            draw_pixel(x, y, color);
+            err -= dy;
+            if (err < 0) { y += sy; err += dx; }
+        }
+    } else {
+        if (y0 > y1) { int t; t = x0; x0 = x1; x1 = t; t = y0; y0 = y1; y1 = t; }
+        int sx = (x1 > x0) ? 1 : -1, err = dy >> 1, x = x0;
+        for (int y = y0; y <= y1; ++y) {
+            draw_pixel(x, y, color);
+            err -= dx;
+            if (err < 0) { x += sx; err += dy; }
+        }
+    }
+}
+
+static void check_lines(void) {
+    static u16 expect[SCREEN_W * SCREEN_H / 2];
+    int        bad = 0;
+
+    for (int i = 0; i < 256; ++i) {
+        // 절반은 화면 근처, 절반은 수천 픽셀 밖에서 화면을 가로지르는 선
+        int range = (i & 1) ? 4000 : 300;
+        int x0 = (int)(rng() % (2 * range)) - range + SCREEN_W / 2;
+        int y0 = (int)(rng() % (2 * range)) - range + SCREEN_H / 2;
+        int x1 = (int)(rng() % (2 * range)) - range + SCREEN_W / 2;
+        int y1 = (int)(rng() % (2 * range)) - range + SCREEN_H / 2;
+
+        fb_clear(0);
+        ref_line(x0, y0, x1, y1, 1);
+        for (int k = 0; k < SCREEN_W * SCREEN_H / 2; ++k) expect[k] = fb.back[k];
+
+        fb_clear(0);
+        draw_line(x0, y0, x1, y1, 1);
+        for (int k = 0; k < SCREEN_W * SCREEN_H / 2; ++k) {
+            if (fb.back[k] != expect[k]) { ++bad; break; }
+        }
+    }
+    dbg_printf("lines    clipped vs per-pixel reference: %d / 256 differ", bad);
+}
+
+// ---------------------------------------------------------
+// 2. 처리량
+// ---------------------------------------------------------
+// 크기 size 픽셀 안팎의 무작위 삼각형 (일부는 화면 가장자리에 걸침)
+static void make_tris(int size) {
+    for (int i = 0; i < TRIS; ++i) {
+        fixed cx = (fixed)(rng() % INT_TO_FIX(SCREEN_W + 16)) - INT_TO_FIX(8);
+        fixed cy = (fixed)(rng() % INT_TO_FIX(SCREEN_H + 16)) - INT_TO_FIX(8);
+        for (int k = 0; k < 3; ++k) {
+            int a = (int)(rng() % FIX_ANGLE_FULL);
+            tris[i].x[k] = cx + fix_cos(a) * size / 2;
+            tris[i].y[k] = cy + fix_sin(a) * size / 2;
+        }
+    }
+}
+
+static void draw_tris(void) {
+    for (int i = 0; i < TRIS; ++i) {
+        const Tri* t = &tris[i];
+        draw_triangle(t->x[0], t->y[0], t->x[1], t->y[1], t->x[2], t->y[2], (u16)(1 + (i & 7)));
+    }
+}
+
+static void measure_tris(int size) {
+    make_tris(size);
+
+    // 채운 픽셀 수 (삼각형마다 따로 세어 합산)
+    u32 pixels = 0;
+    for (int i = 0; i < TRIS; ++i) {
+        const Tri* t = &tris[i];
+        fb_clear(0);
+        draw_triangle(t->x[0], t->y[0], t->x[1], t->y[1], t->x[2], t->y[2], 1);
+        pixels += count_pixels();
+    }
+
+    fb_clear(0);
+    cycle_counter_start();
+    draw_tris();
+    u32 cycles = cycle_counter_read();
+    if (cycles == 0) cycles = 1;
+
+    u32 per_tri = cycles / TRIS;
+    dbg_printf("tri %3dpx  %6lu cycles/tri, %5lu tris/frame, %3lu px/tri, %lu.%02lu cycles/px",
+               size, (unsigned long)per_tri, (unsigned long)(CYCLES_PER_FRAME / (per_tri ? per_tri : 1)),
+               (unsigned long)(pixels / TRIS), (unsigned long)(pixels ? cycles / pixels : 0),
+               (unsigned long)(pixels ? cycles * 100 / pixels % 100 : 0));
+}
+
+static void measure_lines(void) {
+    static s16 ends[LINES][4];
+
+    for (int i = 0; i < LINES; ++i) {
+        for (int k = 0; k < 4; ++k) ends[i][k] = (s16)(rng() % ((k & 1) ? SCREEN_H : SCREEN_W));
+    }
+
+    fb_clear(0);
+    cycle_counter_start();
+    for (int i = 0; i < LINES; ++i) draw_line(ends[i][0], ends[i][1], ends[i][2], ends[i][3], 1);
+    u32 cycles = cycle_counter_read();
+
+    u32 per_line = cycles / LINES;
+    dbg_printf("line       %6lu cycles/line, %5lu lines/frame", (unsigned long)per_line,
+               (unsigned long)(CYCLES_PER_FRAME / (per_line ? per_line : 1)));
+}
+
+int main() {
+    dbg_init();
+    fb_init(FB_MODE4, 0);
+
+    PAL_BG[0] = COLOR_BLACK;
+    for (int i = 1; i < 9; ++i) PAL_BG[i] = RGB(i * 3, 31 - i * 3, 16);
+
+    dbg_printf("[bench_raster] Mode 4 checks");
+    check_fan();
+    check_lines();
+
+    dbg_printf("[bench_raster] throughput, %d per batch (16.78MHz cycles, frame = %d)", TRIS, CYCLES_PER_FRAME);
+    measure_tris(8);
+    measure_tris(32);
+    measure_tris(96);
+    measure_lines();
+
+    // 마지막 배치를 화면에 남김
+    fb_clear(0);
+    draw_tris();
+    sync_vblank();
+    fb_flip();
+
+    while (1) {
+        sync_vblank();
+    }
+
+    return 0;
+}
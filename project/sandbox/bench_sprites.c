@@ -0,0 +1,121 @@
+// bench_sprites.c
+// 스프라이트 배칭 벤치마크: 움직이는 스프라이트 128개의 프레임당 CPU 비용
+// ---------------------------------------------------------
+// 빌드: make test TARGET=bench_sprites   (mGBA 로그 창에 결과 출력)
+//       make host TARGET=bench_sprites   (stdout에 출력, 사이클은 시간 환산값)
+//
+// 월드(화면 2배 크기) 안에서 튕겨 다니는 스프라이트 128개를 매 프레임
+// 이동 -> sprite_begin/add/end 하고, 그 구간의 사이클을 측정합니다.
+// 카메라도 좌우로 움직이므로 일부는 컬링되고, 결과는 60프레임마다 출력합니다.
+// 목표: 60fps 유지 = 프레임 예산(280,896 사이클) 안에서 여유 있게 끝나야 함
+
+#include "gba.h"
+#include "fb.h"
+#include "irq.h"
+#include "sprite.h"
+#include "timer.h"
+#include "debug.h"
+
+#define SPRITE_COUNT  128
+#define WORLD_W       (SCREEN_W * 2)
+#define WORLD_H       (SCREEN_H * 2)
+#define REPORT_FRAMES 60
+#define BASE_TILE     512 // 비트맵 모드에서 쓸 수 있는 첫 OBJ 타일
+
+typedef struct {
+    int x, y;   // 월드 좌표
+    int dx, dy; // 프레임당 이동량
+} Mover;
+
+static Mover movers[SPRITE_COUNT];
+
+static u32 rng_state = 0x1234567;
+
+static u32 rng(void) {
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return rng_state >> 16;
+}
+
+// 8x8 4bpp 타일 하나: 테두리 = 색 1, 안쪽 = 색 2 (한 줄 = u16 2개, 픽셀당 4비트)
+static void load_tile(void) {
+    volatile u16* tile = TILE_OBJ + BASE_TILE * 16;
+
+    for (int row = 0; row < 8; ++row) {
+        bool edge = (row == 0 || row == 7);
+        tile[row * 2 + 0] = edge ? 0x1111 : 0x2221;
+        tile[row * 2 + 1] = edge ? 0x1111 : 0x1222;
+    }
+
+    PAL_OBJ[1] = COLOR_WHITE;
+    PAL_OBJ[2] = COLOR_CYAN;
+}
+
+static void update_and_batch(int camera_x) {
+    sprite_set_camera(camera_x, 0);
+    sprite_begin();
+
+    for (int i = 0; i < SPRITE_COUNT; ++i) {
+        Mover* m = &movers[i];
+
+        m->x += m->dx;
+        m->y += m->dy;
+        if (m->x < 0 || m->x > WORLD_W - 8) m->dx = -m->dx;
+        if (m->y < 0 || m->y > SCREEN_H - 8) m->dy = -m->dy;
+
+        sprite_add(m->x, m->y, SPR_8x8, ATTR2_TILE(BASE_TILE) | ATTR2_PRIO(i & 3), 0, i >> 5);
+    }
+
+    sprite_end();
+}
+
+int main() {
+    fb_init(FB_MODE3, DCNT_OBJ | DCNT_OBJ_1D);
+    dbg_init();
+    irq_init();
+    sprite_init();
+    irq_set(IRQ_VBLANK, sprite_vblank);
+
+    load_tile();
+    for (int i = 0; i < SPRITE_COUNT; ++i) {
+        movers[i].x  = (int)(rng() % (WORLD_W - 8));
+        movers[i].y  = (int)(rng() % (SCREEN_H - 8));
+        movers[i].dx = (int)(rng() % 3) + 1;
+        movers[i].dy = (int)(rng() % 3) - 1;
+    }
+
+    dbg_printf("[bench_sprites] %d sprites, frame budget %d cycles", SPRITE_COUNT, CYCLES_PER_FRAME);
+
+    int camera_x = 0, camera_dx = 1;
+    u32 total = 0, worst = 0;
+    u32 frames = 0;
+
+    while (1) {
+        camera_x += camera_dx;
+        if (camera_x <= 0 || camera_x >= WORLD_W - SCREEN_W) camera_dx = -camera_dx;
+
+        cycle_counter_start();
+        update_and_batch(camera_x);
+        u32 cycles = cycle_counter_read();
+
+        total += cycles;
+        if (cycles > worst) worst = cycles;
+
+        if (++frames == REPORT_FRAMES) {
+            const SpriteStats* st = sprite_stats();
+            u32 avg = total / REPORT_FRAMES;
+
+            dbg_printf("avg %6lu  max %6lu cycles (%lu.%lu%% of frame)  visible %u culled %u dropped %u",
+                       (unsigned long)avg, (unsigned long)worst,
+                       (unsigned long)(avg * 100 / CYCLES_PER_FRAME),
+                       (unsigned long)(avg * 1000 / CYCLES_PER_FRAME % 10),
+                       st->visible, st->culled, st->dropped);
+            total  = 0;
+            worst  = 0;
+            frames = 0;
+        }
+
+        vblank_wait();
+    }
+
+    return 0;
+}
@@ -0,0 +1,130 @@
+// bg_stream.c
+// Mode 0 큰 맵 스트리밍 데모: 256x192칸(2048x1536 픽셀) 맵을 64x64 링 버퍼로 스크롤
+// ---------------------------------------------------------
+// 빌드: make test TARGET=bg_stream   /   make host TARGET=bg_stream
+//
+// 방향키: 카메라 직접 이동 (B를 누르고 있으면 빠르게)
+// 키를 안 누르면 카메라가 맵 위를 8자 모양으로 돌아다님 (대각선 / 음수 방향 / 맵 바깥 포함)
+//
+// 매 프레임 화면에 보이는 31x21칸이 맵과 같은지 VRAM을 다시 읽어 검사하고,
+// 60프레임마다 업로드한 칸 수와 불일치 수를 로그로 출력합니다.
+
+#include "gba.h"
+#include "bg.h"
+#include "fixmath.h"
+#include "debug.h"
+
+#define MAP_W 256
+#define MAP_H 192
+
+// 맵은 원래 ROM에 두지만, 데모에서는 시작할 때 생성 (96KB -> EWRAM)
+static u16   world_data[MAP_W * MAP_H] EWRAM_BSS;
+static BgMap world = { world_data, MAP_W, MAP_H, SE_TILE(4) };
+
+static BgStreamer stream;
+
+// 4bpp 타일 5개 (0: 풀, 1: 길, 2: 벽, 3: 물, 4: 맵 바깥)
+// 타일 한 줄 = u32 하나 (픽셀 8개 x 4비트, 왼쪽 픽셀이 하위 니블)
+static u32 tiles[5 * 8];
+
+static const u16 palette[6] = {
+    RGB(0, 0, 0), RGB(6, 18, 6), RGB(20, 17, 10), RGB(12, 12, 14), RGB(6, 10, 26), RGB(3, 3, 5),
+};
+
+static void make_tiles(void) {
+    for (int y = 0; y < 8; ++y) {
+        tiles[0 * 8 + y] = ((y & 3) == 1) ? 0x11111211u : 0x11111111u;
+        tiles[1 * 8 + y] = 0x22222222u;
+        tiles[2 * 8 + y] = (y == 0 || y == 4) ? 0x00000000u : ((y < 4) ? 0x33330333u : 0x03333333u);
+        tiles[3 * 8 + y] = ((y & 3) == 0) ? 0x44444444u : 0x44114444u;
+        tiles[4 * 8 + y] = 0x55555555u;
+    }
+}
+
+// 격자 모양 길 + 군데군데 연못 + 가장자리 벽 (어디를 봐도 위치가 구분되게)
+static void make_world(void) {
+    for (int y = 0; y < MAP_H; ++y) {
+        for (int x = 0; x < MAP_W; ++x) {
+            u16 t = SE_TILE(0);
+
+            if (x % 16 == 0 || y % 12 == 0)                  t = SE_TILE(1);
+            if (((x / 16) + (y / 12)) % 5 == 2 && x % 16 > 4
+                && x % 16 < 12 && y % 12 > 3 && y % 12 < 9) t = SE_TILE(3);
+            if (x == 0 || y == 0 || x == MAP_W - 1 || y == MAP_H - 1) t = SE_TILE(2);
+
+            world_data[y * MAP_W + x] = t;
+        }
+    }
+}
+
+// 화면에 보이는 창이 맵과 같은지 (링 버퍼 주소 계산 / 열·행 순서 검사용)
+static int verify_window(void) {
+    int bad = 0;
+
+    for (int y = stream.tile_y; y < stream.tile_y + BG_STREAM_ROWS; ++y) {
+        for (int x = stream.tile_x; x < stream.tile_x + BG_STREAM_COLS; ++x) {
+            int rx = x & 63, ry = y & 63;
+            u16 got = SCREENBLOCK(stream.sbb + (rx >> 5) + ((ry >> 5) << 1))[(ry & 31) * 32 + (rx & 31)];
+            u16 want = (x < 0 || y < 0 || x >= MAP_W || y >= MAP_H) ? world.fill : world_data[y * MAP_W + x];
+            if (got != want) ++bad;
+        }
+    }
+    return bad;
+}
+
+int main() {
+    dbg_init();
+    make_tiles();
+    make_world();
+
+    bg_init();
+    int cbb = bg_alloc_charblock();
+    int sbb = bg_alloc_screenblocks(4);
+
+    bg_load_palette(palette, 6);
+    bg_load_tiles(cbb, tiles, sizeof(tiles));
+    bg_setup(0, cbb, sbb, BG_4BPP | BG_SIZE_64x64);
+
+    int cam_x = 40, cam_y = 40;
+    bg_stream_init(&stream, 0, sbb, &world, cam_x, cam_y);
+    REG_DISPCNT = MODE_0 | BG0_ENABLE;
+
+    dbg_printf("[bg_stream] cbb %d, sbb %d..%d, map %dx%d tiles", cbb, sbb, sbb + 3, MAP_W, MAP_H);
+
+    u32 frame = 0, uploaded = 0, peak = 0, bad = 0;
+    int t = 0;
+
+    while (1) {
+        sync_vblank();
+        bg_stream_update(&stream, cam_x, cam_y);
+
+        uploaded += stream.uploaded;
+        if (stream.uploaded > peak) peak = stream.uploaded;
+        bad += (u32)verify_window();
+
+        if (++frame % 60 == 0) {
+            dbg_printf("[bg_stream] cam (%d, %d)  uploaded %lu entries / 60 frames (peak %lu)  mismatches %lu",
+                       cam_x, cam_y, (unsigned long)uploaded, (unsigned long)peak, (unsigned long)bad);
+            uploaded = 0;
+            peak     = 0;
+        }
+
+        // 다음 프레임 카메라
+        u16 keys  = ~REG_KEYINPUT;
+        int speed = (keys & KEY_B) ? 6 : 2;
+
+        if (keys & (KEY_LEFT | KEY_RIGHT | KEY_UP | KEY_DOWN)) {
+            if (keys & KEY_LEFT)  cam_x -= speed;
+            if (keys & KEY_RIGHT) cam_x += speed;
+            if (keys & KEY_UP)    cam_y -= speed;
+            if (keys & KEY_DOWN)  cam_y += speed;
+        } else {
+            // 8자 궤도: 중심 (맵 가운데), 반지름은 맵보다 약간 크게 -> 바깥 칸도 지나감
+            ++t;
+            cam_x = (MAP_W * 8 - SCREEN_W) / 2 + FIX_TO_INT(fix_sin(t) * 1100);
+            cam_y = (MAP_H * 8 - SCREEN_H) / 2 + FIX_TO_INT(fix_sin(t * 2) * 820);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,186 @@
+// fx_check.c
+// fx.h 자체 검사: 상수 / 변환 / 곱셈 / 나눗셈 결과와 디버그 빌드의 오버플로 처리(포화 또는 트랩)
+// ---------------------------------------------------------
+// 빌드: make test TARGET=fx_check   /   make host TARGET=fx_check
+//       make host TARGET=fx_check DEBUG=1                     (트랩 검사)
+//       make host TARGET=fx_check DEBUG=1 FX_CHECK=saturate   (포화 검사 + fx_report)
+//
+// 1. 모든 빌드: 범위 안의 값으로 알려진 결과를 비교 (릴리스에서는 평범한 정수 연산과 같아야 함)
+// 2. FX_SATURATE: 넘친 결과가 타입의 최댓값 / 최솟값으로 잘리는지 확인하고 fx_report로 횟수를 출력
+// 3. DEBUG_MODE (트랩): 마지막 단계에서 일부러 넘침 -> FATAL 로그 다음 멈춤.
+//    PC 빌드는 트랩 신호를 받아 돌아오고, 로그 한 줄이 기대한 메시지와 같은지까지 비교합니다.
+//    GBA에서는 여기서 멈추는 것이 정상 (mGBA는 FATAL에서 일시정지)
+
+#include "gba.h"
+#include "fx.h"
+#include "irq.h"
+#include "debug.h"
+
+#if defined(GBA_HOST) && defined(DEBUG_MODE) && !defined(FX_SATURATE)
+#include <setjmp.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#endif
+
+static int checks, failed;
+
+static void expect(const char* what, s32 got, s32 want) {
+    ++checks;
+    if (got == want) return;
+    ++failed;
+    dbg_printf("[fx_check] FAIL: %s = %ld (want %ld)", what, (long)got, (long)want);
+}
+
+// ---------------------------------------------------------
+// 1. 범위 안의 연산 (모든 빌드)
+// ---------------------------------------------------------
+static void check_values(void) {
+    // 상수 (반올림 포함)
+    expect("FX8(1.5)",    FX8(1.5),    384);
+    expect("FX8(-0.5)",   FX8(-0.5),   -128);
+    expect("FX12(0.25)",  FX12(0.25),  1024);
+    expect("FX16(0.01)",  FX16(0.01),  655);
+    expect("FX8S(-2.0)",  FX8S(-2.0),  -512);
+
+    // 정수 <-> 고정 소수점 (to_int는 내림)
+    expect("fx8_from_int(3)",      fx8_from_int(3),       768);
+    expect("fx16_from_int(-7)",    fx16_from_int(-7),     -7 << 16);
+    expect("fx8_to_int(1.5)",      fx8_to_int(FX8(1.5)),  1);
+    expect("fx8_to_int(-1.5)",     fx8_to_int(FX8(-1.5)), -2);
+
+    // 포맷 변환 (시프트만)
+    expect("fx8_to_fx16(1.5)",     fx8_to_fx16(FX8(1.5)),      FX16(1.5));
+    expect("fx16_to_fx8(0.01)",    fx16_to_fx8(FX16(0.01)),    2);
+    expect("fx12_to_fx8(-0.25)",   fx12_to_fx8(FX12(-0.25)),   FX8(-0.25));
+    expect("fx8s_to_fx12(-2)",     fx8s_to_fx12(FX8S(-2.0)),   FX12(-2.0));
+    expect("fx8_to_fx8s(100.5)",   fx8_to_fx8s(FX8(100.5)),    FX8S(100.5));
+
+    // 덧셈 / 뺄셈 / 곱셈 / 나눗셈
+    expect("fx8s_add(100,20)",     fx8s_add(FX8S(100.0), FX8S(20.0)),  FX8S(120.0));
+    expect("fx8_sub(1,2.5)",       fx8_sub(FX8(1.0), FX8(2.5)),        FX8(-1.5));
+    expect("fx8_mul(1.5,2.25)",    fx8_mul(FX8(1.5), FX8(2.25)),       FX8(3.375));
+    expect("fx12_mul(-0.5,0.5)",   fx12_mul(FX12(-0.5), FX12(0.5)),    FX12(-0.25));
+    expect("fx16_mul(300,100)",    fx16_mul(FX16(300.0), FX16(100.0)), FX16(30000.0));
+    expect("fx16_div(1,3)",        fx16_div(FX16(1.0), FX16(3.0)),     21845);
+    expect("fx8_div(-9,2)",        fx8_div(FX8(-9.0), FX8(2.0)),       FX8(-4.5));
+    expect("fx8s_div(1,4)",        fx8s_div(FX8S(1.0), FX8S(4.0)),     FX8S(0.25));
+}
+
+// ---------------------------------------------------------
+// 2. 포화 (DEBUG=1 FX_CHECK=saturate)
+// ---------------------------------------------------------
+#if defined(DEBUG_MODE) && defined(FX_SATURATE)
+static void check_saturate(void) {
+    expect("sat fx8s_add(100,100)",  fx8s_add(FX8S(100.0), FX8S(100.0)),  32767);
+    expect("sat fx8s_sub(-100,100)", fx8s_sub(FX8S(-100.0), FX8S(100.0)), -32768);
+    expect("sat fx16_from_int(40000)", fx16_from_int(40000),              2147483647);
+    expect("sat fx16_mul(-300,200)", fx16_mul(FX16(-300.0), FX16(200.0)), -2147483647 - 1);
+    expect("sat fx8_to_fx8s(200)",   fx8_to_fx8s(FX8(200.0)),             32767);
+
+    // 포화 뒤에도 범위 안의 연산은 그대로
+    expect("after sat fx8s_add(1,1)", fx8s_add(FX8S(1.0), FX8S(1.0)), FX8S(2.0));
+
+    fx_report(); // 기대: fx8s 3회, fx16 2회
+}
+#endif
+
+// ---------------------------------------------------------
+// 3. 트랩 (DEBUG=1, 마지막 단계)
+// ---------------------------------------------------------
+#if defined(DEBUG_MODE) && !defined(FX_SATURATE)
+
+#define TRAP_MESSAGE "[fx] overflow in fx8s_add: 51200 (range -32768 ~ 32767)\n"
+
+#ifdef GBA_HOST
+static sigjmp_buf trap_jump;
+
+static void on_trap(int sig) {
+    (void)sig;
+    siglongjmp(trap_jump, 1);
+}
+#endif
+
+static void check_trap(void) {
+    dbg_printf("[fx_check] trap: fx8s_add(FX8S(100), FX8S(100)) should log FATAL and stop");
+
+#ifdef GBA_HOST
+    // 트랩 신호를 받아 돌아오고, 그 사이 stdout에 나온 로그를 파이프로 받아 비교
+    int pipe_fd[2], saved = dup(STDOUT_FILENO);
+    fflush(stdout);
+    if (saved < 0 || pipe(pipe_fd) != 0) {
+        dbg_printf("[fx_check] FAIL: no pipe for trap capture");
+        ++failed;
+        return;
+    }
+    dup2(pipe_fd[1], STDOUT_FILENO);
+
+    signal(SIGILL, on_trap);
+    signal(SIGTRAP, on_trap);
+
+    volatile bool trapped = false;
+    if (sigsetjmp(trap_jump, 1) == 0) {
+        volatile fx8s a = FX8S(100.0);
+        fx8s_add(a, a);
+    } else {
+        trapped = true;
+    }
+
+    signal(SIGILL, SIG_DFL);
+    signal(SIGTRAP, SIG_DFL);
+    fflush(stdout);
+    dup2(saved, STDOUT_FILENO);
+    close(saved);
+    close(pipe_fd[1]);
+
+    char    log[256];
+    ssize_t n = read(pipe_fd[0], log, sizeof(log) - 1);
+    close(pipe_fd[0]);
+    log[n > 0 ? n : 0] = '\0';
+
+    ++checks;
+    if (!trapped || strcmp(log, TRAP_MESSAGE) != 0) {
+        ++failed;
+        dbg_printf("[fx_check] FAIL: trap %s, log \"%s\"", trapped ? "fired" : "did not fire", log);
+    } else {
+        log[n - 1] = '\0'; // 줄바꿈 빼고 출력
+        dbg_printf("[fx_check] trap ok: %s", log);
+    }
+#else
+    volatile fx8s a = FX8S(100.0);
+    fx8s_add(a, a); // 여기서 멈춤
+    ++failed;       // 돌아왔다면 트랩이 없다는 뜻
+    dbg_printf("[fx_check] FAIL: overflow did not trap");
+#endif
+}
+
+#endif
+
+int main() {
+    dbg_init();
+    irq_init();
+
+#if !defined(DEBUG_MODE)
+    dbg_printf("[fx_check] release build: range checks compiled out");
+#elif defined(FX_SATURATE)
+    dbg_printf("[fx_check] debug build: saturate on overflow");
+#else
+    dbg_printf("[fx_check] debug build: trap on overflow");
+#endif
+
+    check_values();
+#if defined(DEBUG_MODE) && defined(FX_SATURATE)
+    check_saturate();
+#endif
+#if defined(DEBUG_MODE) && !defined(FX_SATURATE)
+    check_trap();
+#endif
+
+    if (failed) dbg_printf("[fx_check] %d of %d checks FAILED", failed, checks);
+    else        dbg_printf("[fx_check] %d checks ok", checks);
+
+    for (;;) vblank_wait();
+
+    return 0;
+}
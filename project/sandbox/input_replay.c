@@ -0,0 +1,99 @@
+// input_replay.c
+// 입력 모듈 데모: 눌림/반복 감지 + RLE 녹화 -> 재생 결과 비교 + Stop 절전
+// ---------------------------------------------------------
+// 빌드: make test TARGET=input_replay   /   make host TARGET=input_replay
+//
+// 1) 녹화: 처음 REC_FRAMES 프레임 동안 키 입력으로 '커서'를 움직이며 녹화
+//    - 방향키: key_repeat (누르고 있으면 20프레임 뒤부터 4프레임마다 한 칸)
+//    - A: key_hit 횟수, B: key_released 횟수
+// 2) 재생: 상태를 처음으로 되돌리고 녹화한 테이프로 같은 로직을 다시 실행
+//    -> 두 결과가 같아야 정상. 테이프는 호스트 키 스크립트 형식으로 로그에 출력됨
+// 3) 이후 SELECT를 누르면 화면을 끄고 Stop, L + R을 함께 누르면 깨어남
+//
+// 호스트 예)  printf '0 UP\n10 RIGHT\n50\n60 A\n62\n70 DOWN A B\n75 DOWN\n90\n' > /tmp/keys.txt
+//             printf '260 SELECT\n262\n300 L\n310 L R\n315\n' >> /tmp/keys.txt
+//             HOST_FRAMES=400 HOST_KEYS=/tmp/keys.txt ./build/host/input_replay
+
+#include "gba.h"
+#include "input.h"
+#include "fb.h"
+#include "draw.h"
+#include "irq.h"
+#include "debug.h"
+
+#define REC_FRAMES 120
+#define TAPE_CAP   64
+
+typedef struct {
+    int cx, cy;     // 커서 (8픽셀 칸)
+    int hits;       // A 눌림 횟수
+    int releases;   // B 뗌 횟수
+} DemoState;
+
+static KeyRun tape[TAPE_CAP];
+
+static void step(DemoState* s) {
+    if (key_repeat(KEY_LEFT))  --s->cx;
+    if (key_repeat(KEY_RIGHT)) ++s->cx;
+    if (key_repeat(KEY_UP))    --s->cy;
+    if (key_repeat(KEY_DOWN))  ++s->cy;
+    if (key_hit(KEY_A))        ++s->hits;
+    if (key_released(KEY_B))   ++s->releases;
+
+    s->cx &= 31;
+    s->cy &= 15;
+}
+
+static void draw_cursor(const DemoState* s, u16 color) {
+    draw_rect(s->cx * 7 + 4, s->cy * 9 + 4, 6, 8, color);
+}
+
+static void run(DemoState* s, const char* label) {
+    DemoState init = { 0, 0, 0, 0 };
+
+    *s = init;
+    for (int f = 0; f < REC_FRAMES; ++f) {
+        vblank_wait();
+        draw_cursor(s, COLOR_BLACK);
+        key_poll();
+        step(s);
+        draw_cursor(s, COLOR_WHITE);
+    }
+    dbg_printf("[input] %s: cursor (%d, %d), A hits %d, B releases %d", label, s->cx, s->cy, s->hits,
+               s->releases);
+}
+
+int main() {
+    fb_init(FB_MODE3, 0);
+    dbg_init();
+    irq_init();
+    fb_clear(COLOR_BLACK);
+
+    DemoState live, replay;
+
+    key_record_start(tape, TAPE_CAP);
+    run(&live, "record");
+    int runs = key_record_stop();
+
+    key_play_start(tape, runs);
+    run(&replay, "replay");
+
+    bool same = live.cx == replay.cx && live.cy == replay.cy && live.hits == replay.hits
+                && live.releases == replay.releases;
+    dbg_printf("[input] %d runs for %d frames (%d bytes), replay %s", runs, REC_FRAMES,
+               runs * (int)sizeof(KeyRun), same ? "matches" : "DIFFERS");
+    key_tape_log(tape, runs, key_record_frame());
+
+    while (1) {
+        vblank_wait();
+        key_poll();
+
+        if (key_hit(KEY_SELECT)) {
+            dbg_printf("[input] sleeping (L + R to wake)");
+            key_sleep(KEY_L | KEY_R);
+            dbg_printf("[input] woke up");
+        }
+    }
+
+    return 0;
+}
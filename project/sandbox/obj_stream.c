@@ -0,0 +1,269 @@
+// obj_stream.c
+// OBJ 타일 할당기 데모: 스프라이트마다 현재 프레임만 VRAM에 두고, 바뀔 때만 VBlank에 업로드
+// ---------------------------------------------------------
+// 빌드: make test TARGET=obj_stream   /   make host TARGET=obj_stream
+//
+// Mode 3(비트맵)이라 OBJ 타일은 512 ~ 1023번, 16KB만 쓸 수 있습니다.
+// 애니메이션 세트 6종(32x32 x 8프레임 3종, 16x16 x 8프레임 2종, 64x32 x 4프레임 1종)을
+// 전부 올리면 576타일이라 이것만으로도 들어가지 않으므로, 액터마다 objtile_stream으로 한 프레임 분량만 잡습니다.
+// 총알 8x8 x 4프레임 시트는 objtile_sheet로 공유 (총알이 몇 발이든 VRAM에는 한 벌)
+//
+// 20프레임마다 액터 몇 개를 없애고 다른 크기로 새로 만들어 빈자리를 조각내고,
+// 매 프레임 objtile_compact(OBJTILE_COMPACT_STEP)로 조금씩 모읍니다.
+// VBlank 업로드 직후에는 모든 블록의 VRAM 내용을 원본 프레임과 비교해 불일치를 셉니다.
+// 120프레임마다 objtile_report + 프레임당 업로드 바이트 / 조각 모으기 비용을 출력.
+
+#include "gba.h"
+#include "fb.h"
+#include "irq.h"
+#include "sprite.h"
+#include "objtile.h"
+#include "timer.h"
+#include "debug.h"
+
+#define ACTORS   20
+#define BULLETS  32
+#define CHURN    20
+#define REPORT   120
+
+// ---------------------------------------------------------
+// 애니메이션 데이터 (원래는 ROM 에셋, 데모에서는 시작할 때 생성)
+// ---------------------------------------------------------
+typedef struct {
+    SpriteSize size;
+    int        w, h;
+    int        tiles;   // 한 프레임의 4bpp 타일 수
+    int        frames;
+    const u32* data;
+} Anim;
+
+static u32 hero_data[3][8 * 16 * 8] EWRAM_BSS;  // 32x32: 16타일 x 32바이트 = u32 128개 / 프레임
+static u32 imp_data[2][8 * 4 * 8] EWRAM_BSS;    // 16x16
+static u32 boss_data[4 * 32 * 8] EWRAM_BSS;     // 64x32
+static u32 bullet_data[4 * 1 * 8];              // 8x8, 프레임 4개 = 시트 하나
+
+#define ANIM_COUNT 6
+static Anim anims[ANIM_COUNT];
+
+static void make_frames(u32* dst, int tiles, int frames, u32 seed) {
+    for (int i = 0; i < tiles * frames * 8; ++i) {
+        seed   = seed * 1664525u + 1013904223u;
+        dst[i] = seed ^ (u32)(i / (tiles * 8)) * 0x11111111u; // 프레임마다 다른 색 조합
+    }
+}
+
+static void make_anims(void) {
+    static const SpriteSize sizes[ANIM_COUNT] = { SPR_32x32, SPR_32x32, SPR_32x32, SPR_16x16, SPR_16x16, SPR_64x32 };
+    const u32* data[ANIM_COUNT] = { hero_data[0], hero_data[1], hero_data[2], imp_data[0], imp_data[1], boss_data };
+
+    for (int a = 0; a < ANIM_COUNT; ++a) {
+        Anim* an   = &anims[a];
+        an->size   = sizes[a];
+        an->w      = (a < 3) ? 32 : (a < 5) ? 16 : 64;
+        an->h      = (a < 5) ? an->w : 32;
+        an->tiles  = (an->w / 8) * (an->h / 8);
+        an->frames = (a < 5) ? 8 : 4;
+        an->data   = data[a];
+        make_frames((u32*)an->data, an->tiles, an->frames, 0x9E37u * (u32)(a + 1));
+    }
+    make_frames(bullet_data, 1, 4, 0xB011E7u);
+
+    for (int i = 1; i < 16; ++i) PAL_OBJ[i] = RGB(i * 2, 31 - i * 2, (i * 7) & 31);
+}
+
+// ---------------------------------------------------------
+// 액터 / 총알
+// ---------------------------------------------------------
+typedef struct {
+    int  anim;      // -1 = 빈 자리
+    int  h;         // objtile 핸들
+    int  x, y, dx, dy;
+    int  frame, rate;
+} Actor;
+
+typedef struct {
+    bool alive;
+    int  h;
+    int  x, y, dx;
+} Bullet;
+
+static Actor  actors[ACTORS];
+static Bullet bullets[BULLETS];
+static u32    rng_state = 0x5EED;
+
+static u32 rng(void) {
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return rng_state >> 16;
+}
+
+static void spawn_actor(Actor* a) {
+    int    k  = (int)(rng() % ANIM_COUNT);
+    Anim*  an = &anims[k];
+
+    a->h = objtile_stream(an->data, an->tiles, an->frames, 0);
+    if (a->h < 0) { // 자리가 없으면 다음 번에 다시 (조각 모으기가 빈자리를 모을 때까지)
+        a->anim = -1;
+        return;
+    }
+    a->anim  = k;
+    a->x     = (int)(rng() % (SCREEN_W - 64));
+    a->y     = (int)(rng() % (SCREEN_H - 32));
+    a->dx    = (rng() & 1) ? 1 : -1;
+    a->dy    = (rng() & 1) ? 1 : -1;
+    a->frame = 0;
+    a->rate  = 3 + (int)(rng() % 6);
+}
+
+static void kill_actor(Actor* a) {
+    objtile_release(a->h);
+    a->anim = -1;
+}
+
+static void fire_bullet(Bullet* b, int x, int y) {
+    b->h = objtile_sheet(bullet_data, 4, 0); // 처음 한 발만 실제로 올라가고 나머지는 참조만
+    if (b->h < 0) return;
+    b->alive = true;
+    b->x     = x;
+    b->y     = y;
+    b->dx    = (rng() & 1) ? 3 : -3;
+}
+
+// ---------------------------------------------------------
+// 검사: VBlank 업로드 직후 VRAM == 원본 프레임
+// ---------------------------------------------------------
+static int compare(int h, const u32* src, int tiles) {
+    const volatile u32* v = (const volatile u32*)(TILE_OBJ + objtile_tile(h) * 16);
+    for (int i = 0; i < tiles * 8; ++i) {
+        if (v[i] != src[i]) return 1;
+    }
+    return 0;
+}
+
+static int verify(void) {
+    int bad = 0;
+    for (int i = 0; i < ACTORS; ++i) {
+        Actor* a = &actors[i];
+        if (a->anim < 0) continue;
+        const Anim* an = &anims[a->anim];
+        bad += compare(a->h, an->data + a->frame * an->tiles * 8, an->tiles);
+    }
+    for (int i = 0; i < BULLETS; ++i) {
+        if (bullets[i].alive) bad += compare(bullets[i].h, bullet_data, 4);
+    }
+    return bad;
+}
+
+int main() {
+    dbg_init();
+    irq_init();
+    cycle_counter_start();
+
+    fb_init(FB_MODE3, DCNT_OBJ | DCNT_OBJ_1D);
+    fb_clear(RGB(3, 4, 10));
+    sprite_init();
+    objtile_init(OBJTILE_BITMAP_FIRST);
+    make_anims();
+
+    int upfront = 0;
+    for (int a = 0; a < ANIM_COUNT; ++a) upfront += anims[a].tiles * anims[a].frames;
+    dbg_printf("[obj_stream] all frames up front: %d tiles, OBJ VRAM in bitmap mode: %d tiles",
+               upfront, OBJTILE_TILES - OBJTILE_BITMAP_FIRST);
+
+    for (int i = 0; i < ACTORS; ++i) spawn_actor(&actors[i]);
+
+    u32 bad = 0, checked = 0, skipped = 0, compact_cycles = 0, compacted = 0, bytes0 = 0;
+
+    for (int frame = 1;; ++frame) {
+        vblank_wait();
+        sprite_vblank();
+        u32 deferred = objtile_stats()->deferred;
+        objtile_vblank();
+
+        // 한도 때문에 미룬 업로드가 있으면 이번 프레임 스트림 검사는 의미가 없음
+        if (objtile_stats()->deferred == deferred) {
+            bad += verify();
+            ++checked;
+        } else {
+            ++skipped;
+        }
+
+        // 1. 애니메이션 + 이동
+        for (int i = 0; i < ACTORS; ++i) {
+            Actor* a = &actors[i];
+            if (a->anim < 0) {
+                if (frame % CHURN == 0) spawn_actor(a);
+                continue;
+            }
+
+            const Anim* an = &anims[a->anim];
+            if (frame % a->rate == 0) {
+                a->frame = (a->frame + 1) % an->frames;
+                objtile_set_frame(a->h, a->frame);
+            }
+
+            a->x += a->dx;
+            a->y += a->dy;
+            if (a->x < 0 || a->x > SCREEN_W - an->w) a->dx = -a->dx;
+            if (a->y < 0 || a->y > SCREEN_H - an->h) a->dy = -a->dy;
+
+            if ((rng() & 15) == 0) {
+                for (int b = 0; b < BULLETS; ++b) {
+                    if (!bullets[b].alive) {
+                        fire_bullet(&bullets[b], a->x + an->w / 2, a->y + an->h / 2);
+                        break;
+                    }
+                }
+            }
+        }
+
+        for (int b = 0; b < BULLETS; ++b) {
+            Bullet* bl = &bullets[b];
+            if (!bl->alive) continue;
+            bl->x += bl->dx;
+            if (bl->x < -8 || bl->x > SCREEN_W) {
+                objtile_release(bl->h);
+                bl->alive = false;
+            }
+        }
+
+        // 2. 교체: 액터 3개를 없앰 (빈 자리는 다음 CHURN 프레임에 다른 크기로 다시 생김)
+        if (frame % CHURN == 0) {
+            for (int n = 0; n < 3; ++n) {
+                Actor* a = &actors[rng() % ACTORS];
+                if (a->anim >= 0) kill_actor(a);
+            }
+        }
+
+        // 3. 배치 (타일 번호는 매 프레임 objtile_tile로)
+        sprite_begin();
+        for (int i = 0; i < ACTORS; ++i) {
+            Actor* a = &actors[i];
+            if (a->anim < 0) continue;
+            sprite_add(a->x, a->y, anims[a->anim].size, ATTR2_TILE(objtile_tile(a->h)), 0, 1);
+        }
+        for (int b = 0; b < BULLETS; ++b) {
+            Bullet* bl = &bullets[b];
+            if (bl->alive) sprite_add(bl->x, bl->y, SPR_8x8, ATTR2_TILE(objtile_tile(bl->h) + (frame >> 2 & 3)), 0, 0);
+        }
+        sprite_end();
+
+        // 4. 조각 모으기 한 단계
+        u32 t0 = cycle_counter_read();
+        compacted      += objtile_compact(OBJTILE_COMPACT_STEP);
+        compact_cycles += cycle_counter_read() - t0;
+
+        if (frame % REPORT == 0) {
+            const ObjTileStats* s = objtile_stats();
+            objtile_report();
+            dbg_printf("[obj_stream] %lu B uploaded/frame (peak %lu), compaction %lu tiles in %lu cycles/frame, frames checked %lu (skipped %lu), mismatches %lu",
+                       (unsigned long)((s->total_bytes - bytes0) / REPORT), (unsigned long)s->peak_frame_bytes,
+                       (unsigned long)compacted, (unsigned long)(compact_cycles / REPORT),
+                       (unsigned long)checked, (unsigned long)skipped, (unsigned long)bad);
+            bytes0         = s->total_bytes;
+            compacted      = 0;
+            compact_cycles = 0;
+        }
+    }
+
+    return 0;
+}
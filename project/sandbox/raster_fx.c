@@ -0,0 +1,189 @@
+// raster_fx.c
+// 스캔라인 효과 데모: 패럴랙스 띠 + 물결 (BG0 스크롤) / 하늘 그라데이션 <-> 원형 윈도우
+// ---------------------------------------------------------
+// 빌드: make test TARGET=raster_fx   /   make host TARGET=raster_fx
+//
+// 채널 0 (DMA0): BG0HOFS + BG0VOFS (폭 2)
+//   - 위 80줄: 띠마다 다른 속도로 가로 스크롤 (패럴랙스)
+//   - 아래 80줄: 가로/세로 사인파 (물결)
+// 채널 1 (DMA2): 180프레임마다 교대
+//   - 하늘: 배경색(PAL_BG[0]) 줄별 그라데이션. 타일의 투명 픽셀로 보임
+//   - 스포트라이트: WIN0H를 줄마다 바꿔서 원형 창 (창 밖은 BG0이 안 보임)
+// 60프레임마다 테이블 만드는 데 쓴 CPU 사이클과 DMA 비용 보고를 출력합니다.
+//
+// 호스트 빌드에서는 매 프레임 가상 스캔라인을 한 줄씩 진행하며
+// 레지스터에 들어간 값이 만든 테이블과 줄마다 같은지도 검사합니다.
+
+#include "gba.h"
+#include "bg.h"
+#include "raster.h"
+#include "fixmath.h"
+#include "irq.h"
+#include "timer.h"
+#include "debug.h"
+
+#define WATER_Y   80
+#define SPOT_R    56
+
+static u32 tiles[2 * 8];
+
+static const RasterBand bands[] = {
+    { 0, 0 }, { 16, 0 }, { 40, 0 }, { 64, 0 },
+};
+
+static int  scroll_ch, second_ch;
+static bool spotlight = false;
+
+#ifdef GBA_HOST
+// 이번 프레임에 만든 값 (호스트 검사용)
+static u32 expect_scroll[RASTER_LINES];
+static u16 expect_second[RASTER_LINES];
+static u32 line_errors = 0;
+#endif
+
+static void setup_bg(void) {
+    // 타일 0: 투명(배경색이 보임), 타일 1: 세로 줄무늬 (스크롤이 눈에 보이게)
+    for (int y = 0; y < 8; ++y) {
+        tiles[0 * 8 + y] = 0;
+        tiles[1 * 8 + y] = 0x22110011u;
+    }
+
+    bg_init();
+    int cbb = bg_alloc_charblock();
+    int sbb = bg_alloc_screenblocks(1);
+
+    PAL_BG[1] = RGB(28, 28, 31);
+    PAL_BG[2] = RGB(4, 10, 20);
+    bg_load_tiles(cbb, tiles, sizeof(tiles));
+    bg_setup(0, cbb, sbb, BG_4BPP | BG_SIZE_32x32);
+
+    for (int i = 0; i < 32 * 32; ++i) SCREENBLOCK(sbb)[i] = SE_TILE(((i >> 5) + (i & 31)) % 3 == 0 ? 1 : 0);
+}
+
+// 원 안쪽의 가로 구간: 왼쪽 << 8 | 오른쪽 (창이 없는 줄은 0 = 빈 창)
+static void build_spotlight(int cx, int cy) {
+    u16* p = raster_lane(second_ch, 0);
+
+    for (int y = 0; y < RASTER_LINES; ++y) {
+        int dy = y - cy;
+        int dx = 0;
+        int rr = SPOT_R * SPOT_R - dy * dy;
+
+        if (rr < 0) { p[y] = 0; continue; }
+        while ((dx + 1) * (dx + 1) <= rr) ++dx;
+
+        int l = cx - dx, r = cx + dx;
+        if (l < 0) l = 0;
+        if (r > SCREEN_W) r = SCREEN_W;
+        p[y] = (u16)WIN_H(l, r);
+    }
+}
+
+static void switch_second(void) {
+    raster_close(second_ch);
+    spotlight = !spotlight;
+
+    if (spotlight) {
+        second_ch = raster_open(&REG_WIN0H, 1);
+        PAL_BG[0] = RGB(0, 0, 0);
+        REG_WIN0V   = WIN_V(0, SCREEN_H);
+        REG_WININ   = WIN_BG(0);
+        REG_WINOUT  = 0;
+        REG_DISPCNT = MODE_0 | BG0_ENABLE | DCNT_WIN0;
+    } else {
+        second_ch = raster_open(&PAL_BG[0], 1);
+        REG_DISPCNT = MODE_0 | BG0_ENABLE;
+    }
+}
+
+static void build(int frame) {
+    RasterBand moving[4];
+
+    // 띠마다 다른 속도 (먼 띠 = 느리게)
+    for (int i = 0; i < 4; ++i) {
+        moving[i]       = bands[i];
+        moving[i].value = (s16)(frame * (i + 1) / 4);
+    }
+
+    raster_begin();
+
+    raster_fill(scroll_ch, 0, 0);
+    raster_fill(scroll_ch, 1, 0);
+    raster_bands(scroll_ch, 0, moving, 4);
+    raster_wave(scroll_ch, 0, WATER_Y, RASTER_LINES, 6, 40, frame * 6);
+    raster_wave(scroll_ch, 1, WATER_Y, RASTER_LINES, 2, 24, frame * 10);
+
+    if (spotlight) {
+        build_spotlight(SCREEN_W / 2 + FIX_TO_INT(fix_sin(frame * 3) * 70), SCREEN_H / 2);
+    } else {
+        raster_gradient(second_ch, 0, 0, WATER_Y, RGB(2, 4, 12), RGB(28, 20, 14));
+        raster_gradient(second_ch, 0, WATER_Y, RASTER_LINES, RGB(4, 14, 20), RGB(0, 2, 8));
+    }
+
+#ifdef GBA_HOST
+    const u16* s = raster_lane(scroll_ch, 0);
+    const u16* c = raster_lane(second_ch, 0);
+    for (int y = 0; y < RASTER_LINES; ++y) {
+        expect_scroll[y] = s[y * 2] | ((u32)s[y * 2 + 1] << 16);
+        expect_second[y] = c[y];
+    }
+#endif
+
+    raster_commit();
+}
+
+#ifdef GBA_HOST
+// vblank_wait 직후(160번 줄)부터 다음 VDraw 159번 줄까지 한 줄씩 진행하며 레지스터 확인
+static void verify_frame(void) {
+    volatile u16* second = spotlight ? &REG_WIN0H : &PAL_BG[0];
+
+    while (REG_VCOUNT != 0) { }
+    for (int y = 0; y < RASTER_LINES; ++y) {
+        if (y > 0) (void)REG_VCOUNT;
+        u32 scroll = REG_BGHOFS(0) | ((u32)REG_BGVOFS(0) << 16);
+        if (scroll != expect_scroll[y] || *second != expect_second[y]) ++line_errors;
+    }
+}
+#endif
+
+int main() {
+    dbg_init();
+    irq_init();
+    setup_bg();
+
+    scroll_ch = raster_open(&REG_BGHOFS(0), 2);
+    second_ch = raster_open(&PAL_BG[0], 1);
+    REG_DISPCNT = MODE_0 | BG0_ENABLE;
+    irq_set(IRQ_VBLANK, raster_vblank);
+
+    u32 build_cycles = 0, worst = 0;
+
+    for (int frame = 0;; ++frame) {
+        if (frame > 0 && frame % 180 == 0) switch_second();
+
+        cycle_counter_start();
+        build(frame);
+        u32 cycles = cycle_counter_read();
+
+        build_cycles += cycles;
+        if (cycles > worst) worst = cycles;
+
+        vblank_wait();
+#ifdef GBA_HOST
+        verify_frame();
+#endif
+
+        if (frame % 60 == 59) {
+            dbg_printf("[raster_fx] %s: table build avg %lu / max %lu cycles (CPU, outside VDraw)",
+                       spotlight ? "spotlight" : "sky", (unsigned long)(build_cycles / 60), (unsigned long)worst);
+            raster_report();
+#ifdef GBA_HOST
+            dbg_printf("[raster_fx] per-line register mismatches so far: %lu", (unsigned long)line_errors);
+#endif
+            build_cycles = 0;
+            worst        = 0;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,248 @@
+// sched_demo.c
+// 스케줄러 + 상태 스택 데모: 타이틀 -> 플레이(+일시정지 push/pop) -> 타이틀 ... 반복
+// ---------------------------------------------------------
+// 빌드: make test TARGET=sched_demo   /   make host TARGET=sched_demo
+//
+// 플레이 상태에 들어갈 때마다 태스크 세 개를 띄웁니다.
+//   stream (HIGH)  : 2프레임마다 맵 한 줄 분량 복사 (TASK_WAIT_FRAMES)
+//   ai     (NORMAL): 프레임당 한 번 에이전트 64개 갱신 (TASK_NEXT_FRAME)
+//   unpack (LOW)   : 16KB 레벨 데이터를 512바이트씩 풀기 (TASK_YIELD, 남는 예산을 다 씀)
+// 플레이 첫 프레임과 100프레임마다 update가 일부러 예산의 대부분을 써서(스파이크) 낮은 태스크가 밀리는 것을 보여 줌.
+// 레벨 버퍼는 enter()에서 state_alloc으로 받고, 풀린 데이터는 끝나면 체크섬으로 검사합니다.
+// 120프레임마다 sched_report + 상태 전환 비용 / 아레나 사용량을 출력.
+
+#include "gba.h"
+#include "fb.h"
+#include "draw.h"
+#include "sched.h"
+#include "state.h"
+#include "irq.h"
+#include "debug.h"
+
+#define LEVEL_BYTES  (16 * 1024)
+#define UNPACK_CHUNK 512
+#define AGENTS       64
+#define REPORT       120
+
+// ---------------------------------------------------------
+// 압축 데이터 (RLE: [길이, 값] 쌍). 원래는 ROM 에셋, 데모에서는 시작할 때 생성
+// ---------------------------------------------------------
+static u8  packed[LEVEL_BYTES];
+static int packed_len;
+static u32 expected_sum;
+
+static void make_packed(void) {
+    u32 seed = 7, sum = 0;
+    int out  = 0;
+
+    packed_len = 0;
+    while (out < LEVEL_BYTES) {
+        seed = seed * 1664525u + 1013904223u;
+        int run = 1 + (int)((seed >> 24) & 31);
+        u8  val = (u8)(seed >> 8);
+        if (run > LEVEL_BYTES - out) run = LEVEL_BYTES - out;
+
+        packed[packed_len++] = (u8)run;
+        packed[packed_len++] = val;
+        for (int i = 0; i < run; ++i) sum = sum * 31 + val;
+        out += run;
+    }
+    expected_sum = sum;
+}
+
+// ---------------------------------------------------------
+// 태스크
+// ---------------------------------------------------------
+typedef struct {
+    u8* dst;
+    int in, out;      // 읽은 압축 바이트 / 쓴 바이트
+    int run;          // 지금 쌍에서 남은 길이
+    u8  val;
+    u32 start_frame;
+} Unpack;
+
+static TaskStatus unpack_task(Task* t, void* ctx) {
+    Unpack* u = ctx;
+
+    TASK_BEGIN(t);
+    while (u->out < LEVEL_BYTES) {
+        for (int n = 0; n < UNPACK_CHUNK && u->out < LEVEL_BYTES; ++n) {
+            if (u->run == 0) {
+                u->run = packed[u->in++];
+                u->val = packed[u->in++];
+            }
+            u->dst[u->out++] = u->val;
+            --u->run;
+        }
+        TASK_YIELD(t);
+    }
+
+    {
+        u32 sum = 0;
+        for (int i = 0; i < LEVEL_BYTES; ++i) sum = sum * 31 + u->dst[i];
+        dbg_printf("[sched_demo] unpack: %d bytes in %lu frames (%u slices), checksum %s", LEVEL_BYTES,
+                   (unsigned long)(irq_frame_count() - u->start_frame), t->slices + 1, sum == expected_sum ? "ok" : "FAIL");
+    }
+    TASK_END(t);
+}
+
+typedef struct {
+    fixed x[AGENTS], y[AGENTS], vx[AGENTS], vy[AGENTS];
+    u32   ticks;
+} Agents;
+
+static TaskStatus ai_task(Task* t, void* ctx) {
+    Agents* a = ctx;
+
+    TASK_BEGIN(t);
+    for (;;) {
+        for (int i = 0; i < AGENTS; ++i) {
+            a->x[i] += a->vx[i];
+            a->y[i] += a->vy[i];
+            if (a->x[i] < 0 || a->x[i] > INT_TO_FIX(SCREEN_W)) a->vx[i] = -a->vx[i];
+            if (a->y[i] < 0 || a->y[i] > INT_TO_FIX(SCREEN_H)) a->vy[i] = -a->vy[i];
+        }
+        ++a->ticks;
+        TASK_NEXT_FRAME(t);
+    }
+    TASK_END(t);
+}
+
+typedef struct {
+    u16 map[64 * 64];
+    int row;
+} Stream;
+
+static TaskStatus stream_task(Task* t, void* ctx) {
+    Stream* s = ctx;
+
+    TASK_BEGIN(t);
+    for (;;) {
+        for (int x = 0; x < 64; ++x) s->map[(s->row & 63) * 64 + x] = (u16)(s->row * 64 + x);
+        ++s->row;
+        TASK_WAIT_FRAMES(t, 2);
+    }
+    TASK_END(t);
+}
+
+// ---------------------------------------------------------
+// 상태
+// ---------------------------------------------------------
+extern const GameState title_state, play_state, pause_state;
+
+typedef struct {
+    int frames;
+} Title;
+
+static void title_enter(void* mem) {
+    (void)mem;
+    fb_clear(RGB(4, 4, 12));
+}
+
+static void title_update(void* mem) {
+    Title* s = mem;
+    if (++s->frames == 30) state_switch(&play_state);
+}
+
+typedef struct {
+    int     frames;
+    int     tasks[3];
+    Unpack  unpack;
+    Agents  agents;
+    Stream* stream;
+} Play;
+
+static void play_enter(void* mem) {
+    Play* s = mem;
+
+    s->unpack.dst         = state_alloc(LEVEL_BYTES);   // 레벨 버퍼: pop하면 같이 반환
+    s->unpack.start_frame = irq_frame_count();
+    s->stream             = state_alloc(sizeof(Stream));
+
+    for (int i = 0; i < AGENTS; ++i) {
+        s->agents.x[i]  = INT_TO_FIX(i * 3);
+        s->agents.y[i]  = INT_TO_FIX(i * 2);
+        s->agents.vx[i] = (i & 1) ? FIX_ONE : -FIX_ONE;
+        s->agents.vy[i] = (i & 2) ? FIX_ONE / 2 : -FIX_ONE / 2;
+    }
+
+    s->tasks[0] = sched_spawn(stream_task, s->stream, SCHED_HIGH, "stream");
+    s->tasks[1] = sched_spawn(ai_task, &s->agents, SCHED_NORMAL, "ai");
+    s->tasks[2] = sched_spawn(unpack_task, &s->unpack, SCHED_LOW, "unpack");
+
+    fb_clear(RGB(2, 10, 4));
+}
+
+static void play_leave(void* mem) {
+    Play* s = mem;
+    for (int i = 0; i < 3; ++i) sched_kill(s->tasks[i]);
+}
+
+static void play_update(void* mem) {
+    Play* s = mem;
+    ++s->frames;
+
+    // 스파이크: 예산을 거의 다 쓸 때까지 일부러 바쁨 (충돌 처리가 몰린 프레임 흉내)
+    if (s->frames % 100 == 1) {
+        u32 total = sched_remaining() + 1;
+        while (sched_remaining() > total / 64) { }
+    }
+
+    if (s->frames == 200) state_push(&pause_state);
+    if (s->frames == 400) state_switch(&title_state);
+}
+
+static void play_render(void* mem) {
+    Play* s = mem;
+    int   i = s->frames & (AGENTS - 1);
+    draw_rect(FIX_TO_INT(s->agents.x[i]) & 0xFF, FIX_TO_INT(s->agents.y[i]) % 150, 4, 4, COLOR_GOLD);
+}
+
+typedef struct {
+    int frames;
+} Pause;
+
+static void pause_update(void* mem) {
+    Pause* s = mem;
+    if (++s->frames == 40) state_pop();
+}
+
+static void pause_render(void* mem) {
+    (void)mem;
+    draw_rect(100, 70, 40, 20, COLOR_WHITE);
+}
+
+// 일시정지: 아래(플레이)도 그리지만 update는 멈춤 -> 태스크는 계속 돌아감
+const GameState title_state = { "title", sizeof(Title), title_enter, NULL, title_update, NULL, 0 };
+const GameState play_state  = { "play", sizeof(Play), play_enter, play_leave, play_update, play_render, 0 };
+const GameState pause_state = { "pause", sizeof(Pause), NULL, NULL, pause_update, pause_render, STATE_RENDER_BELOW };
+
+int main() {
+    dbg_init();
+    irq_init();
+    sched_init();
+#ifdef GBA_HOST
+    sched_set_budget(SCHED_BUDGET / 256); // PC는 GBA보다 수십 배 빠르므로 예산을 줄여야 조각 나누기가 보임
+#endif
+    fb_init(FB_MODE3, 0);
+    make_packed();
+
+    state_init();
+    state_push(&title_state);
+
+    for (;;) {
+        sched_frame();
+
+        const SchedStats* ss = sched_stats();
+        if (ss->frames % REPORT == 0) {
+            const StateStats* st = state_stats();
+            sched_report();
+            dbg_printf("[sched_demo] state %s (depth %d), transitions %lu, transition peak %lu cycles, arena %lu / peak %lu bytes, failures %lu",
+                       state_top() ? state_top()->name : "-", state_depth(), (unsigned long)st->transitions,
+                       (unsigned long)st->peak_cycles, (unsigned long)st->arena_used,
+                       (unsigned long)st->arena_peak, (unsigned long)st->failures);
+        }
+    }
+
+    return 0;
+}
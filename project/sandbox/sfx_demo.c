@@ -0,0 +1,114 @@
+// sfx_demo.c
+// 색 효과 데모: 페이드 인/아웃(검정, 흰색), 모자이크 왕복, 배경색 쪽으로 반투명 틴트
+// ---------------------------------------------------------
+// 빌드: make test TARGET=sfx_demo   /   make host TARGET=sfx_demo
+//
+// Mode 3 그림은 처음에 한 번만 그리고, 이후의 모든 전환은 레지스터 4개로만 합니다.
+// 비교용으로 시작할 때 "소프트웨어 페이드 한 프레임"(38,400픽셀을 EVY 8로 다시 칠하기)의
+// 사이클을 재고, 240프레임마다 효과에 든 CPU 사이클과 프레임당 레지스터 쓰기 수를 출력합니다.
+//
+// 진행: 검정에서 나타남 -> 모자이크 0 -> 12 -> 0 -> 배경색 틴트 -> 흰색으로 사라졌다 나타남 -> 검정으로
+
+#include "gba.h"
+#include "fb.h"
+#include "draw.h"
+#include "sfx.h"
+#include "irq.h"
+#include "timer.h"
+#include "debug.h"
+
+#define STEP_FRAMES 40
+#define REPORT      240
+#define STEPS       8
+
+static void draw_scene(void) {
+    for (int y = 0; y < SCREEN_H; y += 8) {
+        draw_rect(0, y, SCREEN_W, 8, RGB(4 + y / 8, 8, 20 - y / 10));
+    }
+    draw_circle_fill(60, 60, 36, COLOR_GOLD);
+    draw_triangle(INT_TO_FIX(120), INT_TO_FIX(140), INT_TO_FIX(170), INT_TO_FIX(40),
+                  INT_TO_FIX(220), INT_TO_FIX(140), COLOR_GREEN);
+    draw_rect(20, 110, 80, 30, COLOR_RED);
+    draw_line(0, 0, SCREEN_W - 1, SCREEN_H - 1, COLOR_WHITE);
+}
+
+// 비교: 같은 밝기 효과를 CPU로 한 프레임 만드는 비용 (픽셀마다 채널 3개를 흰색 쪽으로)
+static u32 software_fade_cycles(int evy) {
+    u16* p  = fb.back;
+    u32  t0 = cycle_counter_read();
+
+    for (int i = 0; i < SCREEN_W * SCREEN_H; ++i) {
+        u16 c = p[i];
+        int r = c & 31, g = (c >> 5) & 31, b = (c >> 10) & 31;
+        r += ((31 - r) * evy) >> 4;
+        g += ((31 - g) * evy) >> 4;
+        b += ((31 - b) * evy) >> 4;
+        p[i] = RGB(r, g, b);
+    }
+    return cycle_counter_read() - t0;
+}
+
+// 단계가 끝날 때마다 다음 효과 시작
+static void next_step(int step) {
+    switch (step % STEPS) {
+        case 0: sfx_fade_in(BLD_BLACK, STEP_FRAMES);                     break;
+        case 1: sfx_mosaic_ramp(12, 0, STEP_FRAMES, SFX_SMOOTH);         break;
+        case 2: sfx_mosaic_ramp(0, 0, STEP_FRAMES, SFX_SMOOTH);          break;
+        case 3: sfx_alpha(BLD_BG(2), BLD_BD, SFX_EV_MAX, 0);
+                sfx_alpha_ramp(6, 10, STEP_FRAMES, SFX_EASE_OUT);       break;
+        case 4: sfx_alpha_ramp(SFX_EV_MAX, 0, STEP_FRAMES, SFX_EASE_IN); break;
+        case 5: sfx_fade_out(BLD_WHITE, STEP_FRAMES);                    break;
+        case 6: sfx_fade_in(BLD_WHITE, STEP_FRAMES);                     break;
+        case 7: sfx_fade_out(BLD_BLACK, STEP_FRAMES);                    break;
+    }
+}
+
+int main() {
+    dbg_init();
+    irq_init();
+    cycle_counter_start();
+
+    fb_init(FB_MODE3, 0);
+    REG_BGCNT(2) |= BG_MOSAIC;      // 비트맵 화면(BG2)에 모자이크 허용
+    PAL_BG[0] = RGB(2, 6, 24);      // 배경색: 반투명 틴트의 아래 레이어
+
+    draw_scene();
+    u32 soft = software_fade_cycles(8);
+    draw_scene();                   // 소프트웨어 페이드로 바뀐 그림 되돌리기
+    dbg_printf("[sfx_demo] software fade, one frame: %d pixel writes, %lu cycles (%lu%% of frame)",
+               SCREEN_W * SCREEN_H, (unsigned long)soft, (unsigned long)(soft * 100 / CYCLES_PER_FRAME));
+
+    sfx_init();
+    sfx_fade(BLD_ALL, BLD_BLACK, SFX_EV_MAX, SFX_EV_MAX, 0, SFX_LINEAR); // 검은 화면에서 시작
+    next_step(0);
+
+    int step  = 0;
+    int hold  = 0;
+    u32 spent = 0, writes = sfx_stats()->reg_writes;
+
+    for (int frame = 1;; ++frame) {
+        vblank_wait();
+
+        u32 t0 = cycle_counter_read();
+        sfx_vblank();
+        sfx_update();
+        spent += cycle_counter_read() - t0;
+
+        // 단계 사이에 20프레임씩 멈춤
+        if (!sfx_busy() && ++hold >= 20) {
+            hold = 0;
+            next_step(++step);
+        }
+
+        if (frame % REPORT == 0) {
+            u32 w = sfx_stats()->reg_writes - writes;
+            dbg_printf("[sfx_demo] step %d: effects %lu cycles/frame, %lu.%02lu register writes/frame, BLDY %u MOSAIC 0x%04x",
+                       step % STEPS, (unsigned long)(spent / REPORT), (unsigned long)(w / REPORT),
+                       (unsigned long)(w * 100 / REPORT % 100), REG_BLDY, REG_MOSAIC);
+            spent  = 0;
+            writes = sfx_stats()->reg_writes;
+        }
+    }
+
+    return 0;
+}
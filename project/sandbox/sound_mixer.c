@@ -0,0 +1,239 @@
+// sound_mixer.c
+// 사운드 믹서 데모 + 비용 측정: 채널 수별 믹싱 사이클, 이후 짧은 곡 반복
+// ---------------------------------------------------------
+// 빌드: make test TARGET=sound_mixer   /   make host TARGET=sound_mixer
+// 호스트: HOST_FRAMES=900 HOST_WAV=mix.wav ./build/host/sound_mixer  -> mix.wav로 결과 확인
+//
+// [0. 검사] 알려진 입력으로 믹서 결과를 비교하고 불일치를 FAIL로 출력
+//           - 커널: 누적 값(볼륨 / 좌우 볼륨 / 반 속도) + 8비트 클리핑
+//           - 채널: 한 번 재생 샘플이 끝나면 꺼지고 뒤는 무음, 반복 샘플은 버퍼 경계를 넘어 이어짐
+//           - 스테레오: 왼쪽으로 팬하면 B가 무음, 가운데 사인파는 양쪽 모두 소리가 남
+// [1. 측정] 반복 샘플을 0, 1, 2, 4, 8채널 켜 두고 각각 60프레임 동안 평균 믹싱 비용을 잼
+//           -> 고정 비용 + 채널당 비용으로 늘어나는지 확인 (처음 60프레임은 1채널 440Hz 사인파)
+// [2. 곡]   사인파 베이스 + 사각파 멜로디(좌우로 팬) + 노이즈 드럼(한 번 재생)
+//
+// 샘플은 시작할 때 만듭니다: 사인파(fixmath 사인표), 사각파, 감쇠하는 노이즈
+
+#include "gba.h"
+#include "sound.h"
+#include "fixmath.h"
+#include "irq.h"
+#include "timer.h"
+#include "debug.h"
+
+#define WAVE_LEN   64
+#define DRUM_LEN   2400
+#define WINDOW     60
+
+static s8 sine_data[WAVE_LEN];
+static s8 square_data[WAVE_LEN];
+static s8 drum_data[DRUM_LEN];
+
+// 한 주기 = 64샘플이므로 rate = 64 x 440이면 pitch 1.0 = A4 (440Hz)
+static const SoundSample sine   = { sine_data, WAVE_LEN, 0, WAVE_LEN * 440 };
+static const SoundSample square = { square_data, WAVE_LEN, 0, WAVE_LEN * 440 };
+static const SoundSample drum   = { drum_data, DRUM_LEN, SOUND_NO_LOOP, SOUND_RATE };
+
+// 반음 비율 2^(n/12) (fixed)
+static const fixed semitone[12] = { 256, 271, 287, 304, 323, 342, 362, 384, 406, 431, 456, 483 };
+
+static fixed note_pitch(int n) {
+    // n = A4 기준 반음 수 (-24 ~ +23)
+    int oct = (n + 48) / 12 - 4;
+    fixed p = semitone[(n + 48) % 12];
+    return (oct >= 0) ? p << oct : p >> -oct;
+}
+
+static void make_samples(void) {
+    u32 lfsr = 0xACE1u;
+
+    for (int i = 0; i < WAVE_LEN; ++i) {
+        int s = fix_sin_q12(i * (FIX_ANGLE_FULL / WAVE_LEN)) >> 5;
+        sine_data[i]   = (s8)(s > 127 ? 127 : s);
+        square_data[i] = (s8)(i < WAVE_LEN / 2 ? 48 : -48);
+    }
+    for (int i = 0; i < DRUM_LEN; ++i) {
+        lfsr = (lfsr >> 1) ^ (-(lfsr & 1u) & 0xB400u);
+        int env = 127 - i * 127 / DRUM_LEN;
+        drum_data[i] = (s8)(((int)(lfsr & 0xFF) - 128) * env >> 7);
+    }
+}
+
+// ---------------------------------------------------------
+// 0. 검사
+// ---------------------------------------------------------
+#define ONE_SHOT_LEN 100
+
+static s8 ramp_data[ONE_SHOT_LEN];
+
+// rate = SOUND_RATE -> 출력 샘플 하나에 원본 샘플 하나 (inc = 1.0)
+static const SoundSample ramp = { ramp_data, ONE_SHOT_LEN, SOUND_NO_LOOP, SOUND_RATE };
+static const SoundSample loop = { square_data, WAVE_LEN, 0, SOUND_RATE };
+
+static int checks, failed;
+
+static void expect(const char* what, int index, s32 got, s32 want) {
+    ++checks;
+    if (got == want) return;
+    if (++failed <= 8) dbg_printf("[sound_mixer] FAIL: %s [%d] = %ld (want %ld)", what, index, (long)got, (long)want);
+}
+
+static bool silent(const s8* buf) {
+    for (int i = 0; i < SOUND_BUF_LEN; ++i) {
+        if (buf[i]) return false;
+    }
+    return true;
+}
+
+static void mix_frame(void) {
+    vblank_wait();
+    sound_update();
+}
+
+static void check_kernels(void) {
+    static const s8 data[8] = { 10, -20, 30, -40, 127, -128, 1, -1 };
+    s32 acc[16] = { 0 };
+    s8  l[8], r[8];
+
+    // 스테레오: 왼쪽 볼륨 64(1.0), 오른쪽 32(0.5)
+    u32 pos = sound_mix_stereo(acc, 8, data, 0, 1 << SOUND_POS_SHIFT, 64, 32);
+    expect("stereo end pos", 0, (s32)pos, 8 << SOUND_POS_SHIFT);
+    for (int i = 0; i < 8; ++i) {
+        expect("stereo acc L", i, acc[i * 2],     data[i] * 64);
+        expect("stereo acc R", i, acc[i * 2 + 1], data[i] * 32);
+    }
+
+    sound_clip_stereo(l, r, acc, 8);
+    for (int i = 0; i < 8; ++i) {
+        expect("clip L", i, l[i], data[i]);
+        expect("clip R", i, r[i], data[i] >> 1);
+        expect("acc cleared", i, acc[i * 2] | acc[i * 2 + 1], 0);
+    }
+
+    // 모노 반 속도 (샘플마다 두 번) + 같은 채널 두 번 누적 -> 범위 밖은 잘림
+    pos = sound_mix_mono(acc, 16, data, 0, 1 << (SOUND_POS_SHIFT - 1), 64);
+    sound_mix_mono(acc, 16, data, 0, 1 << (SOUND_POS_SHIFT - 1), 64);
+    expect("mono end pos", 0, (s32)pos, 8 << SOUND_POS_SHIFT);
+
+    s8 out[16];
+    sound_clip_mono(out, acc, 16);
+    for (int i = 0; i < 16; ++i) {
+        int want = data[i / 2] * 2;
+        expect("mono clip", i, out[i], want > 127 ? 127 : want < -128 ? -128 : want);
+    }
+}
+
+static void check_voices(void) {
+    for (int i = 0; i < ONE_SHOT_LEN; ++i) ramp_data[i] = (s8)(i - 50);
+
+    // 한 번 재생: 왼쪽으로 팬, 볼륨 64 -> A = 원본, B = 무음, 100샘플 뒤는 무음
+    int v = sound_play(&ramp, SOUND_VOL_MAX, SOUND_PAN_LEFT, FIX_ONE);
+    mix_frame();
+
+    const s8* a = sound_last_mix(false);
+    for (int i = 0; i < SOUND_BUF_LEN; ++i) expect("one-shot A", i, a[i], i < ONE_SHOT_LEN ? ramp_data[i] : 0);
+    expect("one-shot B silent", 0, silent(sound_last_mix(true)), true);
+    expect("one-shot ended", v, sound_playing(v), false);
+
+    // 반복: 버퍼가 바뀌어도 위치가 이어짐 (k번째 버퍼의 i번 = data[(k * BUF_LEN + i) % 64])
+    v = sound_play(&loop, SOUND_VOL_MAX, SOUND_PAN_CENTER, FIX_ONE);
+    for (int k = 0; k < 3; ++k) {
+        mix_frame();
+        const s8* l = sound_last_mix(false);
+        const s8* r = sound_last_mix(true);
+        for (int i = 0; i < SOUND_BUF_LEN; ++i) {
+            s8 want = square_data[(k * SOUND_BUF_LEN + i) % WAVE_LEN];
+            expect("loop L", k * SOUND_BUF_LEN + i, l[i], want);
+            expect("loop R", k * SOUND_BUF_LEN + i, r[i], want);
+        }
+    }
+    expect("loop still playing", v, sound_playing(v), true);
+    sound_stop(v);
+
+    // 스테레오: 가운데 440Hz 사인파는 양쪽 모두 소리가 남
+    v = sound_play(&sine, 48, SOUND_PAN_CENTER, FIX_ONE);
+    mix_frame();
+    expect("center sine L audible", 0, silent(sound_last_mix(false)), false);
+    expect("center sine R audible", 0, silent(sound_last_mix(true)), false);
+    sound_stop(v);
+
+    // 모두 멈추면 무음
+    mix_frame();
+    expect("stopped A silent", 0, silent(sound_last_mix(false)), true);
+    expect("stopped B silent", 0, silent(sound_last_mix(true)), true);
+}
+
+// ---------------------------------------------------------
+// 1. 채널 수별 비용
+// ---------------------------------------------------------
+static void measure(void) {
+    static const int counts[] = { 1, 0, 2, 4, 8 };
+    u32 avg[9] = { 0 };
+
+    for (int c = 0; c < 5; ++c) {
+        int n = counts[c];
+        int v[SOUND_VOICES];
+
+        for (int i = 0; i < n; ++i) v[i] = sound_play(&sine, 64 / (n ? n : 1), i * 128 / 8, note_pitch(i * 4));
+
+        u32 total = 0;
+        for (int f = 0; f < WINDOW; ++f) {
+            vblank_wait();
+            sound_update();
+            total += sound_stats()->mix_cycles;
+        }
+        avg[n] = total / WINDOW;
+        for (int i = 0; i < n; ++i) sound_stop(v[i]);
+
+        dbg_printf("[sound_mixer] %d voices: avg %lu cycles/frame", n, (unsigned long)avg[n]);
+    }
+
+    dbg_printf("[sound_mixer] base %lu + %lu cycles/voice (from 0 -> 8 voices), 8 voices = %lu.%lu%% of frame",
+               (unsigned long)avg[0], (unsigned long)((avg[8] - avg[0]) / 8),
+               (unsigned long)(avg[8] * 100 / CYCLES_PER_FRAME), (unsigned long)(avg[8] * 1000 / CYCLES_PER_FRAME % 10));
+}
+
+// ---------------------------------------------------------
+// 2. 곡
+// ---------------------------------------------------------
+static const s8 melody[16] = { 0, 3, 7, 12, 10, 7, 3, 5, 0, 3, 7, 15, 14, 12, 10, 7 };
+static const s8 bass[4]    = { -24, -19, -21, -17 };
+
+int main() {
+    dbg_init();
+    irq_init();
+    make_samples();
+
+    sound_init(true);
+    irq_set(IRQ_VBLANK, sound_vblank);
+
+    check_kernels();
+    check_voices();
+    if (failed) dbg_printf("[sound_mixer] %d of %d checks FAILED", failed, checks);
+    else        dbg_printf("[sound_mixer] %d checks ok", checks);
+
+    measure();
+
+    int bass_voice = sound_play(&sine, 40, SOUND_PAN_CENTER, note_pitch(bass[0]));
+    int lead_voice = -1;
+
+    for (int frame = 0;; ++frame) {
+        vblank_wait();
+        sound_update();
+
+        // 8프레임마다 한 박자
+        if (frame % 8 == 0) {
+            int step = (frame / 8) & 15;
+
+            if (lead_voice >= 0) sound_stop(lead_voice);
+            lead_voice = sound_play(&square, 24, 32 + (step & 7) * 8, note_pitch(melody[step]));
+
+            if ((step & 3) == 0) sound_set_pitch(bass_voice, note_pitch(bass[step >> 2]));
+            if ((step & 3) == 2) sound_play(&drum, 48, SOUND_PAN_CENTER, FIX_ONE);
+        }
+
+        if (frame % 120 == 119) sound_report();
+    }
+
+    return 0;
+}
@@ -0,0 +1,154 @@
+// text_hud.c
+// 글자 출력 데모: 60Hz로 바뀌는 HUD 4줄 + 매 프레임 한 줄씩 새로 쓰는 글 14줄 (캐시 교체 유도)
+// ---------------------------------------------------------
+// 빌드: make test TARGET=text_hud   /   make host TARGET=text_hud
+//
+// 매 프레임 모든 필드의 화면(맵 -> 타일)을 글꼴로 직접 그린 그림과 비교해 불일치를 세고,
+// 60프레임마다 프레임당 VRAM 쓰기 바이트(HUD만 / 전체), 캐시 적중/업로드/교체 수를 출력합니다.
+// 비교 기준: 같은 필드들을 매번 통째로 다시 올리면 (칸 수 x 32바이트)
+
+#include "gba.h"
+#include "bg.h"
+#include "text.h"
+#include "fixed.h"
+#include "irq.h"
+#include "timer.h"
+#include "debug.h"
+
+#define HUD_LINES  4
+#define PAGE_LINES 14
+#define PAGE_TOP   6
+#define COLS       28
+#define REPORT     60
+
+static TextField hud[HUD_LINES];
+static TextField page[PAGE_LINES];
+static int       text_cbb, text_sbb;
+
+static const char* const words[] = {
+    "the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog", "Wizard", "casts",
+    "FIREBALL", "at", "Ogre", "for", "42", "damage!", "HP", "MP", "(crit)", "level-up",
+};
+#define WORD_COUNT (int)(sizeof(words) / sizeof(words[0]))
+
+static u32 seed = 12345;
+static int rnd(int n) {
+    seed = seed * 1664525u + 1013904223u;
+    return (int)((seed >> 16) % (u32)n);
+}
+
+// 필드 하나를 글꼴로 직접 그려 VRAM과 비교. 반환값: 틀린 타일 줄 수
+static int verify(const TextField* f) {
+    u32 ref[TXT_COLS_MAX][8] = { { 0 } };
+    int x = 0;
+
+    for (int i = 0; i < f->len; ++i) {
+        int g = f->text[i] - TXT_FONT_FIRST;
+        int w = txt_font_width[g];
+
+        for (int r = 0; r < 8; ++r) {
+            for (int col = 0; col < w - 1; ++col) {
+                int px = x + col;
+                if ((txt_font_bits[g][r] >> col & 1) && px < f->cols * 8) {
+                    ref[px >> 3][r] |= (u32)TXT_INK << ((px & 7) * 4);
+                }
+            }
+        }
+        x += w;
+    }
+
+    int bad = 0;
+    for (int c = 0; c < f->cols; ++c) {
+        u16 se = SCREENBLOCK(text_sbb)[f->ty * 32 + f->tx + c];
+        const volatile u32* tile = (const volatile u32*)CHARBLOCK(text_cbb) + SE_TILE(se) * 8;
+
+        if ((se >> 12) != f->pal) ++bad;
+        for (int r = 0; r < 8; ++r) {
+            if (tile[r] != ref[c][r]) ++bad;
+        }
+    }
+    return bad;
+}
+
+static void new_line(char* buf, int size) {
+    int n = 0;
+    buf[0] = '\0';
+    while (n < size - 10) {
+        int m = txt_format(buf + n, size - n, "%s ", words[rnd(WORD_COUNT)]);
+        if (txt_width(buf) > COLS * 8) break;
+        n += m;
+    }
+}
+
+int main() {
+    dbg_init();
+    irq_init();
+    cycle_counter_start();
+
+    REG_DISPCNT = MODE_0 | BG0_ENABLE;
+    bg_init();
+    text_cbb = bg_alloc_charblock();
+    text_sbb = bg_alloc_screenblocks(1);
+    txt_init(0, text_cbb, text_sbb, BG_PRIO(0));
+
+    PAL_BG[0] = RGB(2, 3, 8);
+    txt_color(0, COLOR_WHITE);
+    txt_color(1, COLOR_GOLD);
+    txt_color(2, RGB(12, 24, 12));
+
+    for (int i = 0; i < HUD_LINES; ++i)  txt_field_init(&hud[i], 1, 1 + i, COLS, i == 0 ? 1 : 0);
+    for (int i = 0; i < PAGE_LINES; ++i) txt_field_init(&page[i], 1, PAGE_TOP + i, COLS, 2);
+
+    txt_print(&hud[0], "text_hud: tile text engine");
+
+    fixed x = INT_TO_FIX(12), vx = FLOAT_TO_FIX(0.37);
+    fixed y = INT_TO_FIX(-3), vy = FLOAT_TO_FIX(-0.11);
+    u32   cost = 0, spent = 0, bad = 0, hud_bytes = 0;
+    u32   bytes0 = 0, hits0 = 0, uploads0 = 0, evict0 = 0;
+    char  line[TXT_FIELD_MAX + 1];
+
+    for (int frame = 1;; ++frame) {
+        vblank_wait();
+
+        u32 t0 = cycle_counter_read();
+
+        x += vx;
+        y += vy;
+        if (x > INT_TO_FIX(99) || x < INT_TO_FIX(-99)) vx = -vx;
+        if (y > INT_TO_FIX(99) || y < INT_TO_FIX(-99)) vy = -vy;
+
+        u32 b0 = txt_stats()->vram_bytes;
+        txt_printf(&hud[1], "FRAME %6d  TEXT %4lu cyc", frame, (unsigned long)cost);
+        txt_printf(&hud[2], "X %7.2f  Y %+7.2f", x, y);
+        txt_printf(&hud[3], "%s  tiles %3d", words[(frame / 30) % WORD_COUNT], txt_stats()->used);
+        hud_bytes += txt_stats()->vram_bytes - b0;
+
+        new_line(line, sizeof(line));
+        txt_print(&page[frame % PAGE_LINES], line);
+
+        cost   = cycle_counter_read() - t0;
+        spent += cost;
+
+        for (int i = 0; i < HUD_LINES; ++i)  bad += verify(&hud[i]);
+        for (int i = 0; i < PAGE_LINES; ++i) bad += verify(&page[i]);
+
+        if (frame % REPORT == 0) {
+            const TextStats* s = txt_stats();
+            dbg_printf("[text_hud] %lu cycles/frame, VRAM bytes/frame: HUD %lu, all %lu (full redraw %d), hits %lu, uploads %lu, evictions %lu, used %d, overflows %lu, mismatches %lu",
+                       (unsigned long)(spent / REPORT), (unsigned long)(hud_bytes / REPORT),
+                       (unsigned long)((s->vram_bytes - bytes0) / REPORT),
+                       (HUD_LINES + PAGE_LINES) * COLS * 32,
+                       (unsigned long)(s->hits - hits0), (unsigned long)(s->uploads - uploads0),
+                       (unsigned long)(s->evictions - evict0), s->used, (unsigned long)s->overflows,
+                       (unsigned long)bad);
+            spent     = 0;
+            hud_bytes = 0;
+            bytes0   = s->vram_bytes;
+            hits0    = s->hits;
+            uploads0 = s->uploads;
+            evict0   = s->evictions;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,192 @@
+// affine.c
+// 아핀 변환: 스프라이트 행렬 캐시 + BG2/BG3 레지스터 Shadow (include/affine.h 참고)
+// ---------------------------------------------------------
+
+#include "affine.h"
+#include "fixmath.h"
+#include "sprite.h"
+#include "bios.h"
+
+typedef struct {
+    u32   gen;      // 마지막으로 쓰인 프레임 (0 = 한 번도 안 쓴 칸)
+    s16   angle;
+    fixed zoom_x, zoom_y;
+} AffineSlot;
+
+static AffineSlot  slots[AFFINE_OBJ_SLOTS];
+static u32         generation = 0;
+static bool        use_bios   = false;
+static AffineStats stats;
+
+// 이번 프레임에 새로 생긴 칸 (affine_end에서 한꺼번에 계산)
+static u8 queue[AFFINE_OBJ_SLOTS];
+static int queued = 0;
+
+// BG2, BG3 레지스터 Shadow (REG_BGPA ~ REG_BGY 순서)
+static BgAffineDst bg_shadow[2];
+static u8          bg_dirty = 0;
+
+// 1 / 확대율 (8.8). 0은 원래 크기, 너무 작은 확대율은 s16 범위로 자름
+static inline int inverse_zoom(fixed zoom) {
+    if (zoom == 0) return FIX_ONE;
+
+    int inv = (FIX_ONE * FIX_ONE) / zoom;
+    if (inv > 0x7FFF) inv = 0x7FFF;
+    if (inv < -0x7FFF) inv = -0x7FFF;
+    return inv;
+}
+
+// ---------------------------------------------------------
+// 1. 행렬 계산
+// ---------------------------------------------------------
+void affine_rotscale(AffineMatrix* m, int angle, fixed zoom_x, fixed zoom_y) {
+    int sx  = inverse_zoom(zoom_x);
+    int sy  = inverse_zoom(zoom_y);
+    int sin = fix_sin_q12(angle), cos = fix_cos_q12(angle);
+
+    // BIOS ObjAffineSet과 같은 식 (화면 -> 텍스처 역행렬)
+    m->pa = (s16)((sx * cos) >> FIX_TRIG_SHIFT);
+    m->pb = (s16)(-(sx * sin) >> FIX_TRIG_SHIFT);
+    m->pc = (s16)((sy * sin) >> FIX_TRIG_SHIFT);
+    m->pd = (s16)((sy * cos) >> FIX_TRIG_SHIFT);
+}
+
+// ---------------------------------------------------------
+// 2. 스프라이트 행렬 캐시
+// ---------------------------------------------------------
+void affine_init(void) {
+    for (int i = 0; i < AFFINE_OBJ_SLOTS; ++i) slots[i].gen = 0;
+
+    generation = 0;
+    queued     = 0;
+    bg_dirty   = 0;
+}
+
+void affine_begin(void) {
+    ++generation;
+    queued         = 0;
+    stats.hits     = 0;
+    stats.misses   = 0;
+    stats.overflow = 0;
+    stats.live     = 0;
+}
+
+int affine_obj(int angle, fixed zoom_x, fixed zoom_y) {
+    angle &= FIX_ANGLE_MASK;
+
+    // 시작 칸 = 키 해시, 이후 선형 탐사. 지우는 일이 없으므로 빈 칸(gen 0)을 만나면 탐색 끝
+    u32 h     = (u32)angle * 0x9E37u + (u32)zoom_x * 0x85EBu + (u32)zoom_y * 0xC2B3u;
+    int start = (int)((h ^ (h >> 11)) & (AFFINE_OBJ_SLOTS - 1));
+    int reuse = -1;
+
+    for (int n = 0; n < AFFINE_OBJ_SLOTS; ++n) {
+        int         i = (start + n) & (AFFINE_OBJ_SLOTS - 1);
+        AffineSlot* s = &slots[i];
+
+        if (s->gen == 0) {
+            if (reuse < 0) reuse = i;
+            break;
+        }
+        if (s->angle == angle && s->zoom_x == zoom_x && s->zoom_y == zoom_y) {
+            if (s->gen != generation) {
+                s->gen = generation;
+                ++stats.live;
+            }
+            ++stats.hits;
+            return i;
+        }
+        if (reuse < 0 && s->gen != generation) reuse = i; // 지난 프레임에만 쓰인 칸
+    }
+
+    if (reuse < 0) {
+        ++stats.overflow;
+        return -1;
+    }
+
+    AffineSlot* s = &slots[reuse];
+    s->gen    = generation;
+    s->angle  = (s16)angle;
+    s->zoom_x = zoom_x;
+    s->zoom_y = zoom_y;
+    queue[queued++] = (u8)reuse;
+    ++stats.misses;
+    ++stats.live;
+    return reuse;
+}
+
+void affine_end(void) {
+    AffineMatrix m[AFFINE_OBJ_SLOTS];
+
+    if (queued == 0) return;
+
+    if (use_bios) {
+        // SWI 한 번으로 전부: offset 2 = 빽빽한 {pa, pb, pc, pd} 배열
+        ObjAffineSrc src[AFFINE_OBJ_SLOTS];
+        for (int i = 0; i < queued; ++i) {
+            const AffineSlot* s = &slots[queue[i]];
+            src[i].sx    = (s16)inverse_zoom(s->zoom_x);
+            src[i].sy    = (s16)inverse_zoom(s->zoom_y);
+            src[i].alpha = (u16)(s->angle << 7); // 512단계 -> 0 ~ 0xFFFF
+            src[i].pad   = 0;
+        }
+        bios_obj_affine_set(src, m, queued, 2);
+    } else {
+        for (int i = 0; i < queued; ++i) {
+            const AffineSlot* s = &slots[queue[i]];
+            affine_rotscale(&m[i], s->angle, s->zoom_x, s->zoom_y);
+        }
+    }
+
+    for (int i = 0; i < queued; ++i) sprite_set_matrix(queue[i], m[i].pa, m[i].pb, m[i].pc, m[i].pd);
+    queued = 0;
+}
+
+void affine_use_bios(bool on) {
+    use_bios = on;
+}
+
+const AffineStats* affine_stats(void) {
+    return &stats;
+}
+
+// ---------------------------------------------------------
+// 3. 배경
+// ---------------------------------------------------------
+void affine_bg_set(int bg, fixed tex_x, fixed tex_y, int scr_x, int scr_y, int angle, fixed zoom_x, fixed zoom_y) {
+    if (bg < 2 || bg > 3) return;
+
+    BgAffineDst* d = &bg_shadow[bg - 2];
+
+    if (use_bios) {
+        BgAffineSrc src = { tex_x, tex_y, (s16)scr_x, (s16)scr_y, (s16)inverse_zoom(zoom_x),
+                            (s16)inverse_zoom(zoom_y), (u16)((angle & FIX_ANGLE_MASK) << 7), 0 };
+        bios_bg_affine_set(&src, d, 1);
+    } else {
+        AffineMatrix m;
+        affine_rotscale(&m, angle, zoom_x, zoom_y);
+
+        // 화면 (0, 0)이 읽을 텍스처 위치 (20.8) = 중심 - 행렬 x 화면 중심
+        d->pa = m.pa;
+        d->pb = m.pb;
+        d->pc = m.pc;
+        d->pd = m.pd;
+        d->x  = tex_x - (m.pa * scr_x + m.pb * scr_y);
+        d->y  = tex_y - (m.pc * scr_x + m.pd * scr_y);
+    }
+    bg_dirty |= (u8)(1 << (bg - 2));
+}
+
+void affine_vblank(void) {
+    for (int i = 0; i < 2; ++i) {
+        if (!(bg_dirty & (1 << i))) continue;
+
+        const BgAffineDst* d = &bg_shadow[i];
+        REG_BGPA(i + 2) = d->pa;
+        REG_BGPB(i + 2) = d->pb;
+        REG_BGPC(i + 2) = d->pc;
+        REG_BGPD(i + 2) = d->pd;
+        REG_BGX(i + 2)  = d->x;
+        REG_BGY(i + 2)  = d->y;
+    }
+    bg_dirty = 0;
+}
@@ -0,0 +1,172 @@
+// bg.c
+// 타일 배경: VRAM 블록 할당, BG 레지스터, 64x64 링 버퍼 맵 스트리밍 (include/bg.h 참고)
+// ---------------------------------------------------------
+
+#include "bg.h"
+#include "mem.h"
+
+static u32 sb_used = 0; // 스크린 블록 단위 사용 비트맵 (캐릭터 블록 하나 = 8비트)
+
+#define CB_MASK(n)  (0xFFu << ((n) * 8))
+
+// ---------------------------------------------------------
+// 1. 블록 할당 / 레지스터
+// ---------------------------------------------------------
+void bg_init(void) {
+    sb_used = 0;
+    for (int i = 0; i < BG_COUNT; ++i) bg_set_scroll(i, 0, 0);
+}
+
+int bg_alloc_charblock(void) {
+    for (int n = 0; n < BG_CHARBLOCKS; ++n) {
+        if ((sb_used & CB_MASK(n)) == 0) {
+            sb_used |= CB_MASK(n);
+            return n;
+        }
+    }
+    return -1;
+}
+
+void bg_free_charblock(int cbb) {
+    if (cbb < 0 || cbb >= BG_CHARBLOCKS) return;
+    sb_used &= ~CB_MASK(cbb);
+}
+
+int bg_alloc_screenblocks(int count) {
+    if (count <= 0 || count > BG_SCREENBLOCKS) return -1;
+
+    u32 mask = (count == 32) ? 0xFFFFFFFFu : ((1u << count) - 1);
+
+    for (int sbb = BG_SCREENBLOCKS - count; sbb >= 0; --sbb) {
+        if ((sb_used & (mask << sbb)) == 0) {
+            sb_used |= mask << sbb;
+            return sbb;
+        }
+    }
+    return -1;
+}
+
+void bg_free_screenblocks(int sbb, int count) {
+    if (sbb < 0 || count <= 0 || sbb + count > BG_SCREENBLOCKS) return;
+
+    u32 mask = (count == 32) ? 0xFFFFFFFFu : ((1u << count) - 1);
+    sb_used &= ~(mask << sbb);
+}
+
+void bg_setup(int bg, int cbb, int sbb, u16 flags) {
+    REG_BGCNT(bg) = (u16)(flags | BG_CBB(cbb) | BG_SBB(sbb));
+}
+
+void bg_set_scroll(int bg, int x, int y) {
+    REG_BGHOFS(bg) = (u16)(x & 0x1FF);
+    REG_BGVOFS(bg) = (u16)(y & 0x1FF);
+}
+
+void bg_load_tiles(int cbb, const void* tiles, u32 bytes) {
+    mem_copy32(CHARBLOCK(cbb), tiles, bytes / 4);
+}
+
+void bg_load_palette(const u16* palette, int count) {
+    mem_copy16(PAL_BG, palette, (u32)count);
+}
+
+// ---------------------------------------------------------
+// 2. 링 버퍼 주소 계산
+// ---------------------------------------------------------
+// 64x64 맵 = 스크린 블록 4개가 [좌상][우상][좌하][우하] 순서로 이어짐 (각 32x32)
+static inline volatile u16* ring_at(const BgStreamer* s, int tx, int ty) {
+    int rx = tx & (BG_RING_SIZE - 1);
+    int ry = ty & (BG_RING_SIZE - 1);
+    int sb = (rx >> 5) + ((ry >> 5) << 1);
+    return SCREENBLOCK(s->sbb + sb) + ((ry & 31) << 5) + (rx & 31);
+}
+
+static inline bool map_has_row(const BgMap* m, int ty) {
+    return ty >= 0 && ty < m->height;
+}
+
+static inline u16 map_at(const BgMap* m, int tx, int ty) {
+    if (tx < 0 || tx >= m->width || !map_has_row(m, ty)) return m->fill;
+    return m->data[ty * m->width + tx];
+}
+
+// ---------------------------------------------------------
+// 3. 열 / 행 복사
+// ---------------------------------------------------------
+// 열: 링 안에서 64칸 간격으로 흩어지므로 한 칸씩 (21칸)
+static void load_column(BgStreamer* s, int tx, int ty0, int rows) {
+    for (int i = 0; i < rows; ++i) *ring_at(s, tx, ty0 + i) = map_at(s->map, tx, ty0 + i);
+    s->uploaded += (u16)rows;
+}
+
+// 행: 스크린 블록 경계(32칸)까지는 주소가 연속이므로 구간 단위로 복사
+static void load_row(BgStreamer* s, int tx0, int ty, int cols) {
+    const BgMap* m   = s->map;
+    int          end = tx0 + cols;
+
+    for (int x = tx0; x < end;) {
+        int           run = 32 - (x & 31);
+        volatile u16* dst = ring_at(s, x, ty);
+
+        if (run > end - x) run = end - x;
+
+        if (map_has_row(m, ty) && x >= 0 && x + run <= m->width) {
+            const u16* src = m->data + ty * m->width + x;
+            for (int i = 0; i < run; ++i) dst[i] = src[i];
+        } else {
+            for (int i = 0; i < run; ++i) dst[i] = map_at(m, x + i, ty);
+        }
+        x += run;
+    }
+    s->uploaded += (u16)cols;
+}
+
+static void load_window(BgStreamer* s) {
+    for (int i = 0; i < BG_STREAM_ROWS; ++i) load_row(s, s->tile_x, s->tile_y + i, BG_STREAM_COLS);
+}
+
+// 음수 좌표도 내림 (산술 시프트)
+static inline int pixel_to_tile(int p) {
+    return p >> 3;
+}
+
+// ---------------------------------------------------------
+// 4. 스트리머
+// ---------------------------------------------------------
+void bg_stream_init(BgStreamer* s, int bg, int sbb, const BgMap* map, int cam_x, int cam_y) {
+    s->bg       = bg;
+    s->sbb      = sbb;
+    s->map      = map;
+    s->tile_x   = pixel_to_tile(cam_x);
+    s->tile_y   = pixel_to_tile(cam_y);
+    s->uploaded = 0;
+
+    load_window(s);
+    bg_set_scroll(bg, cam_x, cam_y);
+}
+
+void bg_stream_update(BgStreamer* s, int cam_x, int cam_y) {
+    int tx = pixel_to_tile(cam_x);
+    int ty = pixel_to_tile(cam_y);
+    int dx = tx - s->tile_x;
+    int dy = ty - s->tile_y;
+
+    s->uploaded = 0;
+
+    if (dx >= BG_STREAM_COLS || dx <= -BG_STREAM_COLS || dy >= BG_STREAM_ROWS || dy <= -BG_STREAM_ROWS) {
+        // 순간이동: 겹치는 부분이 없으므로 창 전체
+        s->tile_x = tx;
+        s->tile_y = ty;
+        load_window(s);
+    } else {
+        // [가로 먼저] 새 열들은 '이전' 행 범위로 채움
+        for (; dx > 0; --dx) load_column(s, ++s->tile_x + BG_STREAM_COLS - 1, s->tile_y, BG_STREAM_ROWS);
+        for (; dx < 0; ++dx) load_column(s, --s->tile_x, s->tile_y, BG_STREAM_ROWS);
+
+        // [세로] 새 행들은 '이미 옮겨진' 열 범위로 채움 -> 대각선 이동의 모서리 칸도 포함됨
+        for (; dy > 0; --dy) load_row(s, s->tile_x, ++s->tile_y + BG_STREAM_ROWS - 1, BG_STREAM_COLS);
+        for (; dy < 0; ++dy) load_row(s, s->tile_x, --s->tile_y, BG_STREAM_COLS);
+    }
+
+    bg_set_scroll(s->bg, cam_x, cam_y);
+}
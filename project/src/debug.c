@@ -0,0 +1,39 @@
+// debug.c
+// mGBA 디버그 로그 출력 (include/debug.h 참고)
+// ---------------------------------------------------------
+
+#include <stdarg.h>
+#include <stdio.h>
+
+#include "debug.h"
+
+#ifndef GBA_HOST
+#define REG_DEBUG_ENABLE (*(volatile u16*)0x04FFF780)
+#define REG_DEBUG_FLAGS  (*(volatile u16*)0x04FFF700)
+#define REG_DEBUG_STRING ((char*)0x04FFF600)
+#endif
+
+#define DEBUG_STRING_MAX 256
+
+bool dbg_init(void) {
+#ifdef GBA_HOST
+    return true;
+#else
+    REG_DEBUG_ENABLE = 0xC0DE;
+    return REG_DEBUG_ENABLE == 0x1DEA;
+#endif
+}
+
+void dbg_log(int level, const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+#ifdef GBA_HOST
+    vprintf(fmt, args);
+    putchar('\n');
+    if (level == LOG_FATAL) fflush(stdout); // 곧 멈출 수 있으므로 버퍼에 남기지 않음
+#else
+    vsnprintf(REG_DEBUG_STRING, DEBUG_STRING_MAX, fmt, args);
+    REG_DEBUG_FLAGS = (u16)(level | 0x100);
+#endif
+    va_end(args);
+}
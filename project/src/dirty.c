@@ -0,0 +1,187 @@
+// dirty.c
+// 더티 렉탱글 관리자: 타일 비트맵 병합 + VBlank 예산 스케줄링 (include/dirty.h 참고)
+// ---------------------------------------------------------
+
+#include "dirty.h"
+#include "draw.h"
+#include "fb.h"
+#include "mem.h"
+
+// 타일 비트맵: 줄(ty)마다 u32 하나, 비트 tx = 타일 (tx, ty)
+static u32 tiles_high[DIRTY_ROWS];
+static u32 tiles_low[DIRTY_ROWS];
+
+static u16        bg_color = 0;
+static const u16* bg_image = NULL;
+
+static DirtyStats stats;
+
+// 타일 단위 사각형
+typedef struct {
+    int tx, ty, tw, th;
+} TileRect;
+
+void dirty_set_background_color(u16 color) {
+    bg_color = color;
+    bg_image = NULL;
+}
+
+void dirty_set_background_image(const u16* image) {
+    bg_image = image;
+}
+
+void dirty_reset(void) {
+    for (int i = 0; i < DIRTY_ROWS; ++i) {
+        tiles_high[i] = 0;
+        tiles_low[i]  = 0;
+    }
+}
+
+// ---------------------------------------------------------
+// 1. 무효화: 픽셀 사각형 -> 타일 비트
+// ---------------------------------------------------------
+void dirty_add(int x, int y, int w, int h, DirtyPriority priority) {
+    int x0 = (x < 0) ? 0 : x;
+    int y0 = (y < 0) ? 0 : y;
+    int x1 = (x + w > fb.width)  ? fb.width  : x + w; // 끝 미포함
+    int y1 = (y + h > fb.height) ? fb.height : y + h;
+
+    if (x0 >= x1 || y0 >= y1) return;
+
+    int tx0 = x0 >> DIRTY_TILE_SHIFT;
+    int tx1 = (x1 - 1) >> DIRTY_TILE_SHIFT;
+    int ty0 = y0 >> DIRTY_TILE_SHIFT;
+    int ty1 = (y1 - 1) >> DIRTY_TILE_SHIFT;
+
+    // [tx0, tx1] 비트가 모두 1인 마스크 (tx1 < 30이므로 시프트 안전)
+    u32  mask = ((2u << tx1) - 1) & ~((1u << tx0) - 1);
+    u32* rows = (priority == DIRTY_HIGH) ? tiles_high : tiles_low;
+
+    for (int ty = ty0; ty <= ty1; ++ty) {
+        rows[ty] |= mask;
+    }
+}
+
+// ---------------------------------------------------------
+// 2. 비트맵 -> 사각형 추출 (탐욕적 병합)
+// ---------------------------------------------------------
+// 위에서부터 첫 번째 가로 연속 구간을 찾고, 아래 줄들이 같은 구간을
+// 전부 포함하는 동안 아래로 늘림. 뽑아낸 비트는 work에서 지움.
+static bool extract_rect(u32* work, int rows, TileRect* out) {
+    for (int ty = 0; ty < rows; ++ty) {
+        u32 bits = work[ty];
+        if (!bits) continue;
+
+        int tx0 = __builtin_ctz(bits);
+        int tx1 = tx0;
+        while (tx1 + 1 < 32 && (bits & (1u << (tx1 + 1)))) ++tx1;
+
+        u32 mask = ((2u << tx1) - 1) & ~((1u << tx0) - 1);
+        int th   = 1;
+
+        work[ty] &= ~mask;
+        while (ty + th < rows && (work[ty + th] & mask) == mask) {
+            work[ty + th] &= ~mask;
+            ++th;
+        }
+
+        out->tx = tx0;
+        out->ty = ty;
+        out->tw = tx1 - tx0 + 1;
+        out->th = th;
+        return true;
+    }
+    return false;
+}
+
+// ---------------------------------------------------------
+// 3. 비용 추정 + 다시 칠하기
+// ---------------------------------------------------------
+// 타일 사각형을 화면 크기로 잘라낸 픽셀 사각형
+static void tile_to_pixels(const TileRect* r, int* x, int* y, int* w, int* h) {
+    *x = r->tx << DIRTY_TILE_SHIFT;
+    *y = r->ty << DIRTY_TILE_SHIFT;
+    *w = r->tw << DIRTY_TILE_SHIFT;
+    *h = r->th << DIRTY_TILE_SHIFT;
+    if (*x + *w > fb.width)  *w = fb.width  - *x;
+    if (*y + *h > fb.height) *h = fb.height - *y;
+}
+
+static u32 estimate_cost(int w, int h) {
+    u32 px_cost = bg_image ? DIRTY_COST_COPY_PX : DIRTY_COST_FILL_PX;
+    if (fb.mode == FB_MODE4) px_cost >>= 1; // 8bpp: 같은 픽셀 수에 절반의 바이트
+
+    return DIRTY_COST_RECT + (u32)h * DIRTY_COST_ROW + (((u32)w * (u32)h * px_cost) >> 4);
+}
+
+static void repaint(int x, int y, int w, int h) {
+    if (!bg_image) {
+        draw_rect(x, y, w, h, bg_color);
+        return;
+    }
+
+    // 이미지 원본에서 줄 단위 복사 (x는 8의 배수라 Mode 4에서도 픽셀 쌍 경계)
+    int        ux   = (fb.mode == FB_MODE4) ? x >> 1 : x; // u16 단위 위치/폭
+    int        uw   = (fb.mode == FB_MODE4) ? w >> 1 : w;
+    u16*       dst  = fb.back + y * fb.pitch + ux;
+    const u16* src  = bg_image + y * fb.pitch + ux;
+
+    for (int row = 0; row < h; ++row, dst += fb.pitch, src += fb.pitch) {
+        mem_copy16(dst, src, (u32)uw);
+    }
+}
+
+int dirty_flush(u32 budget_cycles) {
+    int      rows = (fb.height + DIRTY_TILE - 1) >> DIRTY_TILE_SHIFT;
+    u32      work[DIRTY_ROWS];
+    TileRect r;
+    int      x, y, w, h;
+
+    stats.rects      = 0;
+    stats.deferred   = 0;
+    stats.pixels     = 0;
+    stats.est_cycles = 0;
+
+    // 높은 우선순위가 덮는 타일은 낮은 쪽에서 제외 (중복 칠하기 방지)
+    for (int i = 0; i < rows; ++i) {
+        tiles_low[i] &= ~tiles_high[i];
+        work[i] = tiles_high[i];
+        tiles_high[i] = 0;
+    }
+
+    // [HIGH] 예산과 상관없이 전부
+    while (extract_rect(work, rows, &r)) {
+        tile_to_pixels(&r, &x, &y, &w, &h);
+        repaint(x, y, w, h);
+        stats.rects++;
+        stats.pixels     += (u32)(w * h);
+        stats.est_cycles += estimate_cost(w, h);
+    }
+
+    // [LOW] 남은 예산 안에서만. 못 칠한 사각형은 비트를 남겨 다음 프레임으로
+    for (int i = 0; i < rows; ++i) work[i] = tiles_low[i];
+
+    while (extract_rect(work, rows, &r)) {
+        tile_to_pixels(&r, &x, &y, &w, &h);
+        u32 cost = estimate_cost(w, h);
+
+        if (stats.est_cycles + cost > budget_cycles) {
+            stats.deferred++;
+            continue;
+        }
+
+        repaint(x, y, w, h);
+        stats.rects++;
+        stats.pixels     += (u32)(w * h);
+        stats.est_cycles += cost;
+
+        u32 mask = ((2u << (r.tx + r.tw - 1)) - 1) & ~((1u << r.tx) - 1);
+        for (int ty = r.ty; ty < r.ty + r.th; ++ty) tiles_low[ty] &= ~mask;
+    }
+
+    return stats.deferred;
+}
+
+const DirtyStats* dirty_stats(void) {
+    return &stats;
+}
@@ -0,0 +1,373 @@
+// draw.c
+// 스팬 기반 래스터라이저 (include/draw.h 참고)
+// ---------------------------------------------------------
+
+#include "draw.h"
+#include "fb.h"
+#include "mem.h"
+#include "span.h"
+#include "fixmath.h"
+
+// ---------------------------------------------------------
+// 1. 스팬 코어 (클리핑이 끝난 구간만 받음)
+// ---------------------------------------------------------
+// p에서 시작하는 len개의 픽셀을 color로 채움 (len >= 1)
+// 머리/몸통/꼬리 루프는 IWRAM ARM 커널(span.iwram.c)이 처리
+static inline void span16(u16* p, int len, u16 color) {
+    span_fill16(p, len, color);
+}
+
+// ---------------------------------------------------------
+// 2. Mode 4 (8bpp) 픽셀 쌍 처리
+// ---------------------------------------------------------
+// VRAM은 8비트 쓰기가 불가능하므로, 홀수 위치 픽셀 하나는
+// u16을 읽어서 해당 바이트만 바꿔 다시 씀 (Read-Modify-Write)
+static inline u16 pair8(u16 index) {
+    return (u16)((index & 0xFF) | ((index & 0xFF) << 8));
+}
+
+static inline void plot8(u16* row, int x, u16 index) {
+    u16* p = row + (x >> 1);
+    if (x & 1) *p = (u16)((*p & 0x00FF) | ((index & 0xFF) << 8));
+    else       *p = (u16)((*p & 0xFF00) | (index & 0xFF));
+}
+
+// 8bpp 스팬: 홀수 머리/꼬리만 RMW, 가운데는 픽셀 쌍으로 span16에 넘김
+static inline void span8(u16* row, int x0, int len, u16 index) {
+    if (x0 & 1) {
+        plot8(row, x0, index);
+        ++x0;
+        if (--len == 0) return;
+    }
+    if (len >= 2) span16(row + (x0 >> 1), len >> 1, pair8(index));
+    if (len & 1)  plot8(row, x0 + len - 1, index);
+}
+
+// ---------------------------------------------------------
+// 3. 클리핑 + 출력 (모든 도형이 거치는 단일 경로)
+// ---------------------------------------------------------
+// fb.back(현재 Back Buffer)의 y줄, [x0, x1] 구간 (x0 <= x1 가정)
+static inline void clip_span(int x0, int x1, int y, u16 color) {
+    if ((unsigned)y >= (unsigned)fb.height) return;
+    if (x0 < 0)         x0 = 0;
+    if (x1 >= fb.width) x1 = fb.width - 1;
+    if (x0 > x1) return;
+
+    u16* row = fb.back + y * fb.pitch;
+    if (fb.mode == FB_MODE4) span8(row, x0, x1 - x0 + 1, color);
+    else                     span16(row + x0, x1 - x0 + 1, color);
+}
+
+// ---------------------------------------------------------
+// 4. 기본 도형
+// ---------------------------------------------------------
+void draw_pixel(int x, int y, u16 color) {
+    // unsigned 비교 한 번으로 '0 이상 && 크기 미만'을 동시에 검사
+    if ((unsigned)x >= (unsigned)fb.width || (unsigned)y >= (unsigned)fb.height) return;
+
+    u16* row = fb.back + y * fb.pitch;
+    if (fb.mode == FB_MODE4) plot8(row, x, color);
+    else                     row[x] = color;
+}
+
+void draw_hline(int x0, int x1, int y, u16 color) {
+    if (x0 > x1) { int t = x0; x0 = x1; x1 = t; }
+    clip_span(x0, x1, y, color);
+}
+
+void draw_vline(int x, int y0, int y1, u16 color) {
+    if (y0 > y1) { int t = y0; y0 = y1; y1 = t; }
+    if ((unsigned)x >= (unsigned)fb.width) return;
+    if (y0 < 0)          y0 = 0;
+    if (y1 >= fb.height) y1 = fb.height - 1;
+
+    u16* row = fb.back + y0 * fb.pitch;
+    for (int y = y0; y <= y1; ++y, row += fb.pitch) {
+        if (fb.mode == FB_MODE4) plot8(row, x, color);
+        else                     row[x] = color;
+    }
+}
+
+void draw_rect(int x, int y, int w, int h, u16 color) {
+    // [클리핑] 화면과의 교집합을 한 번만 계산
+    int x0 = (x < 0) ? 0 : x;
+    int y0 = (y < 0) ? 0 : y;
+    int x1 = (x + w > fb.width)  ? fb.width  : x + w; // 끝은 미포함
+    int y1 = (y + h > fb.height) ? fb.height : y + h;
+
+    if (x0 >= x1 || y0 >= y1) return;
+
+    int  len = x1 - x0;
+    u16* row = fb.back + y0 * fb.pitch;
+
+    // 가로 전체를 덮으면 줄들이 메모리상 연속이므로 한 번에 채움
+    if (len == fb.width) {
+        u16 value = (fb.mode == FB_MODE4) ? pair8(color) : color;
+        mem_fill16(row, value, (u32)fb.pitch * (u32)(y1 - y0));
+        return;
+    }
+
+    // 16비트 모드는 줄 루프까지 IWRAM 커널에 맡김 (사각형당 호출 1번)
+    if (fb.mode != FB_MODE4) {
+        span_fill_rows16(row + x0, fb.pitch, len, y1 - y0, color);
+        return;
+    }
+
+    // 줄마다 곱셈 대신 포인터를 한 줄씩 전진
+    for (int yy = y0; yy < y1; ++yy, row += fb.pitch) {
+        span8(row, x0, len, color);
+    }
+}
+
+// ---------------------------------------------------------
+// 5. 선 (Bresenham)
+// ---------------------------------------------------------
+// 완만한 선(|dx| >= |dy|): 왼쪽 -> 오른쪽으로 진행하면서, y가 바뀌기 직전까지의
+//                        연속 픽셀을 스팬 하나로 출력
+// 가파른 선(|dy| > |dx|): 줄마다 픽셀이 하나뿐이므로 점으로 출력
+//
+// [클리핑] 주 축(major)으로 k칸 진행한 뒤의 상태는 루프 없이 구할 수 있음:
+//    h = major / 2,  n = max(0, ceil((k * minor - h) / major))  (부 축 이동 수)
+//    err = h - k * minor + n * major
+// 그래서 화면 밖 앞부분은 나눗셈 한 번으로 건너뛰고, 화면을 빠져나가면 바로 끝냄.
+// 그려지는 픽셀은 전부 도는 것과 완전히 같음.
+static inline int bres_skip(int k, int major, int minor, int* err) {
+    int h = major >> 1;
+    int t = k * minor - h;
+    int n = (t > 0) ? (t + major - 1) / major : 0;
+
+    *err = h - k * minor + n * major;
+    return n;
+}
+
+// 부 축이 처음으로 m칸(m >= 1) 움직인 픽셀 번호
+static inline int bres_first(int m, int major, int minor) {
+    return ((m - 1) * major + (major >> 1)) / minor + 1;
+}
+
+void draw_line(int x0, int y0, int x1, int y1, u16 color) {
+    if (y0 == y1) { draw_hline(x0, x1, y0, color); return; }
+    if (x0 == x1) { draw_vline(x0, y0, y1, color); return; }
+
+    int dx = (x1 > x0) ? x1 - x0 : x0 - x1;
+    int dy = (y1 > y0) ? y1 - y0 : y0 - y1;
+    int err;
+
+    if (dx >= dy) {
+        if (x0 > x1) { int t; t = x0; x0 = x1; x1 = t; t = y0; y0 = y1; y1 = t; }
+
+        int sy = (y1 > y0) ? 1 : -1;
+
+        // 건너뛸 픽셀 수 = max(x가 0이 될 때까지, y가 화면에 들어올 때까지)
+        int k = (x0 < 0) ? -x0 : 0;
+        int m = (sy > 0) ? -y0 : y0 - (fb.height - 1);
+        if (m > 0) {
+            int ky = bres_first(m, dx, dy);
+            if (ky > k) k = ky;
+        }
+        if (x1 >= fb.width) x1 = fb.width - 1;
+        if (x0 + k > x1) return;
+
+        int y     = y0 + sy * bres_skip(k, dx, dy, &err);
+        int start = x0 + k;
+
+        for (int x = start; x <= x1; ++x) {
+            err -= dy;
+            if (err < 0) {
+                clip_span(start, x, y, color);
+                y     += sy;
+                err   += dx;
+                start  = x + 1;
+                if ((unsigned)y >= (unsigned)fb.height) return; // 진행 방향으로 화면을 벗어남
+            }
+        }
+        if (start <= x1) clip_span(start, x1, y, color);
+    } else {
+        if (y0 > y1) { int t; t = x0; x0 = x1; x1 = t; t = y0; y0 = y1; y1 = t; }
+
+        int sx = (x1 > x0) ? 1 : -1;
+
+        int k = (y0 < 0) ? -y0 : 0;
+        int m = (sx > 0) ? -x0 : x0 - (fb.width - 1);
+        if (m > 0) {
+            int kx = bres_first(m, dy, dx);
+            if (kx > k) k = kx;
+        }
+        if (y1 >= fb.height) y1 = fb.height - 1;
+        if (y0 + k > y1) return;
+
+        int x = x0 + sx * bres_skip(k, dy, dx, &err);
+
+        for (int y = y0 + k; y <= y1; ++y) {
+            draw_pixel(x, y, color);
+            err -= dx;
+            if (err < 0) {
+                x   += sx;
+                err += dy;
+                if ((unsigned)x >= (unsigned)fb.width) return;
+            }
+        }
+    }
+}
+
+// ---------------------------------------------------------
+// 6. 원 (Midpoint Circle)
+// ---------------------------------------------------------
+// 1/8 원(x: 0 -> y)만 계산하고 대칭으로 나머지를 채움.
+// d: 다음 중점이 원 안(d < 0)인지 밖인지 판단하는 정수 판별식
+void draw_circle(int cx, int cy, int r, u16 color) {
+    if (r < 0) return;
+
+    int x   = 0;
+    int y   = r;
+    int d   = 1 - r;
+    int run = 0; // 현재 y에서 시작한 x (완만한 팔분면의 스팬 시작점)
+
+    while (x <= y) {
+        // 가파른 팔분면: 줄(cy ± x)마다 점 하나씩
+        draw_pixel(cx - y, cy + x, color);
+        draw_pixel(cx + y, cy + x, color);
+        draw_pixel(cx - y, cy - x, color);
+        draw_pixel(cx + y, cy - x, color);
+
+        if (d < 0) {
+            d += 2 * x + 3;
+        } else {
+            // y가 바뀌기 직전: 완만한 팔분면의 [run, x] 구간을 스팬으로
+            clip_span(cx + run, cx + x, cy + y, color);
+            clip_span(cx - x, cx - run, cy + y, color);
+            clip_span(cx + run, cx + x, cy - y, color);
+            clip_span(cx - x, cx - run, cy - y, color);
+            d  += 2 * (x - y) + 5;
+            --y;
+            run = x + 1;
+        }
+        ++x;
+    }
+
+    // 마지막 y에 남은 구간 (x > y가 되며 루프를 빠져나온 경우)
+    if (run < x) {
+        int end = x - 1;
+        clip_span(cx + run, cx + end, cy + y, color);
+        clip_span(cx - end, cx - run, cy + y, color);
+        clip_span(cx + run, cx + end, cy - y, color);
+        clip_span(cx - end, cx - run, cy - y, color);
+    }
+}
+
+// 채운 원: 줄마다 스팬 하나.
+// 줄(cy ± x)은 x가 바뀔 때마다, 줄(cy ± y)은 y가 바뀌기 직전(가장 넓을 때) 한 번만 그림
+void draw_circle_fill(int cx, int cy, int r, u16 color) {
+    if (r < 0) return;
+
+    int x = 0;
+    int y = r;
+    int d = 1 - r;
+
+    while (x <= y) {
+        clip_span(cx - y, cx + y, cy + x, color);
+        if (x != 0) clip_span(cx - y, cx + y, cy - x, color);
+
+        if (d < 0) {
+            d += 2 * x + 3;
+        } else {
+            if (x != y) { // x == y인 줄은 위에서 이미 그림
+                clip_span(cx - x, cx + x, cy + y, color);
+                clip_span(cx - x, cx + x, cy - y, color);
+            }
+            d += 2 * (x - y) + 5;
+            --y;
+        }
+        ++x;
+    }
+}
+
+// ---------------------------------------------------------
+// 7. 볼록 다각형 (fixed 꼭짓점, top-left 규칙)
+// ---------------------------------------------------------
+// 줄 y의 중심 = y + 0.5. 변 [ya, yb)가 덮는 줄 = [ceil(ya - 0.5), ceil(yb - 0.5))
+static inline int first_row(fixed y) {
+    return (y + FIX_ONE / 2 - 1) >> FIX_SHIFT;
+}
+
+// 꼭대기 꼭짓점에서 한쪽 방향으로 내려가는 변의 사슬
+typedef struct {
+    const DrawVertex* v;
+    int               count;
+    int               step; // 다음 꼭짓점 방향 (+1 / -1)
+    int               cur;  // 현재 변의 위쪽 꼭짓점
+    int               end;  // 현재 변이 덮는 마지막 줄 + 1
+} EdgeWalk;
+
+// 줄 y를 덮는 다음 변으로 이동하고, 줄 y에서의 x(Q16.16, 0.5 뺀 값)와 줄당 변화량을 구함
+// 아래쪽 꼭짓점을 지나 다시 올라가기 시작하면 false
+static bool edge_next(EdgeWalk* w, int y, s32* x, s32* dx) {
+    for (int n = 0; n < w->count; ++n) {
+        int next = w->cur + w->step;
+        if (next < 0)         next = w->count - 1;
+        if (next >= w->count) next = 0;
+
+        const DrawVertex* a = &w->v[w->cur];
+        const DrawVertex* b = &w->v[next];
+        w->cur = next;
+
+        if (b->y < a->y) return false;
+        w->end = first_row(b->y);
+        if (w->end <= y) continue; // 줄 중심을 하나도 안 지나는 변 (수평 변 포함)
+
+        fixed yc = INT_TO_FIX(y) + FIX_ONE / 2;
+        *dx = fix_div_q16(b->x - a->x, b->y - a->y);
+        *x  = (a->x << 8) + (s32)(((long long)(yc - a->y) * *dx) >> 8) - 0x8000;
+        return true;
+    }
+    return false;
+}
+
+void draw_polygon(const DrawVertex* v, int count, u16 color) {
+    if (count < 3) return;
+
+    // 꼭대기/바닥 꼭짓점 + 감는 방향 (넓이 x 2의 부호)
+    int       top = 0, bottom = 0;
+    long long area = 0;
+    for (int i = 0; i < count; ++i) {
+        int j = (i + 1 < count) ? i + 1 : 0;
+        if (v[i].y < v[top].y)    top = i;
+        if (v[i].y > v[bottom].y) bottom = i;
+        area += (long long)v[i].x * v[j].y - (long long)v[j].x * v[i].y;
+    }
+    if (area == 0) return;
+
+    int y  = first_row(v[top].y);
+    int y1 = first_row(v[bottom].y);
+    if (y < 0)          y = 0;
+    if (y1 > fb.height) y1 = fb.height;
+    if (y >= y1) return;
+
+    // y가 아래로 커지는 화면에서 area > 0 = 시계 방향 = 번호가 커지는 쪽이 오른쪽 사슬
+    EdgeWalk  l = { v, count, (area > 0) ? -1 : 1, top, 0 };
+    EdgeWalk  r = { v, count, -l.step, top, 0 };
+    SpanEdges e;
+
+    if (!edge_next(&l, y, &e.xl, &e.dxl) || !edge_next(&r, y, &e.xr, &e.dxr)) return;
+
+    // 두 변이 모두 유지되는 구간마다 IWRAM 커널 호출 한 번
+    u16* row = fb.back + y * fb.pitch;
+    for (;;) {
+        int end = (l.end < r.end) ? l.end : r.end;
+        if (end > y1) end = y1;
+
+        if (fb.mode == FB_MODE4) span_fill_edges8(row, fb.pitch, end - y, fb.width, &e, color);
+        else                     span_fill_edges16(row, fb.pitch, end - y, fb.width, &e, color);
+
+        row += (end - y) * fb.pitch;
+        y    = end;
+        if (y >= y1) break;
+        if (l.end <= y && !edge_next(&l, y, &e.xl, &e.dxl)) break;
+        if (r.end <= y && !edge_next(&r, y, &e.xr, &e.dxr)) break;
+    }
+}
+
+void draw_triangle(fixed x0, fixed y0, fixed x1, fixed y1, fixed x2, fixed y2, u16 color) {
+    DrawVertex v[3] = { { x0, y0 }, { x1, y1 }, { x2, y2 } };
+    draw_polygon(v, 3, color);
+}
@@ -0,0 +1,70 @@
+// entity.c
+// 엔티티 풀: 생성 / 삭제 / 핸들 -> 칸 (include/entity.h 참고)
+// ---------------------------------------------------------
+// 일괄 처리 패스와 충돌 검사는 entity.iwram.c
+
+#include "entity.h"
+
+Entities ent;
+
+static s16      slot_of[ENT_MAX];  // 핸들 -> 칸 (-1 = 비어 있음)
+static EntityId free_ids[ENT_MAX]; // 빈 핸들 스택
+static int      free_top = 0;
+
+void entity_init(void) {
+    ent.count = 0;
+    free_top  = 0;
+
+    // 작은 번호부터 나가도록 거꾸로 쌓음
+    for (int i = ENT_MAX - 1; i >= 0; --i) {
+        slot_of[i]           = -1;
+        free_ids[free_top++] = (EntityId)i;
+    }
+}
+
+EntityId entity_create(fixed x, fixed y, int w, int h, u16 flags) {
+    if (free_top == 0) return ENT_NONE;
+
+    EntityId id = free_ids[--free_top];
+    int      s  = ent.count++;
+
+    ent.x[s]      = x;
+    ent.y[s]      = y;
+    ent.vx[s]     = 0;
+    ent.vy[s]     = 0;
+    ent.w[s]      = INT_TO_FIX(w);
+    ent.h[s]      = INT_TO_FIX(h);
+    ent.flags[s]  = flags;
+    ent.sprite[s] = 0;
+    ent.id[s]     = id;
+    slot_of[id]   = (s16)s;
+    return id;
+}
+
+void entity_destroy(EntityId id) {
+    if (id >= ENT_MAX || slot_of[id] < 0) return;
+
+    int s    = slot_of[id];
+    int last = --ent.count;
+
+    // 맨 뒤 칸을 빈자리로 당겨서 배열을 빽빽하게 유지
+    if (s != last) {
+        ent.x[s]      = ent.x[last];
+        ent.y[s]      = ent.y[last];
+        ent.vx[s]     = ent.vx[last];
+        ent.vy[s]     = ent.vy[last];
+        ent.w[s]      = ent.w[last];
+        ent.h[s]      = ent.h[last];
+        ent.flags[s]  = ent.flags[last];
+        ent.sprite[s] = ent.sprite[last];
+        ent.id[s]     = ent.id[last];
+        slot_of[ent.id[s]] = (s16)s;
+    }
+
+    slot_of[id]          = -1;
+    free_ids[free_top++] = id;
+}
+
+int entity_slot(EntityId id) {
+    return (id < ENT_MAX) ? slot_of[id] : -1;
+}
@@ -0,0 +1,151 @@
+// entity.iwram.c
+// 엔티티 일괄 처리 + 격자 브로드페이즈 (include/entity.h 참고)
+// ---------------------------------------------------------
+// 파일 이름의 .iwram 때문에 makefile이 -marm -mlong-calls로 컴파일하고
+// 링커가 코드째 IWRAM에 배치함. (호스트 빌드에서는 평범한 C 파일)
+
+#include "entity.h"
+
+// 격자 (프레임마다 다시 만듦)
+static u16 cell_start[ENT_GRID_CELLS + 1]; // 칸 c의 목록 = cell_items[cell_start[c] .. cell_start[c+1])
+static u16 cell_items[ENT_GRID_SLOTS];     // 칸 번호
+static u8  span_x0[ENT_MAX], span_x1[ENT_MAX], span_y0[ENT_MAX], span_y1[ENT_MAX];
+
+// ---------------------------------------------------------
+// 1. 일괄 처리
+// ---------------------------------------------------------
+void entity_integrate(void) {
+    fixed* x  = ent.x;
+    fixed* y  = ent.y;
+    const fixed* vx = ent.vx;
+    const fixed* vy = ent.vy;
+
+    for (int i = ent.count; i > 0; --i) *x++ += *vx++;
+    for (int i = ent.count; i > 0; --i) *y++ += *vy++;
+}
+
+// 한 축씩: 배열 두 개(위치, 속도)만 훑음
+// (count / flags를 지역 변수로: 배열에 쓸 때마다 ent.count를 다시 읽지 않게)
+static inline void clamp_axis(fixed* p, fixed* v, const fixed* size, fixed lo, fixed hi) {
+    const u16* flags = ent.flags;
+    int        n     = ent.count;
+
+    for (int i = 0; i < n; ++i) {
+        fixed max = hi - size[i];
+        bool  hit = false;
+
+        if (p[i] < lo)  { p[i] = lo;  hit = v[i] < 0; }
+        if (p[i] > max) { p[i] = max; hit = v[i] > 0; }
+        if (hit && (flags[i] & ENT_BOUNCE)) v[i] = -v[i];
+    }
+}
+
+void entity_clamp(fixed min_x, fixed min_y, fixed max_x, fixed max_y) {
+    clamp_axis(ent.x, ent.vx, ent.w, min_x, max_x);
+    clamp_axis(ent.y, ent.vy, ent.h, min_y, max_y);
+}
+
+// ---------------------------------------------------------
+// 2. 격자 만들기 (계수 정렬)
+// ---------------------------------------------------------
+static inline int cell_coord(fixed p, int limit) {
+    int c = FIX_TO_INT(p) >> ENT_CELL_SHIFT;
+    return (c < 0) ? 0 : (c >= limit ? limit - 1 : c);
+}
+
+static inline bool overlap(int a, int b) {
+    return ent.x[a] < ent.x[b] + ent.w[b] && ent.x[b] < ent.x[a] + ent.w[a]
+        && ent.y[a] < ent.y[b] + ent.h[b] && ent.y[b] < ent.y[a] + ent.h[a];
+}
+
+static inline int emit(EntityPair* out, int cap, int found, int a, int b) {
+    if (found < cap) {
+        out[found].a = ent.id[a];
+        out[found].b = ent.id[b];
+    }
+    return found + 1;
+}
+
+// 반환값: 등록한 칸 수 합계 (ENT_GRID_SLOTS를 넘으면 격자를 못 씀)
+static int build_grid(void) {
+    int total = 0;
+
+    for (int c = 0; c <= ENT_GRID_CELLS; ++c) cell_start[c] = 0;
+
+    for (int i = 0; i < ent.count; ++i) {
+        if (!(ent.flags[i] & ENT_SOLID)) {
+            span_x0[i] = span_y0[i] = 1; // 빈 범위
+            span_x1[i] = span_y1[i] = 0;
+            continue;
+        }
+        int x0 = cell_coord(ent.x[i], ENT_GRID_W), x1 = cell_coord(ent.x[i] + ent.w[i] - 1, ENT_GRID_W);
+        int y0 = cell_coord(ent.y[i], ENT_GRID_H), y1 = cell_coord(ent.y[i] + ent.h[i] - 1, ENT_GRID_H);
+
+        span_x0[i] = (u8)x0; span_x1[i] = (u8)x1;
+        span_y0[i] = (u8)y0; span_y1[i] = (u8)y1;
+
+        for (int cy = y0; cy <= y1; ++cy) {
+            for (int cx = x0; cx <= x1; ++cx) ++cell_start[cy * ENT_GRID_W + cx + 1];
+        }
+        total += (x1 - x0 + 1) * (y1 - y0 + 1);
+    }
+    if (total > ENT_GRID_SLOTS) return total;
+
+    for (int c = 0; c < ENT_GRID_CELLS; ++c) cell_start[c + 1] += cell_start[c];
+
+    // cell_start[c]를 쓰기 위치로 쓰고 나면 한 칸씩 밀리므로, 끝나고 되돌림
+    for (int i = 0; i < ent.count; ++i) {
+        for (int cy = span_y0[i]; cy <= span_y1[i]; ++cy) {
+            for (int cx = span_x0[i]; cx <= span_x1[i]; ++cx) {
+                cell_items[cell_start[cy * ENT_GRID_W + cx]++] = (u16)i;
+            }
+        }
+    }
+    for (int c = ENT_GRID_CELLS; c > 0; --c) cell_start[c] = cell_start[c - 1];
+    cell_start[0] = 0;
+
+    return total;
+}
+
+// ---------------------------------------------------------
+// 3. 충돌 쌍
+// ---------------------------------------------------------
+// 격자를 못 쓸 때 (거대한 엔티티가 많을 때): 전부 비교
+static int collide_all(EntityPair* out, int cap) {
+    int found = 0;
+
+    for (int a = 0; a < ent.count; ++a) {
+        if (!(ent.flags[a] & ENT_SOLID)) continue;
+        for (int b = a + 1; b < ent.count; ++b) {
+            if ((ent.flags[b] & ENT_SOLID) && overlap(a, b)) found = emit(out, cap, found, a, b);
+        }
+    }
+    return found;
+}
+
+int entity_collide(EntityPair* out, int cap) {
+    if (build_grid() > ENT_GRID_SLOTS) return collide_all(out, cap);
+
+    int found = 0;
+
+    for (int c = 0; c < ENT_GRID_CELLS; ++c) {
+        int begin = cell_start[c], end = cell_start[c + 1];
+        if (end - begin < 2) continue;
+
+        for (int i = begin; i < end - 1; ++i) {
+            int a = cell_items[i];
+            for (int j = i + 1; j < end; ++j) {
+                int b = cell_items[j];
+                if (!overlap(a, b)) continue;
+
+                // 겹친 영역의 왼쪽 위가 이 칸일 때만 (여러 칸에 함께 걸친 쌍의 중복 제거)
+                fixed ox = ent.x[a] > ent.x[b] ? ent.x[a] : ent.x[b];
+                fixed oy = ent.y[a] > ent.y[b] ? ent.y[a] : ent.y[b];
+                if (cell_coord(oy, ENT_GRID_H) * ENT_GRID_W + cell_coord(ox, ENT_GRID_W) != c) continue;
+
+                found = emit(out, cap, found, a, b);
+            }
+        }
+    }
+    return found;
+}
@@ -0,0 +1,57 @@
+// fb.c
+// 프레임버퍼: Mode 3/4/5 설정과 페이지 플리핑 (include/fb.h 참고)
+// ---------------------------------------------------------
+
+#include "fb.h"
+#include "mem.h"
+
+// fb_init 전에 그려도 안전하도록 Mode 3 화면을 기본값으로 둠
+Framebuffer fb = { (u16*)VRAM_BASE, SCREEN_W, SCREEN_H, SCREEN_W, FB_MODE3 };
+
+#define MODE5_W 160
+#define MODE5_H 128
+
+void fb_init(FbMode mode, u32 extra) {
+    fb.mode = mode;
+
+    switch (mode) {
+        case FB_MODE4:
+            fb.width  = SCREEN_W;
+            fb.height = SCREEN_H;
+            fb.pitch  = SCREEN_W / 2;
+            break;
+        case FB_MODE5:
+            fb.width  = MODE5_W;
+            fb.height = MODE5_H;
+            fb.pitch  = MODE5_W;
+            break;
+        default:
+            fb.mode   = FB_MODE3;
+            fb.width  = SCREEN_W;
+            fb.height = SCREEN_H;
+            fb.pitch  = SCREEN_W;
+            break;
+    }
+
+    // 페이지 0을 보여주고, 페이지 1에 그리기 시작 (Mode 3는 페이지가 하나)
+    fb.back = (fb.mode == FB_MODE3) ? (u16*)VRAM : (u16*)VRAM_PAGE1;
+    REG_DISPCNT = fb.mode | BG2_ENABLE | extra;
+}
+
+void fb_clear(u16 color) {
+    if (fb.mode == FB_MODE4) {
+        // 인덱스 하나를 u16 두 바이트에 복제 -> 픽셀 2개씩 채움 (Mode 3의 절반 크기)
+        u16 pair = (u16)((color & 0xFF) | ((color & 0xFF) << 8));
+        mem_fill16(fb.back, pair, (u32)fb.pitch * (u32)fb.height);
+    } else {
+        mem_fill16(fb.back, color, (u32)fb.pitch * (u32)fb.height);
+    }
+}
+
+void fb_flip(void) {
+    if (fb.mode == FB_MODE3) return;
+
+    // 방금 그린 back이 화면에 나가고, 방금까지 보이던 페이지가 새 back이 됨
+    REG_DISPCNT ^= DCNT_PAGE;
+    fb.back = (REG_DISPCNT & DCNT_PAGE) ? (u16*)VRAM : (u16*)VRAM_PAGE1;
+}
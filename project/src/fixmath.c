@@ -0,0 +1,148 @@
+// fixmath.c
+// 고정 소수점 확장 수학: 역수 나눗셈, atan2, 제곱근, 배치 커널 (include/fixmath.h 참고)
+// ---------------------------------------------------------
+// sin / 역수 / atan 테이블은 빌드 시 tools/gen_luts.c가 만든 fixmath_lut.c에 있음.
+
+#include "fixmath.h"
+#include "bios.h"
+
+typedef unsigned long long u64;
+typedef signed long long   s64;
+
+#define FIXED_MAX ((fixed)0x7FFFFFFF)
+#define FIXED_MIN ((fixed)0x80000000)
+
+// ---------------------------------------------------------
+// 1. 역수 나눗셈
+// ---------------------------------------------------------
+// floor((num << shift) / den), den > 0
+//  - den = m / 2^n (m의 최상위 비트 = 1)로 정규화하면 x = m / 2^32 는 [0.5, 1)
+//  - 1/x를 테이블(Q15)에서 시작해서 Newton 두 번 -> y (Q30)
+//  - 1/den = y * 2^(n - 62) 이므로 몫 = num * y >> (62 - n - shift)
+//  - 마지막 비트 오차는 나머지를 보고 +-1 보정
+static inline u64 udiv_recip(u32 num, u32 den, int shift) {
+    int n = __builtin_clz(den);
+    u32 m = den << n;
+    u32 y = (u32)recip_lut[(m >> 23) & 0xFF] << 15;
+    u32 t;
+
+    t = (u32)(((u64)m * y) >> 32);                 // x * y (Q30, 약 1.0)
+    y = (u32)(((u64)y * ((2u << 30) - t)) >> 30);  // y * (2 - x * y)
+    t = (u32)(((u64)m * y) >> 32);
+    y = (u32)(((u64)y * ((2u << 30) - t)) >> 30);
+
+    u64 q   = ((u64)num * y) >> (62 - n - shift);
+    s64 rem = (s64)(((u64)num << shift) - q * den);
+
+    while (rem < 0)          { --q; rem += den; }
+    while (rem >= (s64)den)  { ++q; rem -= den; }
+    return q;
+}
+
+IWRAM_CODE ARM_CODE
+fixed fix_div_fast(fixed a, fixed b) {
+    if (b == 0) return (a < 0) ? FIXED_MIN : FIXED_MAX;
+
+    u32 ua = (a < 0) ? 0u - (u32)a : (u32)a;
+    u32 ub = (b < 0) ? 0u - (u32)b : (u32)b;
+    u32 q  = (u32)udiv_recip(ua, ub, FIX_SHIFT);
+
+    return ((a ^ b) < 0) ? (fixed)(0u - q) : (fixed)q;
+}
+
+s32 fix_div_q16(fixed a, fixed b) {
+    if (b == 0) return (a < 0) ? FIXED_MIN : FIXED_MAX;
+
+    u32 ua = (a < 0) ? 0u - (u32)a : (u32)a;
+    u32 ub = (b < 0) ? 0u - (u32)b : (u32)b;
+    u64 q  = udiv_recip(ua, ub, 16);
+
+    if (q > 0x7FFFFFFFu) return ((a ^ b) < 0) ? FIXED_MIN : FIXED_MAX;
+    return ((a ^ b) < 0) ? (s32)(0u - (u32)q) : (s32)q;
+}
+
+fixed fix_div_bios(fixed a, fixed b) {
+    if (b == 0) return (a < 0) ? FIXED_MIN : FIXED_MAX;
+
+    return bios_div((s32)((u32)a << FIX_SHIFT), b);
+}
+
+fixed fix_sqrt(fixed a) {
+    if (a <= 0) return 0;
+
+    // sqrt(a / 256) * 256 = sqrt(a * 256)
+    if (a < (1 << 24)) return bios_sqrt((u32)a << FIX_SHIFT);
+    return (fixed)bios_sqrt((u32)a) << (FIX_SHIFT / 2);
+}
+
+// ---------------------------------------------------------
+// 2. atan2
+// ---------------------------------------------------------
+// 1) 팔분면(Octant)으로 접어서 비율 작은쪽/큰쪽 = 0 ~ 1 (Q16) 구하기
+// 2) atan 테이블(129칸)을 선형 보간 -> 0 ~ 64 (45도)
+// 3) 접은 순서의 반대로 펼치기
+int fix_atan2(fixed y, fixed x) {
+    if (x == 0 && y == 0) return 0;
+
+    u32  ax   = (x < 0) ? 0u - (u32)x : (u32)x;
+    u32  ay   = (y < 0) ? 0u - (u32)y : (u32)y;
+    bool swap = ay > ax;
+    u32  num  = swap ? ax : ay;
+    u32  den  = swap ? ay : ax;
+
+    u32 ratio = (u32)udiv_recip(num, den, 16); // 0 ~ 65536
+    u32 idx   = ratio >> 9;
+    u32 frac  = ratio & 511;
+    int angle = atan_lut[idx] + (int)(((atan_lut[idx + 1] - atan_lut[idx]) * frac) >> 9);
+
+    // 각도 x 256 단위로 펼치기
+    if (swap)  angle = (FIX_ANGLE_QUARTER << 8) - angle;
+    if (x < 0) angle = (FIX_ANGLE_HALF << 8) - angle;
+    if (y < 0) angle = (FIX_ANGLE_FULL << 8) - angle;
+
+    return ((angle + 128) >> 8) & FIX_ANGLE_MASK;
+}
+
+// ---------------------------------------------------------
+// 3. 배치 커널
+// ---------------------------------------------------------
+// ARM 모드에서는 64비트 곱셈이 smull 한 명령이라 fix_mul을 그대로 써도 빠름.
+// (Thumb 모드에서는 같은 코드가 __aeabi_lmul 호출이 됨)
+IWRAM_CODE ARM_CODE
+void fix_mul_n(fixed* dst, const fixed* a, const fixed* b, int n) {
+    int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        dst[i + 0] = fix_mul(a[i + 0], b[i + 0]);
+        dst[i + 1] = fix_mul(a[i + 1], b[i + 1]);
+        dst[i + 2] = fix_mul(a[i + 2], b[i + 2]);
+        dst[i + 3] = fix_mul(a[i + 3], b[i + 3]);
+    }
+    for (; i < n; ++i) dst[i] = fix_mul(a[i], b[i]);
+}
+
+IWRAM_CODE ARM_CODE
+void fix_madd_n(fixed* acc, const fixed* v, fixed k, int n) {
+    int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        acc[i + 0] += fix_mul(v[i + 0], k);
+        acc[i + 1] += fix_mul(v[i + 1], k);
+        acc[i + 2] += fix_mul(v[i + 2], k);
+        acc[i + 3] += fix_mul(v[i + 3], k);
+    }
+    for (; i < n; ++i) acc[i] += fix_mul(v[i], k);
+}
+
+IWRAM_CODE ARM_CODE
+void fix_lerp_n(fixed* dst, const fixed* a, const fixed* b, fixed t, int n) {
+    int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        dst[i + 0] = a[i + 0] + fix_mul(b[i + 0] - a[i + 0], t);
+        dst[i + 1] = a[i + 1] + fix_mul(b[i + 1] - a[i + 1], t);
+        dst[i + 2] = a[i + 2] + fix_mul(b[i + 2] - a[i + 2], t);
+        dst[i + 3] = a[i + 3] + fix_mul(b[i + 3] - a[i + 3], t);
+    }
+    for (; i < n; ++i) dst[i] = a[i] + fix_mul(b[i] - a[i], t);
+}
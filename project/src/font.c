@@ -0,0 +1,114 @@
+// font.c
+// 기본 글꼴: 가변폭 ASCII 0x20 ~ 0x7E, 높이 8 (include/text.h 참고)
+// ---------------------------------------------------------
+// 한 줄 = 1바이트 (비트 0이 왼쪽 픽셀). 0번 줄은 비워서 위아래 줄 사이 간격으로 씀
+// 1 ~ 6번 줄: 대문자 / 숫자, 3 ~ 6번 줄: 소문자, 7번 줄: g j p q y 꼬리
+
+#include "text.h"
+
+const u8 txt_font_bits[TXT_FONT_COUNT][8] = {
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // ' '
+    { 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00 }, // '!'
+    { 0x00, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00 }, // '"'
+    { 0x00, 0x0A, 0x1F, 0x0A, 0x0A, 0x1F, 0x0A, 0x00 }, // '#'
+    { 0x00, 0x04, 0x1E, 0x05, 0x0E, 0x14, 0x0F, 0x04 }, // '$'
+    { 0x00, 0x13, 0x0B, 0x04, 0x02, 0x19, 0x18, 0x00 }, // '%'
+    { 0x00, 0x02, 0x05, 0x02, 0x15, 0x09, 0x16, 0x00 }, // '&'
+    { 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 }, // '\''
+    { 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00 }, // '('
+    { 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00 }, // ')'
+    { 0x00, 0x00, 0x05, 0x02, 0x05, 0x00, 0x00, 0x00 }, // '*'
+    { 0x00, 0x00, 0x02, 0x07, 0x02, 0x00, 0x00, 0x00 }, // '+'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01 }, // ','
+    { 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00 }, // '-'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00 }, // '.'
+    { 0x00, 0x04, 0x04, 0x02, 0x02, 0x01, 0x01, 0x00 }, // '/'
+    { 0x00, 0x06, 0x09, 0x0D, 0x0B, 0x09, 0x06, 0x00 }, // '0'
+    { 0x00, 0x02, 0x03, 0x02, 0x02, 0x02, 0x07, 0x00 }, // '1'
+    { 0x00, 0x06, 0x09, 0x04, 0x02, 0x01, 0x0F, 0x00 }, // '2'
+    { 0x00, 0x07, 0x08, 0x06, 0x08, 0x08, 0x07, 0x00 }, // '3'
+    { 0x00, 0x09, 0x09, 0x09, 0x0F, 0x08, 0x08, 0x00 }, // '4'
+    { 0x00, 0x0F, 0x01, 0x07, 0x08, 0x08, 0x07, 0x00 }, // '5'
+    { 0x00, 0x06, 0x01, 0x07, 0x09, 0x09, 0x06, 0x00 }, // '6'
+    { 0x00, 0x0F, 0x08, 0x04, 0x02, 0x02, 0x02, 0x00 }, // '7'
+    { 0x00, 0x06, 0x09, 0x06, 0x09, 0x09, 0x06, 0x00 }, // '8'
+    { 0x00, 0x06, 0x09, 0x09, 0x0E, 0x08, 0x06, 0x00 }, // '9'
+    { 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00 }, // ':'
+    { 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x01, 0x00 }, // ';'
+    { 0x00, 0x00, 0x04, 0x02, 0x01, 0x02, 0x04, 0x00 }, // '<'
+    { 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00 }, // '='
+    { 0x00, 0x00, 0x01, 0x02, 0x04, 0x02, 0x01, 0x00 }, // '>'
+    { 0x00, 0x06, 0x09, 0x04, 0x02, 0x00, 0x02, 0x00 }, // '?'
+    { 0x00, 0x0E, 0x11, 0x1D, 0x15, 0x1D, 0x01, 0x0E }, // '@'
+    { 0x00, 0x06, 0x09, 0x09, 0x0F, 0x09, 0x09, 0x00 }, // 'A'
+    { 0x00, 0x07, 0x09, 0x07, 0x09, 0x09, 0x07, 0x00 }, // 'B'
+    { 0x00, 0x06, 0x09, 0x01, 0x01, 0x09, 0x06, 0x00 }, // 'C'
+    { 0x00, 0x07, 0x09, 0x09, 0x09, 0x09, 0x07, 0x00 }, // 'D'
+    { 0x00, 0x0F, 0x01, 0x07, 0x01, 0x01, 0x0F, 0x00 }, // 'E'
+    { 0x00, 0x0F, 0x01, 0x07, 0x01, 0x01, 0x01, 0x00 }, // 'F'
+    { 0x00, 0x06, 0x01, 0x0D, 0x09, 0x09, 0x0E, 0x00 }, // 'G'
+    { 0x00, 0x09, 0x09, 0x0F, 0x09, 0x09, 0x09, 0x00 }, // 'H'
+    { 0x00, 0x07, 0x02, 0x02, 0x02, 0x02, 0x07, 0x00 }, // 'I'
+    { 0x00, 0x0C, 0x08, 0x08, 0x08, 0x09, 0x06, 0x00 }, // 'J'
+    { 0x00, 0x09, 0x05, 0x03, 0x05, 0x09, 0x09, 0x00 }, // 'K'
+    { 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0F, 0x00 }, // 'L'
+    { 0x00, 0x11, 0x1B, 0x15, 0x11, 0x11, 0x11, 0x00 }, // 'M'
+    { 0x00, 0x09, 0x0B, 0x0D, 0x09, 0x09, 0x09, 0x00 }, // 'N'
+    { 0x00, 0x06, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00 }, // 'O'
+    { 0x00, 0x07, 0x09, 0x09, 0x07, 0x01, 0x01, 0x00 }, // 'P'
+    { 0x00, 0x06, 0x09, 0x09, 0x09, 0x05, 0x0A, 0x00 }, // 'Q'
+    { 0x00, 0x07, 0x09, 0x09, 0x07, 0x05, 0x09, 0x00 }, // 'R'
+    { 0x00, 0x0E, 0x01, 0x06, 0x08, 0x08, 0x07, 0x00 }, // 'S'
+    { 0x00, 0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00 }, // 'T'
+    { 0x00, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00 }, // 'U'
+    { 0x00, 0x11, 0x11, 0x11, 0x0A, 0x0A, 0x04, 0x00 }, // 'V'
+    { 0x00, 0x11, 0x11, 0x11, 0x15, 0x1B, 0x11, 0x00 }, // 'W'
+    { 0x00, 0x09, 0x09, 0x06, 0x06, 0x09, 0x09, 0x00 }, // 'X'
+    { 0x00, 0x11, 0x11, 0x0A, 0x04, 0x04, 0x04, 0x00 }, // 'Y'
+    { 0x00, 0x0F, 0x08, 0x04, 0x02, 0x01, 0x0F, 0x00 }, // 'Z'
+    { 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00 }, // '['
+    { 0x00, 0x01, 0x01, 0x02, 0x02, 0x04, 0x04, 0x00 }, // '\\'
+    { 0x00, 0x03, 0x02, 0x02, 0x02, 0x02, 0x03, 0x00 }, // ']'
+    { 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00 }, // '^'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F }, // '_'
+    { 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00 }, // '`'
+    { 0x00, 0x00, 0x00, 0x0E, 0x09, 0x09, 0x0E, 0x00 }, // 'a'
+    { 0x00, 0x01, 0x01, 0x07, 0x09, 0x09, 0x07, 0x00 }, // 'b'
+    { 0x00, 0x00, 0x00, 0x06, 0x01, 0x01, 0x06, 0x00 }, // 'c'
+    { 0x00, 0x08, 0x08, 0x0E, 0x09, 0x09, 0x0E, 0x00 }, // 'd'
+    { 0x00, 0x00, 0x00, 0x06, 0x0F, 0x01, 0x0E, 0x00 }, // 'e'
+    { 0x00, 0x06, 0x01, 0x07, 0x01, 0x01, 0x01, 0x00 }, // 'f'
+    { 0x00, 0x00, 0x00, 0x0E, 0x09, 0x0E, 0x08, 0x06 }, // 'g'
+    { 0x00, 0x01, 0x01, 0x07, 0x09, 0x09, 0x09, 0x00 }, // 'h'
+    { 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00 }, // 'i'
+    { 0x00, 0x02, 0x00, 0x02, 0x02, 0x02, 0x02, 0x01 }, // 'j'
+    { 0x00, 0x01, 0x01, 0x05, 0x03, 0x05, 0x05, 0x00 }, // 'k'
+    { 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00 }, // 'l'
+    { 0x00, 0x00, 0x00, 0x0B, 0x15, 0x15, 0x15, 0x00 }, // 'm'
+    { 0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x09, 0x00 }, // 'n'
+    { 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x06, 0x00 }, // 'o'
+    { 0x00, 0x00, 0x00, 0x07, 0x09, 0x07, 0x01, 0x01 }, // 'p'
+    { 0x00, 0x00, 0x00, 0x0E, 0x09, 0x0E, 0x08, 0x08 }, // 'q'
+    { 0x00, 0x00, 0x00, 0x05, 0x03, 0x01, 0x01, 0x00 }, // 'r'
+    { 0x00, 0x00, 0x00, 0x0E, 0x03, 0x0C, 0x07, 0x00 }, // 's'
+    { 0x00, 0x02, 0x02, 0x07, 0x02, 0x02, 0x04, 0x00 }, // 't'
+    { 0x00, 0x00, 0x00, 0x09, 0x09, 0x09, 0x0E, 0x00 }, // 'u'
+    { 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x02, 0x00 }, // 'v'
+    { 0x00, 0x00, 0x00, 0x11, 0x15, 0x15, 0x0A, 0x00 }, // 'w'
+    { 0x00, 0x00, 0x00, 0x05, 0x02, 0x02, 0x05, 0x00 }, // 'x'
+    { 0x00, 0x00, 0x00, 0x09, 0x09, 0x0E, 0x08, 0x06 }, // 'y'
+    { 0x00, 0x00, 0x00, 0x0F, 0x04, 0x02, 0x0F, 0x00 }, // 'z'
+    { 0x00, 0x06, 0x02, 0x01, 0x02, 0x02, 0x06, 0x00 }, // '{'
+    { 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01 }, // '|'
+    { 0x00, 0x03, 0x02, 0x04, 0x02, 0x02, 0x03, 0x00 }, // '}'
+    { 0x00, 0x00, 0x0A, 0x05, 0x00, 0x00, 0x00, 0x00 }, // '~'
+};
+
+const u8 txt_font_width[TXT_FONT_COUNT] = {
+    3, 2, 4, 6, 6, 6, 6, 2, 3, 3, 4, 4, 3, 4, 2, 4,  // 0x20 ~ 0x2F
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 2, 3, 4, 4, 4, 5,  // 0x30 ~ 0x3F
+    6, 5, 5, 5, 5, 5, 5, 5, 5, 4, 5, 5, 5, 6, 5, 5,  // 0x40 ~ 0x4F
+    5, 5, 5, 5, 6, 5, 6, 6, 5, 6, 5, 3, 4, 3, 4, 5,  // 0x50 ~ 0x5F
+    3, 5, 5, 4, 5, 5, 4, 5, 5, 2, 3, 4, 3, 6, 5, 5,  // 0x60 ~ 0x6F
+    5, 5, 4, 5, 4, 5, 4, 6, 4, 5, 5, 4, 2, 4, 5,  // 0x70 ~ 0x7E
+};
@@ -0,0 +1,65 @@
+// fx.c
+// Q 포맷 고정 소수점: 디버그 빌드의 오버플로 검사 / 통계 (include/fx.h 참고)
+// ---------------------------------------------------------
+
+#include "fx.h"
+#include "debug.h"
+
+#ifdef DEBUG_MODE
+
+typedef struct {
+    const char* name;
+    int         shift;
+    long long   min, max; // 저장 타입 범위
+} FxInfo;
+
+static const FxInfo fx_info[FX_ID_COUNT] = {
+    { "fx8",   8, -2147483647LL - 1, 2147483647LL },
+    { "fx12", 12, -2147483647LL - 1, 2147483647LL },
+    { "fx16", 16, -2147483647LL - 1, 2147483647LL },
+    { "fx8s",  8, -32768,            32767        },
+};
+
+static u32       overflow_count[FX_ID_COUNT];
+static long long peak[FX_ID_COUNT]; // 지금까지 나온 가장 큰 |값| (넘친 값 포함)
+
+s32 fx_checked(long long value, FxId id, const char* op) {
+    const FxInfo* info = &fx_info[id];
+    long long     mag  = (value < 0) ? -value : value;
+
+    if (mag > peak[id]) peak[id] = mag;
+    if (value >= info->min && value <= info->max) return (s32)value;
+
+    overflow_count[id]++;
+
+#ifdef FX_SATURATE
+    (void)op;
+    return (s32)((value < 0) ? info->min : info->max);
+#else
+    // [트랩] 어느 연산이 넘쳤는지 남기고 멈춤 (mGBA는 FATAL 로그에서 일시정지)
+    dbg_log(LOG_FATAL, "[fx] overflow in %s: %lld (range %lld ~ %lld)", op, value, info->min, info->max);
+    __builtin_trap();
+#endif
+}
+
+void fx_report(void) {
+    dbg_printf("[fx] type  overflows  peak(int)  int bits needed");
+
+    for (int i = 0; i < FX_ID_COUNT; ++i) {
+        const FxInfo* info = &fx_info[i];
+        long long     whole = peak[i] >> info->shift;
+        int           bits  = 1; // 부호 비트
+
+        while ((1LL << (bits - 1)) <= whole) ++bits;
+
+        dbg_printf("[fx] %-5s %9lu  %9lld  %2d (has %d)", info->name, (unsigned long)overflow_count[i],
+                   whole, bits, (i == FX_ID_FX8S ? 16 : 32) - info->shift);
+    }
+}
+
+#else
+
+void fx_report(void) {
+}
+
+#endif // DEBUG_MODE
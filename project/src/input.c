@@ -0,0 +1,180 @@
+// input.c
+// 키 입력 스냅샷 / 자동 반복 / Stop 깨우기 / RLE 녹화·재생 (include/input.h 참고)
+// ---------------------------------------------------------
+
+#include "input.h"
+#include "bios.h"
+#include "irq.h"
+#include "debug.h"
+
+u16 key_curr = 0;
+u16 key_prev = 0;
+u16 key_rpt  = 0;
+
+static u16 rpt_mask  = KEY_DPAD;
+static u8  rpt_delay = KEY_REPEAT_DELAY;
+static u8  rpt_rate  = KEY_REPEAT_RATE;
+static u8  rpt_timer = 0;
+
+// 녹화
+static KeyRun* rec_buf   = NULL;
+static int     rec_cap   = 0;
+static int     rec_len   = 0;
+static u32     rec_first = 0;
+
+// 재생
+static const KeyRun* play_tape  = NULL;
+static int           play_count = 0;
+static int           play_pos   = 0;
+static u16           play_left  = 0; // 현재 칸에서 남은 프레임
+
+// ---------------------------------------------------------
+// 1. 스냅샷
+// ---------------------------------------------------------
+static u16 tape_next(void) {
+    while (play_left == 0) {
+        if (++play_pos >= play_count) {
+            play_tape = NULL; // 테이프 끝 -> 레지스터로
+            return (u16)(~REG_KEYINPUT & KEY_MASK);
+        }
+        play_left = play_tape[play_pos].count;
+    }
+    --play_left;
+    return play_tape[play_pos].keys;
+}
+
+static void record(u16 keys) {
+    KeyRun* last = rec_len ? &rec_buf[rec_len - 1] : NULL;
+
+    if (!last) rec_first = irq_frame_count();
+
+    if (last && last->keys == keys && last->count != 0xFFFF) {
+        ++last->count;
+    } else if (rec_len < rec_cap) {
+        rec_buf[rec_len].keys  = keys;
+        rec_buf[rec_len].count = 1;
+        ++rec_len;
+    } else {
+        rec_buf = NULL; // 버퍼 가득 참: 여기까지만 기록
+    }
+}
+
+// 눌린 순간에 한 번, delay 뒤부터 rate마다 한 번
+static void update_repeat(void) {
+    u16 held = key_curr & rpt_mask;
+
+    key_rpt = 0;
+    if (!held) return;
+
+    if (key_hit(rpt_mask)) {
+        key_rpt   = held;
+        rpt_timer = rpt_delay;
+    } else if (--rpt_timer == 0) {
+        key_rpt   = held;
+        rpt_timer = rpt_rate;
+    }
+}
+
+void key_poll(void) {
+    key_prev = key_curr;
+    key_curr = play_tape ? tape_next() : (u16)(~REG_KEYINPUT & KEY_MASK);
+
+    if (rec_buf) record(key_curr);
+    update_repeat();
+}
+
+void key_repeat_config(u16 mask, int delay, int rate) {
+    rpt_mask  = mask;
+    rpt_delay = (u8)(delay < 1 ? 1 : (delay > 255 ? 255 : delay));
+    rpt_rate  = (u8)(rate  < 1 ? 1 : (rate  > 255 ? 255 : rate));
+    rpt_timer = rpt_delay;
+}
+
+// ---------------------------------------------------------
+// 2. 절전
+// ---------------------------------------------------------
+void key_sleep(u16 wake_keys) {
+    u16        dispcnt = REG_DISPCNT;
+    u16        keycnt  = REG_KEYCNT;
+    u16        had_irq = REG_IE & IRQ_KEYPAD;
+    IrqHandler old     = irq_get(IRQ_KEYPAD);
+
+    wake_keys &= KEY_MASK;
+    if (!wake_keys) return;
+
+    // 들어올 때 깨우는 조합을 아직 누르고 있으면 Stop이 바로 풀리므로, 다 뗄 때까지 기다림
+    while (~REG_KEYINPUT & wake_keys) sync_vblank();
+
+    // LCD를 끈 채로 멈춰야 화면이 마지막 줄로 얼어붙지 않음
+    REG_DISPCNT = dispcnt | DCNT_BLANK;
+    REG_KEYCNT  = (u16)(wake_keys | KEYCNT_IRQ | KEYCNT_AND);
+    irq_set(IRQ_KEYPAD, NULL);
+
+    bios_stop();
+
+    REG_KEYCNT = keycnt;
+    if (had_irq) irq_set(IRQ_KEYPAD, old); // 원래 핸들러 복원
+    else         irq_clear(IRQ_KEYPAD);
+    REG_DISPCNT = dispcnt;
+
+    // 깨운 키를 잡고 있는 동안 key_hit이 터지지 않게 '이미 눌림'으로 기록
+    key_curr |= wake_keys;
+}
+
+// ---------------------------------------------------------
+// 3. 녹화 / 재생
+// ---------------------------------------------------------
+void key_record_start(KeyRun* buf, int cap) {
+    rec_buf = (cap > 0) ? buf : NULL;
+    rec_cap = cap;
+    rec_len = 0;
+}
+
+int key_record_stop(void) {
+    rec_buf = NULL;
+    return rec_len;
+}
+
+u32 key_record_frame(void) {
+    return rec_first;
+}
+
+void key_play_start(const KeyRun* tape, int count) {
+    if (!tape || count <= 0) return;
+
+    play_tape  = tape;
+    play_count = count;
+    play_pos   = 0;
+    play_left  = tape[0].count;
+}
+
+void key_play_stop(void) {
+    play_tape = NULL;
+}
+
+bool key_playing(void) {
+    return play_tape != NULL;
+}
+
+void key_tape_log(const KeyRun* tape, int count, u32 first_frame) {
+    static const char* const names[10] = {
+        "A", "B", "SELECT", "START", "RIGHT", "LEFT", "UP", "DOWN", "R", "L",
+    };
+    u32 frame = first_frame;
+
+    for (int i = 0; i < count; ++i) {
+        char line[64];
+        int  len = 0;
+
+        for (int b = 0; b < 10; ++b) {
+            if (!(tape[i].keys & (1 << b))) continue;
+            line[len++] = ' ';
+            for (const char* s = names[b]; *s; ++s) line[len++] = *s;
+        }
+        line[len] = '\0';
+
+        dbg_printf("KEYS %lu%s", (unsigned long)frame, line);
+        frame += tape[i].count;
+    }
+    dbg_printf("KEYS %lu", (unsigned long)frame); // 끝: 모든 키 뗌
+}
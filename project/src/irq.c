@@ -0,0 +1,145 @@
+// irq.c
+// 인터럽트 디스패처, VBlank 대기, idle job (include/irq.h 참고)
+// ---------------------------------------------------------
+
+#include "irq.h"
+#include "bios.h"
+
+static IrqHandler  handlers[IRQ_COUNT];
+static volatile u32 frame_count = 0;
+
+typedef struct {
+    IdleJob job;
+    void*   ctx;
+} IdleSlot;
+
+static IdleSlot idle_jobs[IRQ_MAX_IDLE_JOBS];
+static int      idle_count = 0;
+static int      idle_next  = 0; // 라운드 로빈 위치
+
+// ---------------------------------------------------------
+// 1. 디스패처 (IWRAM + ARM)
+// ---------------------------------------------------------
+// BIOS는 ARM 모드로 점프하므로 반드시 ARM 코드여야 하고,
+// 인터럽트마다 실행되므로 대기 상태 없는 IWRAM에 둠.
+IWRAM_CODE ARM_CODE
+static void irq_dispatch(void) {
+    u16 flags = REG_IE & REG_IF;
+
+    REG_IF      = flags; // Ack (1을 써서 지움)
+    REG_IFBIOS |= flags; // BIOS IntrWait에게 알림
+
+    if (flags & IRQ_VBLANK) ++frame_count;
+
+    for (int i = 0; flags; ++i, flags >>= 1) {
+        if ((flags & 1) && handlers[i]) handlers[i]();
+    }
+}
+
+// ---------------------------------------------------------
+// 2. 등록 / 해제
+// ---------------------------------------------------------
+// 디스플레이 관련 인터럽트는 REG_DISPSTAT에서도 발생을 허용해야 함
+static u16 dispstat_bits(u16 mask) {
+    u16 bits = 0;
+    if (mask & IRQ_VBLANK) bits |= DSTAT_VBL_IRQ;
+    if (mask & IRQ_HBLANK) bits |= DSTAT_HBL_IRQ;
+    if (mask & IRQ_VCOUNT) bits |= DSTAT_VCT_IRQ;
+    return bits;
+}
+
+void irq_init(void) {
+    REG_IME = 0;
+    for (int i = 0; i < IRQ_COUNT; ++i) handlers[i] = NULL;
+
+    REG_ISR_MAIN  = irq_dispatch;
+    REG_IE        = IRQ_VBLANK;
+    REG_DISPSTAT |= DSTAT_VBL_IRQ;
+    REG_IME       = 1;
+}
+
+void irq_set(u16 mask, IrqHandler handler) {
+    u16 ime = REG_IME;
+    REG_IME = 0; // 테이블 수정 중에 인터럽트가 끼어들지 않도록
+
+    for (int i = 0; i < IRQ_COUNT; ++i) {
+        if (mask & (1 << i)) handlers[i] = handler;
+    }
+    REG_DISPSTAT |= dispstat_bits(mask);
+    REG_IE       |= mask;
+
+    REG_IME = ime;
+}
+
+void irq_clear(u16 mask) {
+    u16 ime = REG_IME;
+    REG_IME = 0;
+
+    mask &= (u16)~IRQ_VBLANK;
+    for (int i = 0; i < IRQ_COUNT; ++i) {
+        if (mask & (1 << i)) handlers[i] = NULL;
+    }
+    REG_DISPSTAT &= (u16)~dispstat_bits(mask);
+    REG_IE       &= (u16)~mask;
+
+    REG_IME = ime;
+}
+
+IrqHandler irq_get(u16 mask) {
+    for (int i = 0; i < IRQ_COUNT; ++i) {
+        if (mask & (1 << i)) return handlers[i];
+    }
+    return NULL;
+}
+
+void irq_set_vcount(int line) {
+    REG_DISPSTAT = (u16)((REG_DISPSTAT & 0x00FF) | DSTAT_VCT(line));
+}
+
+u32 irq_frame_count(void) {
+    return frame_count;
+}
+
+// ---------------------------------------------------------
+// 3. Idle job + VBlank 대기
+// ---------------------------------------------------------
+bool irq_add_idle_job(IdleJob job, void* ctx) {
+    if (idle_count >= IRQ_MAX_IDLE_JOBS) return false;
+
+    idle_jobs[idle_count].job = job;
+    idle_jobs[idle_count].ctx = ctx;
+    ++idle_count;
+    return true;
+}
+
+// job 하나를 한 조각 실행. 끝난 job은 마지막 칸과 바꿔서 제거
+static void run_idle_slice(void) {
+    if (idle_next >= idle_count) idle_next = 0;
+
+    IdleSlot* slot = &idle_jobs[idle_next];
+    if (slot->job(slot->ctx)) {
+        ++idle_next;
+    } else {
+        *slot = idle_jobs[--idle_count];
+    }
+}
+
+void vblank_wait(void) {
+    if (idle_count == 0) {
+        bios_vblank_intr_wait();
+        return;
+    }
+
+    // 1. 지난 VBlank 기록을 지우고 (이후 발생한 VBlank만 인정)
+    // 2. VBlank가 올 때까지 job을 조금씩 실행
+    // 3. 일이 바닥났는데 아직 VBlank 전이면 그때 잠듦 (이미 왔다면 즉시 반환)
+    u32 start = frame_count;
+
+    REG_IFBIOS &= (u16)~IRQ_VBLANK;
+    while (frame_count == start && idle_count > 0) {
+        run_idle_slice();
+    }
+    if (frame_count == start) {
+        bios_intr_wait(false, IRQ_VBLANK);
+    }
+}
@@ -0,0 +1,414 @@
+// objtile.c
+// OBJ 타일 VRAM 할당기: first-fit 비트맵 + 공유 시트 + 프레임 스트리밍 + 조각 모으기 (include/objtile.h 참고)
+// ---------------------------------------------------------
+
+#include "objtile.h"
+#include "mem.h"
+#include "prof.h"
+#include "debug.h"
+
+#define TILE_BYTES 32
+#define TILE_U16   (TILE_BYTES / 2)
+
+enum { KIND_FREE = 0, KIND_SHEET, KIND_STREAM };
+
+typedef struct {
+    const u8* src;      // 시트: 타일 데이터 / 스트림: 프레임 0
+    u16       tile;     // 지금 시작 타일
+    u16       count;    // 타일 수 (스트림은 한 프레임 분량)
+    u16       refs;
+    u16       frame;    // 스트림: VRAM에 있는 (또는 다음 VBlank에 올라갈) 프레임
+    u16       frames;
+    u8        kind;
+    u8        flags;
+    bool      queued;   // 업로드 예약됨
+} Block;
+
+// 비우기를 기다리는 자리 (옮기기 전 자리 / 놓은 블록)
+typedef struct {
+    u16 tile, count;
+    u32 vblank;         // 이 자리가 예약된 시점의 VBlank 번호
+} Retired;
+
+static u32          bits[OBJTILE_TILES / 32];  // 1 = 사용 중 (비우기 대기 포함)
+static Block        blocks[OBJTILE_MAX_BLOCKS];
+static Retired      retired[OBJTILE_MAX_RETIRED];
+static int          retired_count = 0;
+static u8           queue[OBJTILE_MAX_BLOCKS];  // 업로드 예약 순서 (블록 번호)
+static int          queue_count   = 0;
+static u32          vblanks       = 0;
+static u32          frame_bytes   = 0;      // 직전 VBlank 이후 OBJ VRAM에 쓴 바이트
+static ObjTileStats stats;
+
+// 조각 모으기 진행 상황 (호출 사이에 이어서)
+static int  compact_ceiling = OBJTILE_TILES; // 이번 바퀴에서 이 위치보다 앞의 블록만 후보
+static bool pass_moved      = false;         // 이번 바퀴에서 옮긴 것이 있음
+static bool settled         = false;         // 한 바퀴 동안 옮길 것이 없었음 -> 빈자리가 생길 때까지 쉼
+static int  scan_block      = -1;            // 검사량이 바닥나 빈자리 찾기를 멈춘 블록
+static int  scan_from       = 0;             // 그 블록의 빈자리 찾기를 이어서 할 위치
+
+// ---------------------------------------------------------
+// 1. 비트맵
+// ---------------------------------------------------------
+static void mark(int tile, int count, bool used) {
+    for (int t = tile; t < tile + count; ++t) {
+        if (used) bits[t >> 5] |= 1u << (t & 31);
+        else      bits[t >> 5] &= ~(1u << (t & 31));
+    }
+
+    if (used) {
+        stats.used += (u16)count;
+        if (stats.used > stats.peak) stats.peak = stats.used;
+    } else {
+        stats.used -= (u16)count;
+    }
+}
+
+// [from, limit) 안에서 처음 맞는 연속 빈자리 (시작이 align의 배수). 없으면 -1
+// work: 검사 한 번(타일 1개 또는 32타일 한 워드)마다 1씩 줄이고, 바닥나면 -1 + *stop = 이어서 찾을 위치
+//       (NULL = 제한 없음)
+static int find_run(int from, int count, int align, int limit, int* work, int* stop) {
+    int run = 0, start = 0;
+
+    for (int t = from; t < limit;) {
+        if (work && --*work < 0) {
+            if (stop) *stop = run ? start : t;
+            return -1;
+        }
+
+        u32 w = bits[t >> 5];
+        if ((t & 31) == 0 && w == 0xFFFFFFFFu) { // 꽉 찬 32타일은 한 번에 건너뜀
+            run = 0;
+            t  += 32;
+            continue;
+        }
+        if ((t & 31) == 0 && w == 0 && t + 32 <= limit && (run > 0 || (t & (align - 1)) == 0)) { // 빈 32타일도
+            if (run == 0) start = t;
+            run += 32;
+            if (run >= count) return start;
+            t += 32;
+            continue;
+        }
+        if (w & (1u << (t & 31))) {
+            run = 0;
+        } else if (run > 0 || (t & (align - 1)) == 0) {
+            if (run++ == 0) start = t;
+            if (run == count) return start;
+        }
+        ++t;
+    }
+    return -1;
+}
+
+static inline int align_of(u8 flags) {
+    return (flags & OBJTILE_8BPP) ? 2 : 1;
+}
+
+// ---------------------------------------------------------
+// 2. 블록
+// ---------------------------------------------------------
+void objtile_init(int first) {
+    for (int i = 0; i < OBJTILE_TILES / 32; ++i) bits[i] = 0;
+    for (int i = 0; i < OBJTILE_MAX_BLOCKS; ++i) blocks[i].kind = KIND_FREE;
+    retired_count   = 0;
+    queue_count     = 0;
+    vblanks         = 0;
+    frame_bytes     = 0;
+    compact_ceiling = OBJTILE_TILES;
+    pass_moved      = false;
+    settled         = false;
+    scan_block      = -1;
+
+    ObjTileStats zero = { 0 };
+    stats       = zero;
+    stats.first = (u16)((first > 0 && first < OBJTILE_TILES) ? first : 0);
+}
+
+static void copy_tiles(int tile, const volatile void* src, int count) {
+    mem_copy32(TILE_OBJ + tile * TILE_U16, src, (u32)count * (TILE_BYTES / 4));
+    frame_bytes += (u32)count * TILE_BYTES;
+}
+
+static Block* alloc_block(int count, u8 flags, int* out) {
+    int slot = -1;
+    for (int i = 0; i < OBJTILE_MAX_BLOCKS; ++i) {
+        if (blocks[i].kind == KIND_FREE) {
+            slot = i;
+            break;
+        }
+    }
+
+    int tile = (slot >= 0 && count > 0) ? find_run(stats.first, count, align_of(flags), OBJTILE_TILES, NULL, NULL) : -1;
+    if (tile < 0) {
+        ++stats.failures;
+        return NULL;
+    }
+    mark(tile, count, true);
+
+    Block* b  = &blocks[slot];
+    b->tile   = (u16)tile;
+    b->count  = (u16)count;
+    b->refs   = 1;
+    b->frame  = 0;
+    b->frames = 1;
+    b->flags  = flags;
+    b->queued = false;
+    *out      = slot;
+    return b;
+}
+
+int objtile_sheet(const void* tiles, int count, u8 flags) {
+    for (int i = 0; i < OBJTILE_MAX_BLOCKS; ++i) {
+        Block* b = &blocks[i];
+        if (b->kind == KIND_SHEET && b->src == tiles && b->count == count) {
+            ++b->refs;
+            ++stats.shared;
+            return i;
+        }
+    }
+
+    int    h;
+    Block* b = alloc_block(count, flags, &h);
+    if (!b) return -1;
+
+    b->kind = KIND_SHEET;
+    b->src  = tiles;
+    copy_tiles(b->tile, tiles, count);
+    return h;
+}
+
+int objtile_stream(const void* frames, int tiles_per_frame, int frame_count, u8 flags) {
+    int    h;
+    Block* b = alloc_block(tiles_per_frame, flags, &h);
+    if (!b) return -1;
+
+    b->kind   = KIND_STREAM;
+    b->src    = frames;
+    b->frames = (u16)(frame_count > 0 ? frame_count : 1);
+    copy_tiles(b->tile, frames, tiles_per_frame);
+    return h;
+}
+
+static inline Block* get(int h) {
+    if (h < 0 || h >= OBJTILE_MAX_BLOCKS || blocks[h].kind == KIND_FREE) return NULL;
+    return &blocks[h];
+}
+
+static void retire_oldest(void);
+
+static void retire(int tile, int count) {
+    if (retired_count == OBJTILE_MAX_RETIRED) retire_oldest(); // 드묾: 가장 오래 기다린 자리를 먼저 비움
+
+    Retired* r = &retired[retired_count++];
+    r->tile    = (u16)tile;
+    r->count   = (u16)count;
+    r->vblank  = vblanks;
+}
+
+static void retire_oldest(void) {
+    mark(retired[0].tile, retired[0].count, false);
+    settled = false; // 새 빈자리 -> 조각 모으기 다시
+    --retired_count;
+    for (int i = 0; i < retired_count; ++i) retired[i] = retired[i + 1];
+}
+
+void objtile_release(int h) {
+    Block* b = get(h);
+    if (!b || --b->refs > 0) return;
+
+    if (b->queued) {
+        int n = 0;
+        for (int i = 0; i < queue_count; ++i) {
+            if (queue[i] != h) queue[n++] = queue[i];
+        }
+        queue_count = n;
+    }
+
+    retire(b->tile, b->count);
+    b->kind = KIND_FREE;
+}
+
+int objtile_tile(int h) {
+    Block* b = get(h);
+    return b ? b->tile : 0;
+}
+
+// ---------------------------------------------------------
+// 3. 스트리밍
+// ---------------------------------------------------------
+void objtile_set_frame(int h, int frame) {
+    Block* b = get(h);
+    if (!b || b->kind != KIND_STREAM || frame < 0 || frame >= b->frames) return;
+
+    if (frame == b->frame) {
+        ++stats.unchanged;
+        return;
+    }
+
+    b->frame = (u16)frame;
+    if (!b->queued) { // 이미 예약돼 있으면 src만 바뀐 셈 (VBlank에서 마지막 프레임만 보냄)
+        b->queued            = true;
+        queue[queue_count++] = (u8)h;
+    }
+}
+
+void objtile_vblank(void) {
+    PROF_BEGIN("objtile");
+
+    // 1. 예약된 프레임 업로드 (한도를 넘는 것은 순서를 유지한 채 다음 VBlank로)
+    u32 bytes = 0;
+    int n     = 0;
+    for (int i = 0; i < queue_count; ++i) {
+        Block* b    = &blocks[queue[i]];
+        u32    size = (u32)b->count * TILE_BYTES;
+
+        if (bytes > 0 && bytes + size > OBJTILE_VBLANK_BYTES) {
+            queue[n++] = queue[i];
+            ++stats.deferred;
+            continue;
+        }
+
+        dma_transfer(3, b->src + b->frame * size, TILE_OBJ + b->tile * TILE_U16, DMA_32 | (size / 4));
+        b->queued = false;
+        bytes    += size;
+        ++stats.uploads;
+    }
+    queue_count = n;
+
+    // 프레임당 VRAM 쓰기 = 지난 VBlank 이후의 시트 / 조각 모으기 복사 + 이번 업로드
+    frame_bytes       += bytes;
+    stats.frame_bytes  = frame_bytes;
+    stats.total_bytes += frame_bytes;
+    if (frame_bytes > stats.peak_frame_bytes) stats.peak_frame_bytes = frame_bytes;
+    frame_bytes = 0;
+
+    // 2. 충분히 기다린 자리 비우기 (예약 순서 = 오래된 순서)
+    ++vblanks;
+    while (retired_count > 0 && vblanks - retired[0].vblank >= OBJTILE_RETIRE_VBLANKS) retire_oldest();
+
+    PROF_END("objtile");
+}
+
+// ---------------------------------------------------------
+// 4. 조각 모으기
+// ---------------------------------------------------------
+int objtile_compact(int max_tiles) {
+    if (settled || max_tiles <= 0) return 0;
+
+    PROF_BEGIN("objtile");
+
+    int work  = OBJTILE_COMPACT_SCAN; // 한 번 호출에서 하는 검사량 상한
+    int moved = 0;
+
+    // 첫 빈 타일: 이보다 앞에 있는 블록은 옮길 곳이 없음
+    int lo = find_run(stats.first, 1, 1, OBJTILE_TILES, &work, NULL);
+
+    // 비우기 대기 자리의 절반은 objtile_release 몫으로 남겨 둠
+    while (moved < max_tiles && work > 0 && retired_count < OBJTILE_MAX_RETIRED / 2) {
+        // 아직 안 본 블록 중 가장 뒤에 있는 것 (첫 빈 타일보다 뒤)
+        Block* b = NULL;
+        if (lo >= 0) {
+            for (int i = 0; i < OBJTILE_MAX_BLOCKS; ++i) {
+                Block* c = &blocks[i];
+                if (c->kind == KIND_FREE || (c->flags & OBJTILE_PINNED)) continue;
+                if (c->tile >= compact_ceiling || c->tile <= lo) continue;
+                if (!b || c->tile > b->tile) b = c;
+            }
+            work -= OBJTILE_MAX_BLOCKS / 8;
+        }
+
+        if (!b) { // 한 바퀴 끝. 하나도 못 옮겼으면 빈자리가 새로 생길 때까지 쉼
+            if (!pass_moved) settled = true;
+            compact_ceiling = OBJTILE_TILES;
+            pass_moved      = false;
+            break;
+        }
+
+        if (b->count > max_tiles) { // 이 한도로는 영영 못 옮김
+            compact_ceiling = b->tile;
+            continue;
+        }
+        if (moved + b->count > max_tiles) break; // 이번 몫은 끝, 다음 호출에서 이 블록부터
+
+        // 자기 자리보다 앞에서, 겹치지 않는 빈자리로만 (예전 자리는 OAM이 바뀔 때까지 그대로 보여야 함)
+        // 지난 호출에서 이 블록을 찾다 멈췄으면 그 위치부터 (한 블록이 검사량보다 커도 호출마다 앞으로 감)
+        int h    = (int)(b - blocks);
+        int from = (scan_block == h && scan_from > lo) ? scan_from : lo;
+        int t    = find_run(from, b->count, align_of(b->flags), b->tile, &work, &scan_from);
+        if (t < 0) {
+            if (work < 0) { // 검사량이 바닥남, 다음 호출에서 이 블록의 scan_from부터
+                scan_block = h;
+                break;
+            }
+            scan_block      = -1;
+            compact_ceiling = b->tile;
+            continue;
+        }
+        scan_block = -1;
+
+        mark(t, b->count, true);
+        copy_tiles(t, TILE_OBJ + b->tile * TILE_U16, b->count);
+        retire(b->tile, b->count);
+        compact_ceiling = b->tile;
+        b->tile         = (u16)t;
+        pass_moved      = true;
+
+        moved += b->count;
+        ++stats.moves;
+        stats.moved_tiles += b->count;
+
+        if (t == lo) lo = find_run(lo, 1, 1, OBJTILE_TILES, &work, NULL);
+    }
+
+    PROF_END("objtile");
+    return moved;
+}
+
+// ---------------------------------------------------------
+// 5. 통계
+// ---------------------------------------------------------
+const ObjTileStats* objtile_stats(void) {
+    int free_tiles = 0, largest = 0, run = 0;
+    int blocks_alive = 0;
+
+    for (int t = stats.first; t < OBJTILE_TILES; ++t) {
+        if (bits[t >> 5] & (1u << (t & 31))) {
+            run = 0;
+            continue;
+        }
+        ++free_tiles;
+        if (++run > largest) largest = run;
+    }
+    for (int i = 0; i < OBJTILE_MAX_BLOCKS; ++i) {
+        if (blocks[i].kind != KIND_FREE) ++blocks_alive;
+    }
+
+    stats.free_tiles    = (u16)free_tiles;
+    stats.largest_free  = (u16)largest;
+    stats.fragmentation = (u8)(free_tiles ? 100 - largest * 100 / free_tiles : 0);
+    stats.blocks        = (u8)blocks_alive;
+    return &stats;
+}
+
+void objtile_report(void) {
+    const ObjTileStats* s = objtile_stats();
+
+    dbg_printf("[objtile] used %u / %d tiles (peak %u), free %u, largest run %u, fragmentation %u%%, blocks %u, retiring %d",
+               s->used, OBJTILE_TILES - s->first, s->peak, s->free_tiles, s->largest_free, s->fragmentation,
+               s->blocks, retired_count);
+    dbg_printf("[objtile] upload: last %lu B, peak %lu B/frame, total %lu B, %lu frames sent, %lu unchanged, %lu deferred, %lu shared",
+               (unsigned long)s->frame_bytes, (unsigned long)s->peak_frame_bytes, (unsigned long)s->total_bytes,
+               (unsigned long)s->uploads, (unsigned long)s->unchanged, (unsigned long)s->deferred,
+               (unsigned long)s->shared);
+    dbg_printf("[objtile] compaction: %lu moves, %lu tiles, failures %lu", (unsigned long)s->moves,
+               (unsigned long)s->moved_tiles, (unsigned long)s->failures);
+
+    for (int i = 0; i < OBJTILE_MAX_BLOCKS; ++i) {
+        const Block* b = &blocks[i];
+        if (b->kind == KIND_FREE) continue;
+
+        dbg_printf("[objtile]   #%-2d %-6s tiles %4u..%4u  refs %u  frame %u/%u%s", i,
+                   b->kind == KIND_SHEET ? "sheet" : "stream", b->tile, b->tile + b->count - 1, b->refs,
+                   b->frame, b->frames, (b->flags & OBJTILE_PINNED) ? "  pinned" : "");
+    }
+}
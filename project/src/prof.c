@@ -0,0 +1,179 @@
+// prof.c
+// 프레임 프로파일러: 구간 스택, 링 버퍼, 오버레이, CSV 로그 (include/prof.h 참고)
+// ---------------------------------------------------------
+
+#include "prof.h"
+
+#ifdef PROFILE
+
+#include <stdio.h>
+#include <string.h>
+
+#include "debug.h"
+#include "draw.h"
+#include "fb.h"
+#include "timer.h"
+
+static const char* zone_names[PROF_MAX_ZONES];
+static int         zone_count = 0;
+
+// 자주 읽지 않는 큰 배열(64프레임 * 52바이트)이라 IWRAM 대신 EWRAM에 둠
+static ProfFrame history[PROF_HISTORY] EWRAM_BSS;
+static int       history_head  = 0; // 다음에 쓸 칸
+static int       history_count = 0;
+static u32       frame_number  = 0; // 지금까지 마감된 프레임 수
+
+static ProfFrame current;
+static u32       frame_start;
+
+typedef struct {
+    s8  id;
+    u32 start;
+} ProfOpen;
+
+static ProfOpen stack[PROF_MAX_DEPTH];
+static int      depth = 0;
+static int      lost  = 0; // 스택이 넘쳐서 기록 못 한 begin 수 (end와 짝 맞추기용)
+
+// 구간 색 (id 순서대로 돌려 씀)
+static const u16 zone_colors[PROF_MAX_ZONES] = {
+    COLOR_RED, COLOR_GREEN, COLOR_BLUE, COLOR_GOLD,
+    COLOR_CYAN, COLOR_MAGENTA, COLOR_WHITE, RGB(16, 16, 31),
+};
+
+#define COLOR_UNTRACKED RGB(8, 8, 8) // 어느 구간에도 속하지 않은 시간
+
+void prof_init(void) {
+    zone_count    = 0;
+    history_head  = 0;
+    history_count = 0;
+    frame_number  = 0;
+    depth         = 0;
+    lost          = 0;
+    memset(&current, 0, sizeof(current));
+
+    cycle_counter_start();
+    frame_start = cycle_counter_read();
+}
+
+int prof_zone_id(const char* name) {
+    for (int i = 0; i < zone_count; ++i) {
+        if (strcmp(zone_names[i], name) == 0) return i;
+    }
+    if (zone_count >= PROF_MAX_ZONES) return -1;
+
+    zone_names[zone_count] = name;
+    return zone_count++;
+}
+
+// ---------------------------------------------------------
+// 1. 구간 기록
+// ---------------------------------------------------------
+void prof_begin(int id) {
+    if (id < 0) return;
+    if (depth >= PROF_MAX_DEPTH) {
+        ++lost;
+        return;
+    }
+
+    stack[depth].id    = (s8)id;
+    stack[depth].start = cycle_counter_read();
+    ++depth;
+}
+
+void prof_end(int id) {
+    u32 now = cycle_counter_read();
+
+    if (id < 0) return;
+    if (lost > 0) {
+        --lost;
+        return;
+    }
+    if (depth == 0) return;
+
+    // 짝이 안 맞아도(BEGIN/END 이름 실수) 스택 맨 위 구간으로 기록
+    ProfOpen* open = &stack[--depth];
+    current.cycles[open->id] += now - open->start;
+    current.calls[open->id]++;
+}
+
+void prof_frame(void) {
+    u32 now = cycle_counter_read();
+
+    current.total = now - frame_start;
+    frame_start   = now;
+
+    history[history_head] = current;
+    history_head = (history_head + 1) % PROF_HISTORY;
+    if (history_count < PROF_HISTORY) ++history_count;
+    ++frame_number;
+
+    memset(&current, 0, sizeof(current));
+}
+
+const ProfFrame* prof_last(void) {
+    if (history_count == 0) return NULL;
+    return &history[(history_head + PROF_HISTORY - 1) % PROF_HISTORY];
+}
+
+// ---------------------------------------------------------
+// 2. 출력
+// ---------------------------------------------------------
+// 화면 폭 = CYCLES_PER_FRAME. 구간들을 id 순서로 이어 붙이고,
+// 나머지(구간 밖 시간)는 회색, 프레임 예산을 넘긴 부분은 잘림.
+// 중첩 구간은 바깥 구간에 이미 포함되어 있으므로 겹쳐 보일 수 있음 (최상위 구간 위주로 볼 것)
+void prof_draw_overlay(int y) {
+    const ProfFrame* f = prof_last();
+    if (!f) return;
+
+    u32 per_px  = CYCLES_PER_FRAME / (u32)fb.width;
+    u32 tracked = 0;
+    int x       = 0;
+
+    for (int i = 0; i < zone_count && x < fb.width; ++i) {
+        int w = (int)(f->cycles[i] / per_px);
+        if (x + w > fb.width) w = fb.width - x;
+
+        draw_rect(x, y, w, PROF_BAR_H, zone_colors[i]);
+        x       += w;
+        tracked += f->cycles[i];
+    }
+
+    if (f->total > tracked && x < fb.width) {
+        int w = (int)((f->total - tracked) / per_px);
+        if (x + w > fb.width) w = fb.width - x;
+
+        draw_rect(x, y, w, PROF_BAR_H, COLOR_UNTRACKED);
+        x += w;
+    }
+
+    draw_rect(x, y, fb.width - x, PROF_BAR_H, COLOR_BLACK);
+}
+
+// CSV: 머리줄 1개 + 프레임마다 1줄 (오래된 것부터)
+//   PROF,frame,total,<구간 이름...>
+//   PROF,123,280896,5120,...
+void prof_dump_log(void) {
+    char line[192];
+    int  len;
+
+    len = snprintf(line, sizeof(line), "PROF,frame,total");
+    for (int i = 0; i < zone_count && len < (int)sizeof(line); ++i) {
+        len += snprintf(line + len, sizeof(line) - len, ",%s", zone_names[i]);
+    }
+    dbg_log(LOG_INFO, "%s", line);
+
+    for (int n = 0; n < history_count; ++n) {
+        int              slot = (history_head + PROF_HISTORY - history_count + n) % PROF_HISTORY;
+        const ProfFrame* f    = &history[slot];
+
+        len = snprintf(line, sizeof(line), "PROF,%lu,%lu",
+                       (unsigned long)(frame_number - history_count + n), (unsigned long)f->total);
+        for (int i = 0; i < zone_count && len < (int)sizeof(line); ++i) {
+            len += snprintf(line + len, sizeof(line) - len, ",%lu", (unsigned long)f->cycles[i]);
+        }
+        dbg_log(LOG_INFO, "%s", line);
+    }
+}
+
+#endif // PROFILE
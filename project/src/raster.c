@@ -0,0 +1,218 @@
+// raster.c
+// 스캔라인 효과: 줄별 테이블 이중 버퍼 + HBlank DMA (include/raster.h 참고)
+// ---------------------------------------------------------
+
+#include "raster.h"
+#include "sound.h"
+#include "fixmath.h"
+#include "timer.h"
+#include "debug.h"
+
+typedef struct {
+    volatile u16* reg;   // NULL = 비어 있음
+    u8            width;
+    u8            dma;
+} RasterChannel;
+
+static const u8 dma_of[RASTER_CHANNELS] = { 0, 2 };
+
+static RasterChannel channels[RASTER_CHANNELS];
+
+// 줄 160개 + HBlank 159가 복사할 여분 1줄. u32로 잡아서 폭 2 채널도 4바이트 정렬
+static u32 tables[RASTER_CHANNELS][2][RASTER_LINES + 1];
+
+static int          front   = 0;     // DMA가 읽는 쪽
+static volatile int pending = 0;     // commit 후 아직 VBlank가 안 옴
+static RasterStats  stats;
+
+// DMA 한 번 = 시작 2I + (읽기 1 + 쓰기 1) x 전송 단위 수 (IWRAM -> I/O/팔레트, 대기 0 기준)
+#define DMA_CYCLES_PER_LINE(units) (2 + 2 * (units))
+
+static inline u16* table_u16(int ch, int buf) {
+    return (u16*)tables[ch][buf];
+}
+
+// ---------------------------------------------------------
+// 1. 채널
+// ---------------------------------------------------------
+static void update_stats(void) {
+    stats.channels   = 0;
+    stats.transfers  = 0;
+    stats.dma_cycles = 0;
+
+    for (int i = 0; i < RASTER_CHANNELS; ++i) {
+        if (!channels[i].reg) continue;
+        ++stats.channels;
+        stats.transfers  += RASTER_LINES;
+        stats.dma_cycles += RASTER_LINES * DMA_CYCLES_PER_LINE(1); // 폭 2도 32비트 한 번
+    }
+}
+
+int raster_open(volatile u16* reg, int width) {
+    if (!reg || width < 1 || width > RASTER_MAX_WIDTH) return -1;
+
+    for (int i = 0; i < RASTER_CHANNELS; ++i) {
+        if (channels[i].reg) continue;
+        if (sound_uses_dma(dma_of[i])) { // 스테레오 사운드의 FIFO B와 겹침
+            dbg_log(LOG_WARN, "[raster] channel %d needs DMA%d, used by stereo sound", i, dma_of[i]);
+            continue;
+        }
+
+        channels[i].reg   = reg;
+        channels[i].width = (u8)width;
+        channels[i].dma   = dma_of[i];
+        for (int b = 0; b < 2; ++b) {
+            for (int y = 0; y <= RASTER_LINES; ++y) tables[i][b][y] = 0;
+        }
+        update_stats();
+        return i;
+    }
+    return -1;
+}
+
+void raster_close(int ch) {
+    if (ch < 0 || ch >= RASTER_CHANNELS || !channels[ch].reg) return;
+
+    dma_stop(channels[ch].dma);
+    channels[ch].reg = NULL;
+    update_stats();
+}
+
+bool raster_uses_dma(int dma) {
+    for (int i = 0; i < RASTER_CHANNELS; ++i) {
+        if (channels[i].reg && channels[i].dma == dma) return true;
+    }
+    return false;
+}
+
+// ---------------------------------------------------------
+// 2. 테이블 만들기
+// ---------------------------------------------------------
+void raster_begin(void) {
+    if (pending) ++stats.late; // 아직 반영 전인 테이블을 다시 쓰게 됨
+}
+
+void raster_commit(void) {
+    // 여분 줄 = 0번 줄 (HBlank 159가 복사해도 다음 프레임 첫 줄과 같은 값)
+    for (int i = 0; i < RASTER_CHANNELS; ++i) {
+        if (channels[i].reg) tables[i][front ^ 1][RASTER_LINES] = tables[i][front ^ 1][0];
+    }
+    pending = 1;
+}
+
+u16* raster_lane(int ch, int lane) {
+    return table_u16(ch, front ^ 1) + lane;
+}
+
+void raster_fill(int ch, int lane, u16 value) {
+    int  w = channels[ch].width;
+    u16* p = raster_lane(ch, lane);
+
+    for (int y = 0; y < RASTER_LINES; ++y, p += w) *p = value;
+}
+
+void raster_bands(int ch, int lane, const RasterBand* bands, int count) {
+    int  w = channels[ch].width;
+    u16* p = raster_lane(ch, lane);
+
+    for (int i = 0; i < count; ++i) {
+        int y0 = bands[i].y;
+        int y1 = (i + 1 < count) ? bands[i + 1].y : RASTER_LINES;
+        if (y1 > RASTER_LINES) y1 = RASTER_LINES;
+
+        for (int y = y0; y < y1; ++y) p[y * w] += (u16)bands[i].value;
+    }
+}
+
+void raster_wave(int ch, int lane, int y0, int y1, int amp, int wavelength, int phase) {
+    int  w = channels[ch].width;
+    u16* p = raster_lane(ch, lane);
+
+    if (wavelength < 1) wavelength = 1;
+    if (y0 < 0) y0 = 0;
+    if (y1 > RASTER_LINES) y1 = RASTER_LINES;
+
+    // 각도를 Q8로 누적 (줄마다 512 / wavelength씩). 위상은 화면 줄 기준이라 구간을 나눠도 이어짐
+    int step  = (FIX_ANGLE_FULL << 8) / wavelength;
+    int angle = (phase << 8) + y0 * step;
+
+    p += y0 * w;
+    for (int y = y0; y < y1; ++y, p += w, angle += step) {
+        *p += (u16)((amp * fix_sin_q12(angle >> 8)) >> FIX_TRIG_SHIFT);
+    }
+}
+
+void raster_gradient(int ch, int lane, int y0, int y1, u16 c0, u16 c1) {
+    int  w = channels[ch].width;
+    u16* p = raster_lane(ch, lane);
+
+    if (y0 < 0) y0 = 0;
+    if (y1 > RASTER_LINES) y1 = RASTER_LINES;
+    if (y1 <= y0) return;
+
+    // 채널별 Q16 누적 (R, G, B 각 5비트)
+    int n = y1 - y0;
+    int r = (c0 & 31) << 16, g = ((c0 >> 5) & 31) << 16, b = ((c0 >> 10) & 31) << 16;
+    int dr = ((c1 & 31) - (c0 & 31)) * 65536 / n;
+    int dg = (((c1 >> 5) & 31) - ((c0 >> 5) & 31)) * 65536 / n;
+    int db = (((c1 >> 10) & 31) - ((c0 >> 10) & 31)) * 65536 / n;
+
+    for (int y = y0; y < y1; ++y, r += dr, g += dg, b += db) {
+        p[y * w] = (u16)RGB(r >> 16, g >> 16, b >> 16);
+    }
+}
+
+// ---------------------------------------------------------
+// 3. VBlank / 비용
+// ---------------------------------------------------------
+void raster_vblank(void) {
+    if (pending) {
+        front  ^= 1;
+        pending = 0;
+        ++stats.commits;
+    }
+
+    for (int i = 0; i < RASTER_CHANNELS; ++i) {
+        const RasterChannel* c = &channels[i];
+        if (!c->reg) continue;
+
+        const u16* t = table_u16(i, front);
+
+        dma_stop(c->dma);
+        if (c->width == 2) {
+            *(volatile u32*)c->reg = tables[i][front][0];
+            dma_transfer(c->dma, &tables[i][front][1], c->reg,
+                         DMA_AT_HBLANK | DMA_REPEAT | DMA_DST_RELOAD | DMA_32 | 1);
+        } else {
+            *c->reg = t[0];
+            dma_transfer(c->dma, &t[1], c->reg, DMA_AT_HBLANK | DMA_REPEAT | DMA_DST_RELOAD | DMA_16 | 1);
+        }
+    }
+}
+
+const RasterStats* raster_stats(void) {
+    return &stats;
+}
+
+// 대상 표시용: I/O 레지스터면 0x04000xxx, 팔레트면 0x05000xxx (호스트에서도 같은 주소로)
+static u32 target_addr(const volatile u16* reg) {
+    uintptr_t a = (uintptr_t)reg;
+
+    if (a >= REG_BASE && a < REG_BASE + 0x400) return 0x04000000u + (u32)(a - REG_BASE);
+    if (a >= PAL_BASE && a < PAL_BASE + 0x400) return 0x05000000u + (u32)(a - PAL_BASE);
+    return (u32)a;
+}
+
+void raster_report(void) {
+    for (int i = 0; i < RASTER_CHANNELS; ++i) {
+        const RasterChannel* c = &channels[i];
+        if (!c->reg) continue;
+        dbg_printf("[raster] ch %d: DMA%d -> 0x%08lx x%d, %d transfers/frame, ~%d cycles", i, c->dma,
+                   (unsigned long)target_addr(c->reg), c->width, RASTER_LINES,
+                   RASTER_LINES * DMA_CYCLES_PER_LINE(1));
+    }
+    dbg_printf("[raster] total ~%lu DMA cycles/frame (%lu.%lu%% of frame), CPU during VDraw 0, commits %lu, late %lu",
+               (unsigned long)stats.dma_cycles, (unsigned long)(stats.dma_cycles * 100 / CYCLES_PER_FRAME),
+               (unsigned long)(stats.dma_cycles * 1000 / CYCLES_PER_FRAME % 10),
+               (unsigned long)stats.commits, (unsigned long)stats.late);
+}
@@ -0,0 +1,608 @@
+// save.c
+// 세이브: SRAM / Flash 백엔드 + 추가 전용 저널 + 프레임 분할 쓰기 (include/save.h 참고)
+// ---------------------------------------------------------
+
+#include <string.h>
+
+#include "save.h"
+#include "timer.h"
+#include "debug.h"
+
+#define SECTOR_MAGIC    0x4A564153u // "SAVJ"
+#define SECTOR_HDR      12          // 표식, 지운 횟수, ~지운 횟수
+#define REC_MAGIC       0x4A53      // "SJ"
+#define REC_HDR         8           // 표식(2), 길이(2), 번호(4)
+#define REC_TRAILER     3           // CRC16(2), 커밋(1)
+#define REC_COMMITTED   0x00
+#define SAVE_RETRIES    2
+#define FLASH_BANK_SIZE 0x10000
+#define ID_WAIT_LINES   300         // ID 모드 진입 후 대기 (느린 칩은 ~20ms 필요)
+
+// 레코드 전체 크기 (4바이트 단위로 올림)
+#define REC_SIZE(len)   (((len) + REC_HDR + REC_TRAILER + 3) & ~3u)
+
+typedef enum {
+    ST_IDLE,
+    ST_ERASE,       // 지우기 시작
+    ST_ERASE_WAIT,  // Flash: 다 지워질 때까지 확인 / SRAM: 0xFF로 조금씩 채움
+    ST_HEADER,      // 섹터 헤더
+    ST_RECORD,      // 레코드 조각 + 커밋
+} SaveState;
+
+static SaveType  type    = SAVE_NONE;
+static int       sectors = 0;
+static int       bank    = -1;         // Flash128 현재 뱅크 (-1 = 모름)
+static u32       wear[SAVE_MAX_SECTORS];
+static SaveStats stats;
+
+// 마지막으로 커밋된 레코드 (칩 안 주소) + 다음 쓰기 위치
+static bool      have_record = false;
+static u32       last_addr   = 0;
+static u32       last_len    = 0;
+static int       cur_sector  = -1;     // -1 = 아직 연 섹터 없음
+static u32       cur_off     = 0;
+
+// 쓰기 상태 기계
+static SaveState state        = ST_IDLE;
+static int       target       = 0;     // 지우는 중 / 헤더를 쓸 섹터
+static u32       wait_count   = 0;     // 지우기 대기 프레임 / SRAM 채운 바이트
+static int       retries      = 0;
+static u32       updates      = 0;     // save_update 호출 수 (= 프레임)
+
+static u8        stage[SAVE_MAX_DATA] EWRAM_BSS;   // 지금 쓰는 데이터
+static u8        pending[SAVE_MAX_DATA] EWRAM_BSS; // 다음에 쓸 데이터 (마지막 요청 하나)
+static int       stage_len    = 0;
+static int       pending_len  = 0;                 // 0 = 없음
+static u32       stage_req    = 0;                 // 요청한 시점 (updates)
+static u32       pending_req  = 0;
+
+static u8        rec_hdr[REC_HDR];
+static u8        rec_tail[REC_TRAILER];
+static u32       rec_pos      = 0;     // 레코드에서 지금까지 쓴 바이트 (커밋 바이트 제외)
+static u16       rec_crc      = 0;
+
+// ---------------------------------------------------------
+// 1. 도움 함수
+// ---------------------------------------------------------
+// CRC-16/CCITT (다항식 0x1021), 4비트 표
+static const u16 crc_nibble[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+};
+
+static u16 crc16(u16 crc, const u8* p, int n) {
+    while (n-- > 0) {
+        crc = (u16)((crc << 4) ^ crc_nibble[(crc >> 12) ^ (*p >> 4)]);
+        crc = (u16)((crc << 4) ^ crc_nibble[(crc >> 12) ^ (*p & 0x0F)]);
+        ++p;
+    }
+    return crc;
+}
+
+static inline u32 get32(const u8* p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((u32)p[3] << 24);
+}
+
+static inline void put32(u8* p, u32 v) {
+    p[0] = (u8)v; p[1] = (u8)(v >> 8); p[2] = (u8)(v >> 16); p[3] = (u8)(v >> 24);
+}
+
+static inline u32 chip_size(void) {
+    return (type == SAVE_SRAM) ? 0x8000 : (type == SAVE_FLASH64) ? 0x10000 : 0x20000;
+}
+
+static void wait_lines(int n) {
+    u16 last = REG_VCOUNT;
+    while (n > 0) {
+        u16 v = REG_VCOUNT;
+        if (v != last) {
+            last = v;
+            --n;
+        }
+    }
+}
+
+// 칩 주소 -> 버스 주소 (Flash128은 필요하면 뱅크 전환)
+static u32 bus_addr(u32 addr) {
+    if (type != SAVE_FLASH128) return addr;
+
+    int b = (int)(addr / FLASH_BANK_SIZE);
+    if (b != bank) {
+        save_flash_cmd(0xB0);
+        SRAM_WRITE(0x0000, b);
+        bank = b;
+    }
+    return addr % FLASH_BANK_SIZE;
+}
+
+// 한 섹터 안의 구간만 넘길 것 (섹터는 뱅크 경계를 넘지 않음)
+static void chip_read(u32 addr, u8* dst, int n) {
+    save_bus_read(bus_addr(addr), dst, n);
+}
+
+static bool chip_write(u32 addr, const u8* src, int n) {
+    stats.bytes += n;
+    if (type == SAVE_SRAM) {
+        save_bus_write(addr, src, n);
+        return true;
+    }
+    return save_flash_program(bus_addr(addr), src, n);
+}
+
+static inline u8 chip_byte(u32 addr) {
+    u8 v;
+    chip_read(addr, &v, 1);
+    return v;
+}
+
+static void update_wear(void) {
+    stats.wear_min = 0xFFFFFFFFu;
+    stats.wear_max = 0;
+    for (int i = 0; i < sectors; ++i) {
+        if (wear[i] < stats.wear_min) stats.wear_min = wear[i];
+        if (wear[i] > stats.wear_max) stats.wear_max = wear[i];
+    }
+}
+
+// ---------------------------------------------------------
+// 2. 복구
+// ---------------------------------------------------------
+// 커밋된 레코드 중 번호가 limit보다 작은 것 가운데 가장 큰 것을 찾음 (헤더만 확인)
+static bool find_latest(u32 limit, u32* out_addr, u32* out_len, u32* out_seq) {
+    bool found = false;
+
+    for (int s = 0; s < sectors; ++s) {
+        u32 base = (u32)s * SAVE_SECTOR_SIZE;
+        u8  h[SECTOR_HDR];
+
+        chip_read(base, h, SECTOR_HDR);
+        if (get32(h) != SECTOR_MAGIC) continue;
+
+        for (u32 off = SECTOR_HDR; off + REC_HDR + REC_TRAILER <= SAVE_SECTOR_SIZE;) {
+            u8 r[REC_HDR];
+            chip_read(base + off, r, REC_HDR);
+
+            u32 len = r[2] | (r[3] << 8);
+            if ((r[0] | (r[1] << 8)) != REC_MAGIC || len == 0 || len > SAVE_MAX_DATA) break;
+            if (off + REC_SIZE(len) > SAVE_SECTOR_SIZE) break;
+            if (chip_byte(base + off + REC_HDR + len + 2) != REC_COMMITTED) break; // 쓰다 끊긴 레코드
+
+            u32 seq = get32(r + 4);
+            if (seq < limit && (!found || seq > *out_seq)) {
+                found     = true;
+                *out_addr = base + off;
+                *out_len  = len;
+                *out_seq  = seq;
+            }
+            off += REC_SIZE(len);
+        }
+    }
+    return found;
+}
+
+static bool check_crc(u32 addr, u32 len) {
+    u8  buf[64];
+    u8  r[REC_HDR];
+    u16 crc;
+
+    chip_read(addr, r, REC_HDR);
+    crc = crc16(0xFFFF, r + 2, REC_HDR - 2);
+
+    for (u32 done = 0; done < len;) {
+        int n = (len - done > sizeof(buf)) ? (int)sizeof(buf) : (int)(len - done);
+        chip_read(addr + REC_HDR + done, buf, n);
+        crc = crc16(crc, buf, n);
+        done += n;
+    }
+
+    u8 t[2];
+    chip_read(addr + REC_HDR + len, t, 2);
+    return crc == (u16)(t[0] | (t[1] << 8));
+}
+
+// 마지막 레코드 뒤가 모두 0xFF인지 (아니면 쓰다 끊긴 흔적 -> 그 섹터에는 더 못 씀)
+static bool tail_clean(u32 addr, u32 end) {
+    u8 buf[64];
+
+    while (addr < end) {
+        int n = (end - addr > sizeof(buf)) ? (int)sizeof(buf) : (int)(end - addr);
+        chip_read(addr, buf, n);
+        for (int i = 0; i < n; ++i) {
+            if (buf[i] != 0xFF) return false;
+        }
+        addr += n;
+    }
+    return true;
+}
+
+static void recover(void) {
+    u32 max_wear = 0;
+    u8  h[SECTOR_HDR];
+
+    // 섹터 헤더의 지운 횟수 (빈 섹터는 0, 헤더가 깨진 섹터는 가장 많이 닳은 것으로 침)
+    for (int s = 0; s < sectors; ++s) {
+        chip_read((u32)s * SAVE_SECTOR_SIZE, h, SECTOR_HDR);
+        bool ok    = get32(h) == SECTOR_MAGIC && get32(h + 4) == ~get32(h + 8);
+        bool blank = get32(h) == 0xFFFFFFFFu && get32(h + 4) == 0xFFFFFFFFu;
+        wear[s] = ok ? get32(h + 4) : blank ? 0 : 0xFFFFFFFFu;
+        if (ok && wear[s] > max_wear) max_wear = wear[s];
+    }
+    for (int s = 0; s < sectors; ++s) {
+        if (wear[s] == 0xFFFFFFFFu) wear[s] = max_wear;
+    }
+
+    // 번호가 큰 것부터 CRC 확인
+    u32 limit = 0xFFFFFFFFu, addr = 0, len = 0, seq = 0;
+
+    have_record = false;
+    cur_sector  = -1;
+    stats.seq   = 0;
+    while (find_latest(limit, &addr, &len, &seq)) {
+        if (check_crc(addr, len)) {
+            have_record = true;
+            break;
+        }
+        ++stats.errors;
+        limit = seq;
+    }
+    if (!have_record) return;
+
+    last_addr  = addr;
+    last_len   = len;
+    stats.seq  = seq;
+    cur_sector = (int)(addr / SAVE_SECTOR_SIZE);
+    cur_off    = addr % SAVE_SECTOR_SIZE + REC_SIZE(len);
+
+    u32 base = (u32)cur_sector * SAVE_SECTOR_SIZE;
+    if (!tail_clean(base + cur_off, base + SAVE_SECTOR_SIZE)) cur_off = SAVE_SECTOR_SIZE;
+}
+
+// ---------------------------------------------------------
+// 3. 초기화
+// ---------------------------------------------------------
+static bool flash_id_ok(void) {
+    save_flash_cmd(0x90);
+    wait_lines(ID_WAIT_LINES);
+    u16 id = (u16)(SRAM_READ(0) | (SRAM_READ(1) << 8)); // 장치 << 8 | 제조사
+    save_flash_cmd(0xF0);
+    wait_lines(ID_WAIT_LINES);
+
+    switch (id) {
+        case 0xD4BF: // SST 39VF512
+        case 0x1CC2: // Macronix MX29L512
+        case 0x1B32: // Panasonic MN63F805MNP
+            return type == SAVE_FLASH64;
+        case 0x09C2: // Macronix MX29L010
+        case 0x1362: // Sanyo LE26FV10N1TS
+            return type == SAVE_FLASH128;
+        default:
+            return false;
+    }
+}
+
+int save_init(SaveType t) {
+    type    = SAVE_NONE;
+    state   = ST_IDLE;
+    bank    = -1;
+    retries = 0;
+    stage_len = pending_len = 0;
+    memset(&stats, 0, sizeof(stats));
+
+    if (t <= SAVE_NONE || t >= SAVE_TYPE_COUNT) return -1;
+
+    // SRAM/Flash 영역 대기 8사이클 (Flash는 더 빠르게 하면 읽기가 깨짐)
+    REG_WAITCNT = (REG_WAITCNT & ~WAIT_SRAM_MASK) | WAIT_SRAM_8;
+
+    type = t;
+    if (type != SAVE_SRAM && !flash_id_ok()) {
+        type = SAVE_NONE;
+        return -1;
+    }
+    sectors = (int)(chip_size() / SAVE_SECTOR_SIZE);
+
+    // 조각 비용은 돌고 있는 사이클 카운터의 차이로 잼 (아직 안 돌고 있으면 시작)
+    if (!(REG_TM_CNT_H(3) & TM_ENABLE)) cycle_counter_start();
+
+    recover();
+    update_wear();
+    return have_record ? (int)last_len : 0;
+}
+
+int save_load(void* dst, int max) {
+    // 읽는 도중 VBlank의 save_update가 지우기 / 쓰기 명령을 보내거나 커밋(last_addr 갱신)하지 않게
+    // 읽기가 끝날 때까지 인터럽트를 끔. 쓰기가 진행 중이면 어느 단계든 읽지 않음
+    // (Flash는 명령 사이클 / 지우기 / 바이트 쓰기 중에 데이터 대신 상태를 돌려줌)
+    u16 ime = REG_IME;
+    REG_IME = 0;
+
+    int len;
+    if (type == SAVE_NONE || !have_record) {
+        len = 0;
+    } else if (state != ST_IDLE) {
+        len = -1;
+    } else {
+        u32 n = (max < (int)last_len) ? (u32)max : last_len;
+        chip_read(last_addr + REC_HDR, (u8*)dst, (int)n);
+        len = (int)last_len;
+    }
+
+    REG_IME = ime;
+    return len;
+}
+
+void save_erase_all(void) {
+    if (type == SAVE_NONE) return;
+
+    static const u8 ff[64] = {
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    };
+
+    if (type == SAVE_SRAM) {
+        for (u32 a = 0; a < chip_size(); a += sizeof(ff)) save_bus_write(a, ff, sizeof(ff));
+    } else {
+        save_flash_cmd(0x80);
+        save_flash_cmd(0x10);
+        while (SRAM_READ(0) != 0xFF) wait_lines(1); // 칩 전체 지우기 (~1초)
+    }
+
+    // 지운 횟수는 이어서 셈 (칩 전체 = 모든 섹터 1회)
+    for (int s = 0; s < sectors; ++s) ++wear[s];
+    update_wear();
+
+    state       = ST_IDLE;
+    have_record = false;
+    cur_sector  = -1;
+    stage_len   = pending_len = 0;
+    stats.seq   = 0;
+}
+
+// ---------------------------------------------------------
+// 4. 쓰기 상태 기계
+// ---------------------------------------------------------
+static int next_sector(void) {
+    if (cur_sector >= 0) return (cur_sector + 1) % sectors;
+
+    // 처음 여는 섹터: 가장 덜 닳은 곳
+    int best = 0;
+    for (int s = 1; s < sectors; ++s) {
+        if (wear[s] < wear[best]) best = s;
+    }
+    return best;
+}
+
+// 레코드 헤더를 만들고 CRC를 헤더 부분까지 계산해 둠
+static void begin_stream(void) {
+    rec_hdr[0] = (u8)REC_MAGIC;
+    rec_hdr[1] = (u8)(REC_MAGIC >> 8);
+    rec_hdr[2] = (u8)stage_len;
+    rec_hdr[3] = (u8)(stage_len >> 8);
+    put32(rec_hdr + 4, stats.seq + 1);
+
+    rec_pos = 0;
+    rec_crc = crc16(0xFFFF, rec_hdr + 2, REC_HDR - 2);
+}
+
+static void start_record(void) {
+    begin_stream();
+
+    if (cur_sector < 0 || cur_off + REC_SIZE(stage_len) > SAVE_SECTOR_SIZE) {
+        target = next_sector();
+        state  = ST_ERASE;
+    } else {
+        state  = ST_RECORD;
+    }
+}
+
+// 실패: 실패한 섹터의 다음 섹터를 지우고 레코드를 처음부터 (한도를 넘으면 요청을 버림)
+static void fail(void) {
+    int bad = (state == ST_RECORD) ? cur_sector : target;
+
+    ++stats.errors;
+    if (++retries > SAVE_RETRIES) {
+        ++stats.dropped;
+        retries   = 0;
+        stage_len = 0;
+        state     = ST_IDLE;
+        return;
+    }
+    begin_stream();
+    target = (bad + 1) % sectors;
+    state  = ST_ERASE;
+}
+
+static void step_erase(void) {
+    u32 base = (u32)target * SAVE_SECTOR_SIZE;
+
+    if (type == SAVE_SRAM) {
+        wait_count = 0;
+    } else {
+        bus_addr(base);
+        save_flash_cmd(0x80);
+        SRAM_WRITE(0x5555, 0xAA);
+        SRAM_WRITE(0x2AAA, 0x55);
+        SRAM_WRITE(base % FLASH_BANK_SIZE, 0x30);
+        wait_count = 0;
+    }
+    state = ST_ERASE_WAIT;
+}
+
+static void step_erase_wait(void) {
+    u32 base = (u32)target * SAVE_SECTOR_SIZE;
+
+    if (type == SAVE_SRAM) {
+        // SRAM은 지우기 명령이 없으므로 0xFF로 채움 (Flash와 같은 형식을 쓰기 위해)
+        u8 ff[64];
+        memset(ff, 0xFF, sizeof(ff));
+        for (u32 end = wait_count + SAVE_FILL_BYTES; wait_count < end && wait_count < SAVE_SECTOR_SIZE; wait_count += sizeof(ff)) {
+            save_bus_write(base + wait_count, ff, sizeof(ff));
+        }
+        if (wait_count < SAVE_SECTOR_SIZE) return;
+    } else {
+        // 지우는 중에는 0xFF가 아닌 값이 읽힘 (데이터 폴링)
+        if (chip_byte(base) != 0xFF || chip_byte(base + SAVE_SECTOR_SIZE - 1) != 0xFF) {
+            if (++wait_count > SAVE_ERASE_FRAMES) fail();
+            return;
+        }
+    }
+
+    ++wear[target];
+    ++stats.erases;
+    update_wear();
+    state = ST_HEADER;
+}
+
+static void step_header(void) {
+    u8 h[SECTOR_HDR];
+
+    put32(h, SECTOR_MAGIC);
+    put32(h + 4, wear[target]);
+    put32(h + 8, ~wear[target]);
+    if (!chip_write((u32)target * SAVE_SECTOR_SIZE, h, SECTOR_HDR)) {
+        fail();
+        return;
+    }
+    cur_sector = target;
+    cur_off    = SECTOR_HDR;
+    state      = ST_RECORD;
+}
+
+// 레코드 = 헤더 + 데이터 + CRC를 한 줄로 보고 rec_pos부터 SAVE_STEP_BYTES만큼 씀
+static void step_record(void) {
+    u32 total = REC_HDR + stage_len + 2;
+    u32 addr  = (u32)cur_sector * SAVE_SECTOR_SIZE + cur_off;
+    u8  buf[SAVE_STEP_BYTES];
+    int n     = 0;
+
+    while (n < SAVE_STEP_BYTES && rec_pos + n < total) {
+        u32 i = rec_pos + n;
+
+        if (i < REC_HDR) {
+            buf[n++] = rec_hdr[i];
+        } else if (i < REC_HDR + stage_len) {
+            // 데이터 조각: 이번에 쓸 만큼 한 번에 CRC 갱신
+            int k = REC_HDR + stage_len - i;
+            if (k > SAVE_STEP_BYTES - n) k = SAVE_STEP_BYTES - n;
+            memcpy(buf + n, stage + (i - REC_HDR), k);
+            rec_crc = crc16(rec_crc, buf + n, k);
+            n += k;
+        } else {
+            rec_tail[0] = (u8)rec_crc;
+            rec_tail[1] = (u8)(rec_crc >> 8);
+            buf[n++] = rec_tail[i - REC_HDR - stage_len];
+        }
+    }
+
+    if (n && !chip_write(addr + rec_pos, buf, n)) {
+        fail();
+        return;
+    }
+    rec_pos += n;
+    if (rec_pos < total) return;
+
+    // 커밋 바이트는 맨 마지막, 따로 한 번
+    u8 commit = REC_COMMITTED;
+    if (!chip_write(addr + total, &commit, 1)) {
+        fail();
+        return;
+    }
+
+    have_record = true;
+    last_addr   = addr;
+    last_len    = stage_len;
+    cur_off    += REC_SIZE(stage_len);
+    retries     = 0;
+
+    ++stats.seq;
+    ++stats.commits;
+    stats.latency = updates - stage_req;
+    if (stats.latency > stats.latency_max) stats.latency_max = stats.latency;
+
+    // 기다리던 요청이 있으면 바로 이어서
+    stage_len = 0;
+    state     = ST_IDLE;
+    if (pending_len) {
+        memcpy(stage, pending, pending_len);
+        stage_len   = pending_len;
+        stage_req   = pending_req;
+        pending_len = 0;
+        start_record();
+    }
+}
+
+bool save_write(const void* src, int len) {
+    if (type == SAVE_NONE || !src || len <= 0 || len > SAVE_MAX_DATA) return false;
+
+    // save_update()가 VBlank 핸들러에서 돌 수 있으므로, 상태 확인 ~ pending/stage 갱신 사이에
+    // 커밋이 끼어들지 않게 인터럽트를 잠깐 끔 (반쯤 복사된 pending이 레코드로 가거나, 요청이 남겨지는 것 방지)
+    u16 ime = REG_IME;
+    REG_IME = 0;
+
+    if (state != ST_IDLE) {
+        if (!pending_len) pending_req = updates; // 지연은 처음 기다리기 시작한 때부터
+        memcpy(pending, src, len);
+        pending_len = len;
+    } else {
+        memcpy(stage, src, len);
+        stage_len = len;
+        stage_req = updates;
+        start_record();
+    }
+
+    REG_IME = ime;
+    return true;
+}
+
+void save_update(void) {
+    ++updates;
+    if (state == ST_IDLE) return;
+
+    u32 t0 = cycle_counter_read();
+
+    switch (state) {
+        case ST_ERASE:      step_erase();      break;
+        case ST_ERASE_WAIT: step_erase_wait(); break;
+        case ST_HEADER:     step_header();     break;
+        case ST_RECORD:     step_record();     break;
+        default:                               break;
+    }
+
+    u32 t1 = cycle_counter_read();
+    stats.step_cycles = (t1 >= t0) ? t1 - t0 : 0; // 중간에 카운터가 재시작되면 0
+    if (stats.step_cycles > stats.step_max) stats.step_max = stats.step_cycles;
+}
+
+bool save_busy(void) {
+    u16 ime = REG_IME;
+    REG_IME = 0;
+    bool busy = state != ST_IDLE || pending_len != 0;
+    REG_IME = ime;
+    return busy;
+}
+
+// ---------------------------------------------------------
+// 5. 통계
+// ---------------------------------------------------------
+const SaveStats* save_stats(void) {
+    return &stats;
+}
+
+const char* save_type_name(SaveType t) {
+    switch (t) {
+        case SAVE_SRAM:     return "sram";
+        case SAVE_FLASH64:  return "flash64";
+        case SAVE_FLASH128: return "flash128";
+        default:            return "none";
+    }
+}
+
+void save_report(void) {
+    dbg_printf("[save] %s seq %lu: %lu commits, %lu bytes, %lu erases, latency %lu (max %lu) frames, "
+               "step %lu (max %lu) cycles, wear %lu~%lu, errors %u, dropped %u",
+               save_type_name(type), (unsigned long)stats.seq, (unsigned long)stats.commits,
+               (unsigned long)stats.bytes, (unsigned long)stats.erases, (unsigned long)stats.latency,
+               (unsigned long)stats.latency_max, (unsigned long)stats.step_cycles, (unsigned long)stats.step_max,
+               (unsigned long)stats.wear_min, (unsigned long)stats.wear_max, stats.errors, stats.dropped);
+}
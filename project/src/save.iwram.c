@@ -0,0 +1,41 @@
+// save.iwram.c
+// 세이브 칩 버스 접근: 바이트 읽기/쓰기 + Flash 명령 (include/save.h 참고)
+// ---------------------------------------------------------
+// 파일 이름의 .iwram 때문에 makefile이 -marm -mlong-calls로 컴파일하고
+// 링커가 코드째 IWRAM에 배치함. (호스트 빌드에서는 평범한 C 파일)
+
+#include "save.h"
+
+// 바이트 쓰기 완료 대기 한도 (보통 수십 us = 수백 번 안에 끝남)
+#define PROGRAM_POLL_MAX 0x1000
+
+void save_bus_read(u32 off, u8* dst, int n) {
+    while (n-- > 0) *dst++ = SRAM_READ(off++);
+}
+
+void save_bus_write(u32 off, const u8* src, int n) {
+    while (n-- > 0) SRAM_WRITE(off++, *src++);
+}
+
+void save_flash_cmd(u8 cmd) {
+    SRAM_WRITE(0x5555, 0xAA);
+    SRAM_WRITE(0x2AAA, 0x55);
+    SRAM_WRITE(0x5555, cmd);
+}
+
+// 쓰는 동안 칩은 다른 값을 돌려주다가, 끝나면 쓴 값이 그대로 읽힘 (데이터 폴링)
+bool save_flash_program(u32 off, const u8* src, int n) {
+    while (n-- > 0) {
+        u8 v = *src++;
+
+        save_flash_cmd(0xA0);
+        SRAM_WRITE(off, v);
+
+        int t = PROGRAM_POLL_MAX;
+        while (SRAM_READ(off) != v) {
+            if (--t == 0) return false;
+        }
+        ++off;
+    }
+    return true;
+}
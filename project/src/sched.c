@@ -0,0 +1,232 @@
+// sched.c
+// 프레임 예산 스케줄러: 상태 update -> 태스크 -> VBlank 대기 -> 상태 render (include/sched.h 참고)
+// ---------------------------------------------------------
+
+#include "sched.h"
+#include "state.h"
+#include "irq.h"
+#include "prof.h"
+#include "debug.h"
+
+#define STARVE (SCHED_AGING * SCHED_PRIO_COUNT) // 이만큼 밀리면 남은 예산이 조금이라도 있을 때 한 조각 실행
+
+// 핸들 = 세대 << 8 | 슬롯 (세대는 1 ~ 0x7FFF, 0은 쓰지 않음 -> 핸들은 항상 양수)
+#define HANDLE(i, gen) ((int)(((u32)(gen) << 8) | (u32)(i)))
+#define SLOT(h)        ((h) & 0xFF)
+#define GEN(h)         ((u16)((h) >> 8))
+
+static Task       tasks[SCHED_MAX_TASKS];
+static u32        budget = SCHED_BUDGET;
+static u32        frame_start = 0;   // 직전 VBlank 직후 시각
+static u32        frame_no    = 0;
+static int        rr          = 0;   // 같은 우선순위끼리 돌아가며 먼저 실행
+static SchedStats stats;
+
+static inline u32 elapsed(void) {
+    return cycle_counter_read() - frame_start;
+}
+
+void sched_init(void) {
+    for (int i = 0; i < SCHED_MAX_TASKS; ++i) {
+        tasks[i].fn  = NULL;
+        tasks[i].gen = 0;
+    }
+
+    budget   = SCHED_BUDGET;
+    frame_no = 0;
+    rr       = 0;
+
+    SchedStats zero = { 0 };
+    stats = zero;
+
+    cycle_counter_start();
+    frame_start = cycle_counter_read();
+}
+
+void sched_set_budget(u32 cycles) {
+    budget = cycles ? cycles : SCHED_BUDGET;
+}
+
+// ---------------------------------------------------------
+// 1. 태스크 목록
+// ---------------------------------------------------------
+int sched_spawn(TaskFn fn, void* ctx, SchedPrio prio, const char* name) {
+    for (int i = 0; i < SCHED_MAX_TASKS; ++i) {
+        Task* t = &tasks[i];
+        if (t->fn) continue;
+
+        t->fn       = fn;
+        t->ctx      = ctx;
+        t->name     = name;
+        t->pc       = 0;
+        t->prio     = (u8)prio;
+        t->deferred = 0;
+        t->wake     = frame_no;
+        t->cost     = 0;
+        t->cycles   = 0;
+        t->slices   = 0;
+        t->skips    = 0;
+        t->gen      = (u16)((t->gen & 0x7FFF) + 1);
+        if (t->gen > 0x7FFF) t->gen = 1;
+        return HANDLE(i, t->gen);
+    }
+    return -1;
+}
+
+// 핸들이 가리키는 살아 있는 태스크 (끝났거나 슬롯이 다시 쓰였으면 NULL)
+static Task* lookup(int id) {
+    if (id < 0 || SLOT(id) >= SCHED_MAX_TASKS) return NULL;
+    Task* t = &tasks[SLOT(id)];
+    return (t->fn && t->gen == GEN(id)) ? t : NULL;
+}
+
+void sched_kill(int id) {
+    Task* t = lookup(id);
+    if (t) t->fn = NULL;
+}
+
+bool sched_alive(int id) {
+    return lookup(id) != NULL;
+}
+
+void sched_sleep(Task* t, int frames) {
+    t->wake = frame_no + (u32)(frames > 0 ? frames : 1);
+}
+
+u32 sched_remaining(void) {
+    u32 e = elapsed();
+    return (e < budget) ? budget - e : 0;
+}
+
+// ---------------------------------------------------------
+// 2. 실행
+// ---------------------------------------------------------
+// 조각 하나 실행 + 비용 기록. 반환값: 같은 프레임에 또 실행해도 되면 true
+static bool run_slice(Task* t) {
+    u16        gen = t->gen;
+    u32        t0  = cycle_counter_read();
+    TaskStatus r   = t->fn(t, t->ctx);
+    u32        c   = cycle_counter_read() - t0;
+
+    // 조각 안에서 자기 자신이 kill되었으면 (그 사이 슬롯에 새 태스크가 들어왔을 수도 있음) 손대지 않음
+    if (!t->fn || t->gen != gen) return false;
+
+    // 조각 비용 추정 = 지수 평균 (새 값 1/4), 처음에는 그대로
+    t->cost    = t->cost ? (t->cost * 3 + c) >> 2 : c;
+    t->cycles += c;
+    ++t->slices;
+
+    if (r == TASK_DONE) {
+        t->fn = NULL;
+        return false;
+    }
+    if (r == TASK_WAITING) {
+        if (t->wake <= frame_no) t->wake = frame_no + 1;
+        return false;
+    }
+    return true;
+}
+
+static inline bool runnable(const Task* t) {
+    return t->fn && t->wake <= frame_no;
+}
+
+// 오래 밀린 태스크는 SCHED_AGING 프레임마다 한 단계 앞으로 (SCHED_HIGH까지)
+static inline int effective_prio(const Task* t) {
+    int p = t->prio - t->deferred / SCHED_AGING;
+    return (p < SCHED_HIGH) ? SCHED_HIGH : p;
+}
+
+static void run_budgeted(void) {
+    bool ran[SCHED_MAX_TASKS] = { false };
+
+    for (int p = SCHED_HIGH; p < SCHED_PRIO_COUNT; ++p) {
+        for (int k = 0; k < SCHED_MAX_TASKS; ++k) {
+            int   i = (rr + k) % SCHED_MAX_TASKS;
+            Task* t = &tasks[i];
+            if (ran[i] || t->prio == SCHED_CRITICAL || !runnable(t) || effective_prio(t) != p) continue;
+
+            ran[i] = true;
+            bool any = false;
+
+            for (;;) {
+                if (!t->fn) break; // 다른 태스크나 update가 kill한 경우
+                u32 e = elapsed();
+                if (e >= budget) break;
+                // 다음 조각이 예산을 넘길 것 같으면 미룸. 단, 오래 굶은 태스크는 첫 조각만 허용
+                if (e + t->cost > budget && !(t->deferred >= STARVE && !any)) break;
+
+                any = true;
+                if (!run_slice(t)) break;
+            }
+
+            if (any) {
+                t->deferred = 0;
+            } else {
+                if (t->deferred < 255) ++t->deferred;
+                ++t->skips;
+                ++stats.deferrals;
+            }
+        }
+    }
+}
+
+void sched_frame(void) {
+    state_apply();
+
+    // 1. 매 프레임 반드시: 상태 update + CRITICAL 태스크 (조각 하나씩)
+    state_update();
+    for (int i = 0; i < SCHED_MAX_TASKS; ++i) {
+        Task* t = &tasks[i];
+        if (t->prio == SCHED_CRITICAL && runnable(t)) run_slice(t);
+    }
+
+    // 2. 남은 예산으로 나머지 태스크
+    run_budgeted();
+    rr = (rr + 1) % SCHED_MAX_TASKS;
+
+    u32 used = elapsed();
+    stats.last_used = used;
+    if (used > stats.peak_used) stats.peak_used = used;
+    if (used > budget) ++stats.overruns;
+
+    // 3. VBlank 대기 -> 그리기
+    PROF_BEGIN("wait");
+    vblank_wait();
+    PROF_END("wait");
+
+    frame_start = cycle_counter_read();
+    ++frame_no;
+    ++stats.frames;
+
+    state_render();
+}
+
+// ---------------------------------------------------------
+// 3. 통계
+// ---------------------------------------------------------
+const SchedStats* sched_stats(void) {
+    return &stats;
+}
+
+void sched_report(void) {
+    static const char* const prio_names[SCHED_PRIO_COUNT] = { "critical", "high", "normal", "low" };
+
+    dbg_printf("[sched] frames %lu, budget %lu, peak %lu (%lu%% of budget), overruns %lu, deferrals %lu",
+               (unsigned long)stats.frames, (unsigned long)budget, (unsigned long)stats.peak_used,
+               (unsigned long)(stats.peak_used * 100 / budget), (unsigned long)stats.overruns,
+               (unsigned long)stats.deferrals);
+
+    for (int i = 0; i < SCHED_MAX_TASKS; ++i) {
+        Task* t = &tasks[i];
+        if (!t->fn) continue;
+
+        dbg_printf("[sched]   %-10s %-8s %8lu cycles, %4u slices, %4u skipped frames, slice ~%lu",
+                   t->name ? t->name : "?", prio_names[t->prio], (unsigned long)t->cycles,
+                   t->slices, t->skips, (unsigned long)t->cost);
+        t->cycles = 0;
+        t->slices = 0;
+        t->skips  = 0;
+    }
+    stats.peak_used = 0;
+}
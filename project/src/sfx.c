@@ -0,0 +1,188 @@
+// sfx.c
+// 색 효과: Shadow 레지스터 + 프레임 곡선 (include/sfx.h 참고)
+// ---------------------------------------------------------
+
+#include "sfx.h"
+
+#define T_SHIFT    20              // 곡선 진행도 t의 소수부 (1.0 = 1 << 20)
+#define C_SHIFT    12              // 곡선 계산 정밀도
+#define T_ONE      (1u << T_SHIFT)
+#define C_ONE      (1 << C_SHIFT)
+
+enum { RAMP_FADE, RAMP_ALPHA, RAMP_MOSAIC, RAMP_COUNT };
+
+// 값 두 개(예: EVA, EVB)를 같은 곡선으로 from -> to
+typedef struct {
+    s8   from[2], to[2];
+    u32  t, dt;    // 진행도 (T_SHIFT), 프레임당 증가량
+    u8   curve;
+    bool active;
+} Ramp;
+
+static Ramp     ramps[RAMP_COUNT];
+static s8       value[RAMP_COUNT][2]; // 현재 계수 (페이드는 [0]만)
+static SfxStats stats;
+
+// Shadow (sfx_vblank가 레지스터로)
+static u16  bldcnt, bldalpha, bldy, mosaic;
+static bool dirty = false;
+
+static inline int clampi(int v, int lo, int hi) {
+    return v < lo ? lo : v > hi ? hi : v;
+}
+
+// 곡선 모양 적용: t (0 ~ C_ONE) -> 0 ~ C_ONE
+static int shape(int t, int curve) {
+    switch (curve) {
+        case SFX_EASE_IN:  return (t * t) >> C_SHIFT;
+        case SFX_EASE_OUT: return C_ONE - (((C_ONE - t) * (C_ONE - t)) >> C_SHIFT);
+        case SFX_SMOOTH:   return (((t * t) >> C_SHIFT) * (3 * C_ONE - 2 * t)) >> C_SHIFT;
+        default:           return t;
+    }
+}
+
+// 계수 -> Shadow (바뀐 것이 있으면 dirty)
+static void rebuild(u16 cnt) {
+    u16 a = BLDALPHA_BUILD(value[RAMP_ALPHA][0], value[RAMP_ALPHA][1]);
+    u16 y = (u16)value[RAMP_FADE][0];
+    u16 m = MOSAIC_BUILD(value[RAMP_MOSAIC][0], value[RAMP_MOSAIC][0], value[RAMP_MOSAIC][1], value[RAMP_MOSAIC][1]);
+
+    if (cnt != bldcnt || a != bldalpha || y != bldy || m != mosaic) {
+        bldcnt   = cnt;
+        bldalpha = a;
+        bldy     = y;
+        mosaic   = m;
+        dirty    = true;
+    }
+}
+
+static void start(int r, int a0, int a1, int b0, int b1, int frames, SfxCurve curve) {
+    Ramp* p = &ramps[r];
+
+    p->from[0] = (s8)a0; p->to[0] = (s8)a1;
+    p->from[1] = (s8)b0; p->to[1] = (s8)b1;
+    p->curve   = (u8)curve;
+    p->t       = 0;
+
+    if (frames <= 0) {
+        // 곡선 없이 바로 목표값
+        p->active   = false;
+        value[r][0] = (s8)a1;
+        value[r][1] = (s8)b1;
+        return;
+    }
+    p->dt       = T_ONE / (u32)frames; // 곡선당 나눗셈은 이 한 번뿐
+    p->active   = true;
+    value[r][0] = (s8)a0;
+    value[r][1] = (s8)b0;
+}
+
+// ---------------------------------------------------------
+// 1. 프레임
+// ---------------------------------------------------------
+void sfx_init(void) {
+    for (int r = 0; r < RAMP_COUNT; ++r) {
+        ramps[r].active = false;
+        value[r][0] = value[r][1] = 0;
+    }
+    bldcnt = bldalpha = bldy = mosaic = 0;
+    dirty  = true;
+}
+
+void sfx_update(void) {
+    ++stats.updates;
+
+    for (int r = 0; r < RAMP_COUNT; ++r) {
+        Ramp* p = &ramps[r];
+        if (!p->active) continue;
+
+        p->t += p->dt;
+        if (p->t >= T_ONE - (p->dt >> 1)) { // 마지막 프레임은 나머지 오차 없이 정확히 목표값
+            p->t      = T_ONE;
+            p->active = false;
+        }
+
+        int c = shape((int)(p->t >> (T_SHIFT - C_SHIFT)), p->curve);
+        for (int i = 0; i < 2; ++i) {
+            int d = p->to[i] - p->from[i];
+            value[r][i] = (s8)(p->from[i] + ((d * c + C_ONE / 2) >> C_SHIFT));
+        }
+    }
+    rebuild(bldcnt);
+}
+
+void sfx_vblank(void) {
+    if (!dirty) return;
+
+    REG_BLDCNT   = bldcnt;
+    REG_BLDALPHA = bldalpha;
+    REG_BLDY     = bldy;
+    REG_MOSAIC   = mosaic;
+    dirty = false;
+
+    stats.reg_writes += 4;
+    ++stats.applies;
+}
+
+bool sfx_busy(void) {
+    for (int r = 0; r < RAMP_COUNT; ++r) {
+        if (ramps[r].active) return true;
+    }
+    return false;
+}
+
+// ---------------------------------------------------------
+// 2. 밝기
+// ---------------------------------------------------------
+void sfx_fade(u16 layers, u16 mode, int from, int to, int frames, SfxCurve curve) {
+    from = clampi(from, 0, SFX_EV_MAX);
+    to   = clampi(to, 0, SFX_EV_MAX);
+
+    start(RAMP_FADE, from, to, 0, 0, frames, curve);
+    rebuild((u16)((layers & BLD_ALL) | (mode & BLD_BLACK)));
+}
+
+// ---------------------------------------------------------
+// 3. 반투명
+// ---------------------------------------------------------
+void sfx_alpha(u16 top, u16 bottom, int eva, int evb) {
+    eva = clampi(eva, 0, SFX_EV_MAX);
+    evb = clampi(evb, 0, SFX_EV_MAX);
+
+    start(RAMP_ALPHA, eva, eva, evb, evb, 0, SFX_LINEAR);
+    rebuild((u16)((top & BLD_ALL) | BLD_ALPHA | BLD_BOTTOM(bottom & BLD_ALL)));
+}
+
+void sfx_alpha_ramp(int eva, int evb, int frames, SfxCurve curve) {
+    eva = clampi(eva, 0, SFX_EV_MAX);
+    evb = clampi(evb, 0, SFX_EV_MAX);
+
+    start(RAMP_ALPHA, value[RAMP_ALPHA][0], eva, value[RAMP_ALPHA][1], evb, frames, curve);
+    rebuild(bldcnt);
+}
+
+// ---------------------------------------------------------
+// 4. 모자이크
+// ---------------------------------------------------------
+void sfx_mosaic(int bg, int obj) {
+    bg  = clampi(bg, 0, SFX_MOSAIC_MAX);
+    obj = clampi(obj, 0, SFX_MOSAIC_MAX);
+
+    start(RAMP_MOSAIC, bg, bg, obj, obj, 0, SFX_LINEAR);
+    rebuild(bldcnt);
+}
+
+void sfx_mosaic_ramp(int bg, int obj, int frames, SfxCurve curve) {
+    bg  = clampi(bg, 0, SFX_MOSAIC_MAX);
+    obj = clampi(obj, 0, SFX_MOSAIC_MAX);
+
+    start(RAMP_MOSAIC, value[RAMP_MOSAIC][0], bg, value[RAMP_MOSAIC][1], obj, frames, curve);
+    rebuild(bldcnt);
+}
+
+// ---------------------------------------------------------
+// 5. 통계
+// ---------------------------------------------------------
+const SfxStats* sfx_stats(void) {
+    return &stats;
+}
@@ -0,0 +1,233 @@
+// sound.c
+// 사운드 믹서: Direct Sound 설정, 이중 버퍼, 채널 관리 (include/sound.h 참고)
+// ---------------------------------------------------------
+
+#include "sound.h"
+#include "raster.h"
+#include "timer.h"
+#include "debug.h"
+
+typedef struct {
+    const s8* data;
+    u32       pos;      // Q12
+    u32       inc;      // Q12, 출력 샘플당 진행량 (pitch 반영)
+    u32       base_inc; // pitch 1.0일 때의 inc
+    u32       end;      // Q12 (length << 12)
+    u32       loop_len; // Q12, 0 = 한 번만
+    u8        vol, pan;
+    bool      active;
+} Voice;
+
+static Voice voices[SOUND_VOICES];
+
+// 출력 버퍼 (DMA가 읽음, 4바이트 정렬 필수) + 누적 버퍼 (스테레오면 L, R 교대)
+static s8  out_a[2][SOUND_BUF_LEN] __attribute__((aligned(4)));
+static s8  out_b[2][SOUND_BUF_LEN] __attribute__((aligned(4)));
+static s32 acc[SOUND_BUF_LEN * 2];
+
+static bool          started = false; // sound_init 이후 DMA1(+ 스테레오면 DMA2)을 씀
+static bool          stereo  = true;
+static int           front   = 0;     // DMA가 읽는 쪽
+static int           mixed   = 0;     // 마지막으로 믹싱한 쪽 (sound_last_mix)
+static volatile bool ready   = false; // 뒤쪽 버퍼가 채워짐 (다음 VBlank에 교체)
+static SoundStats    stats;
+
+#define SOUND_DMA_CTRL (DMA_DST_FIXED | DMA_REPEAT | DMA_32 | DMA_AT_SPECIAL | 4)
+
+static void start_dma(void) {
+    dma_transfer(1, out_a[front], &REG_FIFO_A, SOUND_DMA_CTRL);
+    if (stereo) dma_transfer(2, out_b[front], &REG_FIFO_B, SOUND_DMA_CTRL);
+}
+
+// ---------------------------------------------------------
+// 1. 초기화 / 프레임
+// ---------------------------------------------------------
+void sound_init(bool use_stereo) {
+    if (use_stereo && raster_uses_dma(2)) { // FIFO B용 DMA2를 스캔라인 채널이 쓰는 중
+        dbg_log(LOG_WARN, "[sound] DMA2 is used by a raster channel, starting in mono");
+        use_stereo = false;
+    }
+
+    if (started && stereo && !use_stereo) dma_stop(2); // 스테레오 -> 모노로 다시 초기화
+
+    started = true;
+    stereo  = use_stereo;
+    front   = 0;
+    mixed   = 0;
+    ready   = false;
+
+    for (int i = 0; i < SOUND_VOICES; ++i) voices[i].active = false;
+    for (int i = 0; i < SOUND_BUF_LEN; ++i) {
+        out_a[0][i] = out_a[1][i] = 0;
+        out_b[0][i] = out_b[1][i] = 0;
+        acc[i * 2] = acc[i * 2 + 1] = 0;
+    }
+
+    // 전체 켜기가 먼저 (꺼져 있으면 다른 사운드 레지스터에 쓸 수 없음)
+    REG_SOUNDCNT_X = SNDSTAT_ENABLE;
+    REG_SOUNDCNT_L = 0;
+    REG_SOUNDCNT_H = stereo ? (SDS_A100 | SDS_AL | SDS_ARESET | SDS_B100 | SDS_BR | SDS_BRESET)
+                            : (SDS_A100 | SDS_AL | SDS_AR | SDS_ARESET);
+
+    start_dma();
+
+    REG_TM_CNT_H(0) = 0;
+    REG_TM_CNT_L(0) = (u16)(0x10000 - SOUND_TIMER_PERIOD);
+    REG_TM_CNT_H(0) = TM_ENABLE;
+
+    // 믹싱 비용은 돌고 있는 사이클 카운터의 차이로 잼 (아직 안 돌고 있으면 시작)
+    if (!(REG_TM_CNT_H(3) & TM_ENABLE)) cycle_counter_start();
+}
+
+bool sound_uses_dma(int ch) {
+    return started && (ch == 1 || (ch == 2 && stereo));
+}
+
+void sound_vblank(void) {
+    if (ready) {
+        front ^= 1;
+        ready = false;
+    } else {
+        ++stats.late; // 같은 버퍼를 한 번 더
+    }
+    start_dma();
+}
+
+// 채널 하나를 버퍼 길이만큼 누적. 끝/반복 지점 전까지를 한 번에 커널로 넘김
+static void mix_voice(Voice* v) {
+    int vl = v->vol, vr = v->vol;
+
+    if (stereo) {
+        vl = v->vol * (v->pan > SOUND_PAN_CENTER ? SOUND_PAN_RIGHT - v->pan : SOUND_PAN_CENTER) >> 6;
+        vr = v->vol * (v->pan < SOUND_PAN_CENTER ? v->pan : SOUND_PAN_CENTER) >> 6;
+    }
+
+    s32* a    = acc;
+    int  left = SOUND_BUF_LEN;
+
+    while (left > 0) {
+        // pos가 end에 닿기 전까지 낼 수 있는 샘플 수 = ceil((end - pos) / inc)
+        int run = (int)((v->end - v->pos + v->inc - 1) / v->inc);
+        if (run > left) run = left;
+
+        if (stereo) {
+            v->pos = sound_mix_stereo(a, run, v->data, v->pos, v->inc, vl, vr);
+            a += run * 2;
+        } else {
+            v->pos = sound_mix_mono(a, run, v->data, v->pos, v->inc, vl);
+            a += run;
+        }
+        left -= run;
+
+        if (v->pos >= v->end) {
+            if (!v->loop_len) {
+                v->active = false;
+                return;
+            }
+            while (v->pos >= v->end) v->pos -= v->loop_len;
+        }
+    }
+}
+
+void sound_update(void) {
+    if (ready) return;
+
+    u32 t0    = cycle_counter_read();
+    int back  = front ^ 1;
+    int count = 0;
+
+    for (int i = 0; i < SOUND_VOICES; ++i) {
+        if (!voices[i].active) continue;
+        mix_voice(&voices[i]);
+        ++count;
+    }
+
+    if (stereo) sound_clip_stereo(out_a[back], out_b[back], acc, SOUND_BUF_LEN);
+    else        sound_clip_mono(out_a[back], acc, SOUND_BUF_LEN);
+
+    mixed = back;
+    ready = true;
+
+    u32 t1 = cycle_counter_read();
+    stats.mix_cycles = (t1 >= t0) ? t1 - t0 : 0; // 중간에 카운터가 재시작되면 0
+    if (stats.mix_cycles > stats.mix_max) stats.mix_max = stats.mix_cycles;
+    stats.voices = (u16)count;
+    ++stats.frames;
+}
+
+// ---------------------------------------------------------
+// 2. 채널
+// ---------------------------------------------------------
+static inline bool valid(int voice) {
+    return voice >= 0 && voice < SOUND_VOICES;
+}
+
+static inline u32 pitch_inc(u32 base_inc, fixed pitch) {
+    if (pitch <= 0) pitch = FIX_ONE;
+    if (pitch > INT_TO_FIX(8)) pitch = INT_TO_FIX(8);
+
+    u32 inc = (base_inc * (u32)pitch) >> FIX_SHIFT;
+    return inc ? inc : 1;
+}
+
+int sound_play(const SoundSample* s, int vol, int pan, fixed pitch) {
+    if (!s || !s->data || s->length == 0) return -1;
+
+    for (int i = 0; i < SOUND_VOICES; ++i) {
+        Voice* v = &voices[i];
+        if (v->active) continue;
+
+        v->data     = s->data;
+        v->pos      = 0;
+        v->end      = s->length << SOUND_POS_SHIFT;
+        v->loop_len = (s->loop_start < s->length) ? (s->length - s->loop_start) << SOUND_POS_SHIFT : 0;
+        v->base_inc = (s->rate << SOUND_POS_SHIFT) / SOUND_RATE;
+        v->inc      = pitch_inc(v->base_inc, pitch);
+        sound_set_volume(i, vol, pan);
+        v->active   = true;
+        return i;
+    }
+    return -1;
+}
+
+void sound_stop(int voice) {
+    if (valid(voice)) voices[voice].active = false;
+}
+
+void sound_set_volume(int voice, int vol, int pan) {
+    if (!valid(voice)) return;
+
+    if (vol < 0)               vol = 0;
+    if (vol > SOUND_VOL_MAX)   vol = SOUND_VOL_MAX;
+    if (pan < SOUND_PAN_LEFT)  pan = SOUND_PAN_LEFT;
+    if (pan > SOUND_PAN_RIGHT) pan = SOUND_PAN_RIGHT;
+    voices[voice].vol = (u8)vol;
+    voices[voice].pan = (u8)pan;
+}
+
+void sound_set_pitch(int voice, fixed pitch) {
+    if (valid(voice)) voices[voice].inc = pitch_inc(voices[voice].base_inc, pitch);
+}
+
+bool sound_playing(int voice) {
+    return valid(voice) && voices[voice].active;
+}
+
+// ---------------------------------------------------------
+// 3. 비용
+// ---------------------------------------------------------
+const SoundStats* sound_stats(void) {
+    return &stats;
+}
+
+const s8* sound_last_mix(bool right) {
+    return (right && stereo) ? out_b[mixed] : out_a[mixed];
+}
+
+void sound_report(void) {
+    dbg_printf("[sound] %s %dHz, %d samples/frame, %u voices: mix %lu cycles (%lu.%lu%% of frame), max %lu, late %u",
+               stereo ? "stereo" : "mono", SOUND_RATE, SOUND_BUF_LEN, stats.voices,
+               (unsigned long)stats.mix_cycles, (unsigned long)(stats.mix_cycles * 100 / CYCLES_PER_FRAME),
+               (unsigned long)(stats.mix_cycles * 1000 / CYCLES_PER_FRAME % 10), (unsigned long)stats.mix_max,
+               stats.late);
+}
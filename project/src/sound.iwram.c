@@ -0,0 +1,72 @@
+// sound.iwram.c
+// 믹서 커널: 채널 누적 + 8비트 클리핑 (include/sound.h 참고)
+// ---------------------------------------------------------
+// 파일 이름의 .iwram 때문에 makefile이 -marm -mlong-calls로 컴파일하고
+// 링커가 코드째 IWRAM에 배치함. (호스트 빌드에서는 평범한 C 파일)
+
+#include "sound.h"
+
+// 호출하는 쪽(sound.c)이 끝/반복 지점 전까지만 n을 잘라 주므로 위치 검사 없이 돌림
+// 샘플 하나 = 읽기 1 + 곱셈 누적 2 + 누적 버퍼 읽기/쓰기 2 (2개씩 펼침)
+u32 sound_mix_stereo(s32* acc, int n, const s8* data, u32 pos, u32 inc, int vl, int vr) {
+    while (n >= 2) {
+        int s0 = data[pos >> SOUND_POS_SHIFT];
+        pos += inc;
+        int s1 = data[pos >> SOUND_POS_SHIFT];
+        pos += inc;
+
+        acc[0] += s0 * vl;
+        acc[1] += s0 * vr;
+        acc[2] += s1 * vl;
+        acc[3] += s1 * vr;
+        acc += 4;
+        n   -= 2;
+    }
+    if (n) {
+        int s = data[pos >> SOUND_POS_SHIFT];
+        pos += inc;
+        acc[0] += s * vl;
+        acc[1] += s * vr;
+    }
+    return pos;
+}
+
+u32 sound_mix_mono(s32* acc, int n, const s8* data, u32 pos, u32 inc, int vol) {
+    while (n >= 4) {
+        acc[0] += data[pos >> SOUND_POS_SHIFT] * vol; pos += inc;
+        acc[1] += data[pos >> SOUND_POS_SHIFT] * vol; pos += inc;
+        acc[2] += data[pos >> SOUND_POS_SHIFT] * vol; pos += inc;
+        acc[3] += data[pos >> SOUND_POS_SHIFT] * vol; pos += inc;
+        acc += 4;
+        n   -= 4;
+    }
+    while (n--) {
+        *acc++ += data[pos >> SOUND_POS_SHIFT] * vol;
+        pos    += inc;
+    }
+    return pos;
+}
+
+// 볼륨 64 = 1.0 이므로 >> 6 후 [-128, 127]로 자름
+static inline s8 clip8(s32 v) {
+    v >>= 6;
+    if (v > 127)  v = 127;
+    if (v < -128) v = -128;
+    return (s8)v;
+}
+
+void sound_clip_stereo(s8* out_l, s8* out_r, s32* acc, int n) {
+    for (int i = 0; i < n; ++i, acc += 2) {
+        out_l[i] = clip8(acc[0]);
+        out_r[i] = clip8(acc[1]);
+        acc[0]   = 0;
+        acc[1]   = 0;
+    }
+}
+
+void sound_clip_mono(s8* out, s32* acc, int n) {
+    for (int i = 0; i < n; ++i) {
+        out[i] = clip8(acc[i]);
+        acc[i] = 0;
+    }
+}
@@ -0,0 +1,82 @@
+// span.iwram.c
+// IWRAM 스팬 커널 (include/span.h 참고)
+// ---------------------------------------------------------
+// 파일 이름의 .iwram 때문에 makefile이 -marm -mlong-calls로 컴파일하고
+// 링커가 코드째 IWRAM에 배치함. (호스트 빌드에서는 평범한 C 파일)
+
+#include "span.h"
+
+// 머리(정렬) + 몸통(2픽셀씩 32비트, 8워드 단위 펼침) + 꼬리(홀수 1픽셀)
+static inline void fill_one(u16* p, int len, u16 color) {
+    if ((uintptr_t)p & 2) {
+        *p++ = color;
+        if (--len == 0) return;
+    }
+
+    u32* w     = (u32*)p;
+    u32  pair  = color | ((u32)color << 16);
+    int  words = len >> 1;
+
+    // 8워드씩: 컴파일러가 레지스터 8개에 pair를 복사해 stmia 한 번으로 묶을 수 있음
+    while (words >= 8) {
+        w[0] = pair; w[1] = pair; w[2] = pair; w[3] = pair;
+        w[4] = pair; w[5] = pair; w[6] = pair; w[7] = pair;
+        w     += 8;
+        words -= 8;
+    }
+    while (words--) *w++ = pair;
+
+    if (len & 1) *(u16*)w = color;
+}
+
+void span_fill16(u16* p, int len, u16 color) {
+    fill_one(p, len, color);
+}
+
+void span_fill_rows16(u16* row, int pitch, int len, int rows, u16 color) {
+    while (rows--) {
+        fill_one(row, len, color);
+        row += pitch;
+    }
+}
+
+// ceil(Q16.16)과 [0, width) 클리핑
+static inline void edge_range(const SpanEdges* e, int width, int* x0, int* x1) {
+    int a = (e->xl + 0xFFFF) >> 16;
+    int b = (e->xr + 0xFFFF) >> 16;
+
+    *x0 = (a < 0) ? 0 : a;
+    *x1 = (b > width) ? width : b;
+}
+
+void span_fill_edges8(u16* row, int pitch, int rows, int width, SpanEdges* e, u16 color) {
+    u16 index = (u16)(color & 0xFF);
+    u16 pair  = (u16)(index | (index << 8));
+
+    for (; rows--; row += pitch, e->xl += e->dxl, e->xr += e->dxr) {
+        int x0, x1;
+        edge_range(e, width, &x0, &x1);
+        if (x0 >= x1) continue;
+
+        // 홀수 머리/꼬리는 바이트 하나만 바꿔 쓰고(RMW), 가운데는 픽셀 쌍
+        if (x0 & 1) {
+            u16* p = row + (x0 >> 1);
+            *p = (u16)((*p & 0x00FF) | (index << 8));
+            ++x0;
+        }
+        if (x1 & 1) {
+            u16* p = row + (x1 >> 1);
+            if (x0 < x1) *p = (u16)((*p & 0xFF00) | index);
+            --x1;
+        }
+        if (x0 < x1) fill_one(row + (x0 >> 1), (x1 - x0) >> 1, pair);
+    }
+}
+
+void span_fill_edges16(u16* row, int pitch, int rows, int width, SpanEdges* e, u16 color) {
+    for (; rows--; row += pitch, e->xl += e->dxl, e->xr += e->dxr) {
+        int x0, x1;
+        edge_range(e, width, &x0, &x1);
+        if (x0 < x1) fill_one(row + x0, x1 - x0, color);
+    }
+}
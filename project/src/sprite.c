@@ -0,0 +1,217 @@
+// sprite.c
+// Shadow OAM 스프라이트 배칭: 버킷 정렬 + 컬링 + VBlank DMA (include/sprite.h 참고)
+// ---------------------------------------------------------
+
+#include "sprite.h"
+
+// OAM과 같은 배치: 스프라이트당 u16 4개 (attr0, attr1, attr2, 아핀 파라미터)
+// 4번째 칸은 아핀 행렬이 나눠 쓰므로 배치가 건드리지 않음
+static u16 shadow_oam[SPRITE_MAX * 4] __attribute__((aligned(4)));
+
+static volatile bool shadow_busy  = false; // sprite_end가 쓰는 중
+static volatile bool shadow_ready = false; // 전송할 내용 있음
+
+// 배치 목록 (화면 좌표로 변환 + 속성 완성된 상태)
+typedef struct {
+    u16 attr0, attr1, attr2;
+    u8  next; // 같은 버킷의 다음 항목
+} BatchEntry;
+
+#define BUCKET_END 0xFF
+
+static BatchEntry batch[SPRITE_MAX];
+static int        batch_count = 0;
+static u8         bucket_head[SPRITE_BUCKETS];
+static u8         bucket_tail[SPRITE_BUCKETS];
+
+static u32 reserved[SPRITE_MAX / 32]; // 고정 슬롯 비트맵
+static int camera_x = 0, camera_y = 0;
+
+static SpriteStats stats;
+
+// 픽셀 크기 (SpriteSize 순서)
+static const u8 size_w[12] = { 8, 16, 32, 64,  16, 32, 32, 64,   8,  8, 16, 32 };
+static const u8 size_h[12] = { 8, 16, 32, 64,   8,  8, 16, 32,  16, 32, 32, 64 };
+
+static inline bool is_reserved(int slot) {
+    return reserved[slot >> 5] & (1u << (slot & 31));
+}
+
+// 화면 좌표 -> attr0 / attr1 (좌표는 하드웨어 비트 수만큼 잘라서 자연스럽게 순환)
+static inline u16 make_attr0(int y, SpriteSize size) {
+    return (u16)(ATTR0_Y(y) | ((size >> 2) << 14));
+}
+
+static inline u16 make_attr1(int x, SpriteSize size, u16 flip) {
+    return (u16)(ATTR1_X(x) | flip | ATTR1_SIZE(size & 3));
+}
+
+void sprite_init(void) {
+    for (int i = 0; i < SPRITE_MAX; ++i) {
+        shadow_oam[i * 4 + 0] = ATTR0_HIDE;
+        shadow_oam[i * 4 + 1] = 0;
+        shadow_oam[i * 4 + 2] = 0;
+        shadow_oam[i * 4 + 3] = 0;
+    }
+    for (int i = 0; i < SPRITE_MAX / 32; ++i) reserved[i] = 0;
+
+    shadow_ready = false;
+    dma_transfer(3, shadow_oam, OAM, DMA_32 | (SPRITE_MAX * 8 / 4));
+}
+
+void sprite_set_camera(int x, int y) {
+    camera_x = x;
+    camera_y = y;
+}
+
+// ---------------------------------------------------------
+// 1. 배치
+// ---------------------------------------------------------
+void sprite_begin(void) {
+    for (int i = 0; i < SPRITE_BUCKETS; ++i) bucket_head[i] = BUCKET_END;
+
+    batch_count     = 0;
+    stats.submitted = 0;
+    stats.culled    = 0;
+    stats.dropped   = 0;
+    stats.visible   = 0;
+}
+
+// 화면 좌표 (sx, sy)에 w x h 영역을 그리는 항목 추가 (컬링 + 버킷 연결)
+static bool batch_push(int sx, int sy, int w, int h, u16 attr0, u16 attr1, u16 attr2, int layer) {
+    stats.submitted++;
+
+    // [컬링] 화면과 조금도 겹치지 않으면 버림
+    if (sx >= SCREEN_W || sy >= SCREEN_H || sx + w <= 0 || sy + h <= 0) {
+        stats.culled++;
+        return false;
+    }
+
+    if (batch_count >= SPRITE_MAX) {
+        stats.dropped++;
+        return false;
+    }
+
+    int         i = batch_count++;
+    BatchEntry* e = &batch[i];
+    e->attr0 = attr0;
+    e->attr1 = attr1;
+    e->attr2 = attr2;
+    e->next  = BUCKET_END;
+
+    // [버킷 정렬] 꼬리에 매달기 (같은 키는 추가 순서 유지)
+    int key = ((attr2 >> 10) & 3) * SPRITE_LAYERS + (layer & (SPRITE_LAYERS - 1));
+    if (bucket_head[key] == BUCKET_END) bucket_head[key] = (u8)i;
+    else                                batch[bucket_tail[key]].next = (u8)i;
+    bucket_tail[key] = (u8)i;
+
+    return true;
+}
+
+bool sprite_add(int x, int y, SpriteSize size, u16 attr2, u16 flip, int layer) {
+    int sx = x - camera_x;
+    int sy = y - camera_y;
+
+    return batch_push(sx, sy, size_w[size], size_h[size], make_attr0(sy, size), make_attr1(sx, size, flip),
+                      attr2, layer);
+}
+
+bool sprite_add_affine(int cx, int cy, SpriteSize size, u16 attr2, int matrix, bool dbl, int layer) {
+    int w  = size_w[size] << dbl;
+    int h  = size_h[size] << dbl;
+    int sx = cx - camera_x - w / 2;
+    int sy = cy - camera_y - h / 2;
+
+    u16 attr0 = (u16)(make_attr0(sy, size) | (dbl ? ATTR0_AFF_DBL : ATTR0_AFFINE));
+    u16 attr1 = make_attr1(sx, size, (u16)ATTR1_AFF_ID(matrix & 31));
+
+    return batch_push(sx, sy, w, h, attr0, attr1, attr2, layer);
+}
+
+void sprite_end(void) {
+    int slot = 0;
+
+    shadow_busy = true;
+
+    // 버킷 순서대로 비어 있는(예약 안 된) 슬롯에 채움
+    for (int key = 0; key < SPRITE_BUCKETS; ++key) {
+        for (int i = bucket_head[key]; i != BUCKET_END; i = batch[i].next) {
+            while (slot < SPRITE_MAX && is_reserved(slot)) ++slot;
+            if (slot >= SPRITE_MAX) {
+                stats.dropped++;
+                continue;
+            }
+
+            u16* obj = &shadow_oam[slot * 4];
+            obj[0] = batch[i].attr0;
+            obj[1] = batch[i].attr1;
+            obj[2] = batch[i].attr2;
+            ++slot;
+            stats.visible++;
+        }
+    }
+
+    // 남은 슬롯 숨기기
+    for (; slot < SPRITE_MAX; ++slot) {
+        if (!is_reserved(slot)) shadow_oam[slot * 4] = ATTR0_HIDE;
+    }
+
+    shadow_busy  = false;
+    shadow_ready = true;
+}
+
+void sprite_set_matrix(int matrix, s16 pa, s16 pb, s16 pc, s16 pd) {
+    u16* m = &shadow_oam[(matrix & 31) * 16 + 3];
+    m[0]  = (u16)pa;
+    m[4]  = (u16)pb;
+    m[8]  = (u16)pc;
+    m[12] = (u16)pd;
+}
+
+// ---------------------------------------------------------
+// 2. VBlank 전송
+// ---------------------------------------------------------
+void sprite_vblank(void) {
+    if (shadow_busy || !shadow_ready) return;
+
+    dma_transfer(3, shadow_oam, OAM, DMA_32 | (SPRITE_MAX * 8 / 4));
+    shadow_ready = false;
+}
+
+const SpriteStats* sprite_stats(void) {
+    return &stats;
+}
+
+// ---------------------------------------------------------
+// 3. 고정 슬롯
+// ---------------------------------------------------------
+int sprite_alloc(void) {
+    for (int w = 0; w < SPRITE_MAX / 32; ++w) {
+        if (reserved[w] == 0xFFFFFFFFu) continue;
+
+        int bit  = __builtin_ctz(~reserved[w]);
+        int slot = w * 32 + bit;
+        reserved[w] |= 1u << bit;
+        shadow_oam[slot * 4] = ATTR0_HIDE;
+        return slot;
+    }
+    return -1;
+}
+
+void sprite_free(int slot) {
+    if (slot < 0 || slot >= SPRITE_MAX) return;
+
+    reserved[slot >> 5] &= ~(1u << (slot & 31));
+    shadow_oam[slot * 4] = ATTR0_HIDE;
+}
+
+void sprite_set(int slot, int x, int y, SpriteSize size, u16 attr2, u16 flip) {
+    u16* obj = &shadow_oam[slot * 4];
+    obj[0] = make_attr0(y, size);
+    obj[1] = make_attr1(x, size, flip);
+    obj[2] = attr2;
+}
+
+void sprite_hide(int slot) {
+    shadow_oam[slot * 4] = ATTR0_HIDE;
+}
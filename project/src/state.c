@@ -0,0 +1,171 @@
+// state.c
+// 게임 상태 스택 + 스택 아레나 (include/state.h 참고)
+// ---------------------------------------------------------
+
+#include "state.h"
+#include "mem.h"
+#include "timer.h"
+
+enum { OP_PUSH, OP_POP };
+
+typedef struct {
+    const GameState* s;
+    void*            mem;
+    u32              mark;  // push 직전 아레나 위치 (pop하면 여기로)
+} Level;
+
+typedef struct {
+    u8               op;
+    const GameState* s;
+} Pending;
+
+static u32        arena[STATE_ARENA_SIZE / 4] EWRAM_BSS;
+static u32        arena_top = 0; // 바이트
+static Level      stack[STATE_MAX_DEPTH];
+static int        depth = 0;
+static Pending    queue[STATE_MAX_PENDING];
+static int        queued = 0;
+static StateStats stats;
+
+void state_init(void) {
+    arena_top = 0;
+    depth     = 0;
+    queued    = 0;
+
+    StateStats zero = { 0 };
+    stats = zero;
+}
+
+// ---------------------------------------------------------
+// 1. 요청 (큐)
+// ---------------------------------------------------------
+static void enqueue(int op, const GameState* s) {
+    if (queued >= STATE_MAX_PENDING) {
+        ++stats.failures;
+        return;
+    }
+    queue[queued].op = (u8)op;
+    queue[queued].s  = s;
+    ++queued;
+}
+
+void state_push(const GameState* s) {
+    enqueue(OP_PUSH, s);
+}
+
+void state_pop(void) {
+    enqueue(OP_POP, NULL);
+}
+
+void state_switch(const GameState* s) {
+    if (queued + 2 > STATE_MAX_PENDING) { // 반쪽만 들어가면 빈 스택이 되므로 둘 다 버림
+        ++stats.failures;
+        return;
+    }
+    enqueue(OP_POP, NULL);
+    enqueue(OP_PUSH, s);
+}
+
+// ---------------------------------------------------------
+// 2. 반영
+// ---------------------------------------------------------
+void* state_alloc(u32 bytes) {
+    bytes = (bytes + 3) & ~3u;
+    if (bytes > STATE_ARENA_SIZE - arena_top) {
+        ++stats.failures;
+        return NULL;
+    }
+
+    u32* p = &arena[arena_top / 4];
+    mem_fill32(p, 0, bytes / 4);
+    arena_top += bytes;
+
+    stats.arena_used = arena_top;
+    if (arena_top > stats.arena_peak) stats.arena_peak = arena_top;
+    return p;
+}
+
+static void do_pop(void) {
+    if (depth == 0) return;
+
+    Level* l = &stack[--depth];
+    if (l->s->leave) l->s->leave(l->mem);
+    arena_top        = l->mark;
+    stats.arena_used = arena_top;
+    ++stats.transitions;
+}
+
+static void do_push(const GameState* s) {
+    if (depth >= STATE_MAX_DEPTH) {
+        ++stats.failures;
+        return;
+    }
+
+    Level* l = &stack[depth];
+    l->s    = s;
+    l->mark = arena_top;
+    l->mem  = NULL;
+    if (s->size) {
+        l->mem = state_alloc(s->size);
+        if (!l->mem) return;
+    }
+    ++depth;
+    ++stats.transitions;
+
+    if (s->enter) s->enter(l->mem);
+}
+
+bool state_apply(void) {
+    if (queued == 0) return false;
+
+    u32 t0 = cycle_counter_read();
+
+    // enter()가 또 요청을 넣을 수 있으므로 큐를 비운 뒤 차례로 실행
+    Pending ops[STATE_MAX_PENDING];
+    int     n = queued;
+    for (int i = 0; i < n; ++i) ops[i] = queue[i];
+    queued = 0;
+
+    for (int i = 0; i < n; ++i) {
+        if (ops[i].op == OP_POP) do_pop();
+        else                     do_push(ops[i].s);
+    }
+
+    stats.last_cycles = cycle_counter_read() - t0;
+    if (stats.last_cycles > stats.peak_cycles) stats.peak_cycles = stats.last_cycles;
+    return true;
+}
+
+// ---------------------------------------------------------
+// 3. 프레임
+// ---------------------------------------------------------
+// flag가 켜진 동안 아래로 내려간 첫 단계
+static int lowest(u8 flag) {
+    int i = depth - 1;
+    while (i > 0 && (stack[i].s->flags & flag)) --i;
+    return i;
+}
+
+void state_update(void) {
+    for (int i = lowest(STATE_UPDATE_BELOW); i >= 0 && i < depth; ++i) {
+        if (stack[i].s->update) stack[i].s->update(stack[i].mem);
+    }
+}
+
+void state_render(void) {
+    for (int i = lowest(STATE_RENDER_BELOW); i >= 0 && i < depth; ++i) {
+        if (stack[i].s->render) stack[i].s->render(stack[i].mem);
+    }
+}
+
+const GameState* state_top(void) {
+    return depth ? stack[depth - 1].s : NULL;
+}
+
+int state_depth(void) {
+    return depth;
+}
+
+const StateStats* state_stats(void) {
+    return &stats;
+}
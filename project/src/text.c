@@ -0,0 +1,523 @@
+// text.c
+// 글자 출력: 칸 키 -> 타일 캐시(LRU) + 문자열 비교 + 정수 서식 (include/text.h 참고)
+// ---------------------------------------------------------
+
+#include "text.h"
+#include "bg.h"
+#include "fixed.h"
+#include "mem.h"
+
+typedef unsigned long long u64;
+
+#define POOL      TXT_POOL_TILES
+#define LRU       POOL            // LRU 목록의 머리 (보초, 실제 타일 아님)
+#define HASH_SIZE 256
+#define NONE      (-1)
+
+// 칸 키: [0] 첫 글자의 x (칸 왼쪽 끝 기준, -7 ~ 0), [1] 글자 수, [2 ~ 7] 글자
+typedef union {
+    u8  b[8];
+    u32 w[2];
+} CellKey;
+
+// 타일마다: 키, 참조 수, 해시 체인, LRU 목록 (참조 0인 타일만 목록에 있음)
+static CellKey keys[POOL] EWRAM_BSS;
+static u16     refs[POOL] EWRAM_BSS;
+static s16     hnext[POOL] EWRAM_BSS;
+static s16     lprev[POOL + 1] EWRAM_BSS;
+static s16     lnext[POOL + 1] EWRAM_BSS;
+static s16     head[HASH_SIZE];
+
+static u32 expand[256];       // 글꼴 한 줄(1비트 x 8) -> 4bpp 타일 한 줄 (글자 픽셀 = TXT_INK)
+static int text_cbb, text_sbb;
+static TextStats stats;
+
+static inline int glyph(char c) {
+    return (c >= TXT_FONT_FIRST && c < TXT_FONT_FIRST + TXT_FONT_COUNT) ? c - TXT_FONT_FIRST : '?' - TXT_FONT_FIRST;
+}
+
+static inline int advance(char c) {
+    return txt_font_width[glyph(c)];
+}
+
+static int span(const char* s, int from, int to) {
+    int w = 0;
+    for (int i = from; i < to; ++i) w += advance(s[i]);
+    return w;
+}
+
+static inline u32 hash(const CellKey* k) {
+    return ((k->w[0] ^ (k->w[1] * 0x9E3779B1u)) * 0x85EBCA6Bu) >> 24;
+}
+
+// ---------------------------------------------------------
+// 1. LRU 목록 (참조가 0인 타일)
+// ---------------------------------------------------------
+static inline void lru_unlink(int s) {
+    lnext[lprev[s]] = lnext[s];
+    lprev[lnext[s]] = lprev[s];
+}
+
+// 목록 끝 = 가장 최근에 놓인 타일
+static inline void lru_push(int s) {
+    lprev[s]          = lprev[LRU];
+    lnext[s]          = LRU;
+    lnext[lprev[LRU]] = (s16)s;
+    lprev[LRU]        = (s16)s;
+}
+
+// ---------------------------------------------------------
+// 2. 타일 캐시
+// ---------------------------------------------------------
+// 키 하나를 4bpp 타일로 (글자 한 줄 = u32 하나, 왼쪽 픽셀이 하위 니블)
+static void render(const CellKey* k, u32 out[8]) {
+    for (int r = 0; r < 8; ++r) out[r] = 0;
+
+    int x = (s8)k->b[0];
+    for (int i = 0; i < k->b[1]; ++i) {
+        char c = (char)k->b[2 + i];
+        int  g = glyph(c);
+
+        if (c != ' ') {
+            const u8* bits = txt_font_bits[g];
+            for (int r = 0; r < 8; ++r) {
+                u32 e = expand[bits[r]];
+                out[r] |= (x >= 0) ? e << (x * 4) : e >> (-x * 4);
+            }
+        }
+        x += txt_font_width[g];
+    }
+}
+
+static void unhash(int s) {
+    s16* p = &head[hash(&keys[s])];
+    while (*p != s) p = &hnext[*p];
+    *p = hnext[s];
+}
+
+// 키에 맞는 타일 (참조 +1). 반환값 0 = 타일이 모자람
+static int acquire(const CellKey* k) {
+    u32 h = hash(k);
+
+    for (int s = head[h]; s != NONE; s = hnext[s]) {
+        if (keys[s].w[0] == k->w[0] && keys[s].w[1] == k->w[1]) {
+            if (refs[s]++ == 0) {
+                lru_unlink(s);
+                ++stats.used;
+            }
+            ++stats.hits;
+            return s;
+        }
+    }
+
+    // 없음: 가장 오래 안 쓴 타일을 새 키로 (참조 0 = 화면 어디에도 안 보이는 타일)
+    int s = lnext[LRU];
+    if (s == LRU) {
+        ++stats.overflows;
+        return 0;
+    }
+    lru_unlink(s);
+    if (keys[s].b[1] != 0) {
+        unhash(s);
+        ++stats.evictions;
+    }
+
+    keys[s]  = *k;
+    hnext[s] = head[h];
+    head[h]  = (s16)s;
+    refs[s]  = 1;
+    ++stats.used;
+
+    u32 tile[8];
+    render(k, tile);
+    mem_copy32(CHARBLOCK(text_cbb) + s * 16, tile, 8);
+    ++stats.uploads;
+    stats.vram_bytes += 32;
+    return s;
+}
+
+static void release(int s) {
+    if (s == 0) return;
+    if (--refs[s] == 0) {
+        lru_push(s);
+        --stats.used;
+    }
+}
+
+// ---------------------------------------------------------
+// 3. 초기화
+// ---------------------------------------------------------
+void txt_init(int bg, int cbb, int sbb, u16 flags) {
+    text_cbb = cbb;
+    text_sbb = sbb;
+    bg_setup(bg, cbb, sbb, (u16)(flags | BG_4BPP | BG_SIZE_32x32));
+
+    for (int b = 0; b < 256; ++b) {
+        u32 e = 0;
+        for (int i = 0; i < 8; ++i) {
+            if (b & (1 << i)) e |= (u32)TXT_INK << (i * 4);
+        }
+        expand[b] = e;
+    }
+
+    for (int h = 0; h < HASH_SIZE; ++h) head[h] = NONE;
+
+    lprev[LRU] = lnext[LRU] = LRU;
+    for (int s = 0; s < POOL; ++s) {
+        keys[s].w[0] = keys[s].w[1] = 0;
+        refs[s]  = 0;
+        hnext[s] = NONE;
+        if (s != 0) lru_push(s); // 0번은 항상 빈 타일
+    }
+
+    mem_fill32(CHARBLOCK(cbb), 0, 8);
+    mem_fill32(SCREENBLOCK(sbb), 0, 32 * 32 / 2);
+
+    TextStats zero = { 0 };
+    stats = zero;
+}
+
+void txt_color(int pal, u16 color) {
+    PAL_BG[pal * 16 + TXT_INK] = color;
+}
+
+// ---------------------------------------------------------
+// 4. 필드
+// ---------------------------------------------------------
+// 칸 [px, px + 8)의 키. 공백만 걸친 칸은 글자 수 0
+// i: 이전 칸에서 찾은 첫 글자 (칸은 왼쪽부터 차례로 부르므로 되돌아가지 않음)
+static void cell_key(const char* s, int len, const s16* xs, int px, int* i, CellKey* k) {
+    k->w[0] = k->w[1] = 0;
+
+    // 글자 잉크 = [xs, xs + 폭 - 1), 마지막 1픽셀은 빈칸
+    while (*i < len && xs[*i + 1] - 1 <= px) ++*i;
+
+    int j = *i;
+    while (j < len && s[j] == ' ' && xs[j] < px + 8) ++j;
+    if (j >= len || xs[j] >= px + 8) return;
+
+    int n = 0, used = 0;
+    k->b[0] = (u8)(xs[j] - px);
+    for (int m = j; m < len && xs[m] < px + 8 && n < TXT_CELL_GLYPHS; ++m) {
+        k->b[2 + n++] = (u8)s[m];
+        if (s[m] != ' ') used = n;  // 끝의 공백은 키에서 뺌 (같은 그림을 같은 타일로)
+    }
+    for (int m = used; m < n; ++m) k->b[2 + m] = 0;
+    k->b[1] = (u8)used;
+}
+
+static inline void write_cell(TextField* f, int c, int s) {
+    SCREENBLOCK(text_sbb)[f->ty * 32 + f->tx + c] = (u16)(SE_TILE(s) | SE_PALBANK(f->pal));
+    ++stats.map_writes;
+    stats.vram_bytes += 2;
+}
+
+void txt_field_init(TextField* f, int tx, int ty, int cols, int pal) {
+    if (cols > TXT_COLS_MAX) cols = TXT_COLS_MAX;
+
+    f->tx   = (u8)tx;
+    f->ty   = (u8)ty;
+    f->cols = (u8)cols;
+    f->pal  = (u8)pal;
+    f->len  = 0;
+    f->text[0] = '\0';
+
+    for (int c = 0; c < cols; ++c) {
+        f->cell[c] = 0;
+        write_cell(f, c, 0);
+    }
+}
+
+void txt_print(TextField* f, const char* s) {
+    char n[TXT_FIELD_MAX + 1];
+    int  nl = 0;
+
+    // 글꼴에 없는 문자는 미리 '?'로 (비교와 키가 같은 문자열을 보게)
+    for (; s[nl] && nl < TXT_FIELD_MAX; ++nl) {
+        char c = s[nl];
+        n[nl] = (c >= TXT_FONT_FIRST && c < TXT_FONT_FIRST + TXT_FONT_COUNT) ? c : '?';
+    }
+    n[nl] = '\0';
+
+    const char* o  = f->text;
+    int         ol = f->len;
+
+    // 앞뒤로 같은 부분 잘라내기
+    int p = 0;
+    while (p < ol && p < nl && o[p] == n[p]) ++p;
+    if (p == ol && p == nl) return;
+
+    int q = 0;
+    while (q < ol - p && q < nl - p && o[ol - 1 - q] == n[nl - 1 - q]) ++q;
+
+    // 다시 계산할 픽셀 구간: 가운데 폭이 같으면 뒤 글자는 제자리
+    int x0 = span(n, 0, p);
+    int om = span(o, p, ol - q);
+    int nm = span(n, p, nl - q);
+    int x1;
+    if (om == nm) {
+        x1 = x0 + nm;
+    } else {
+        int ow = x0 + om + span(o, ol - q, ol);
+        int nw = x0 + nm + span(n, nl - q, nl);
+        x1 = (ow > nw) ? ow : nw;
+    }
+
+    s16 xs[TXT_FIELD_MAX + 1];
+    xs[0] = 0;
+    for (int i = 0; i < nl; ++i) xs[i + 1] = (s16)(xs[i] + advance(n[i]));
+
+    int c1 = (x1 + 7) >> 3;
+    if (c1 > f->cols) c1 = f->cols;
+
+    int i = 0;
+    for (int c = x0 >> 3; c < c1; ++c) {
+        CellKey k;
+        cell_key(n, nl, xs, c * 8, &i, &k);
+
+        int old = f->cell[c];
+        if (k.b[1] == 0) {
+            if (old == 0) continue;
+        } else if (old != 0 && keys[old].w[0] == k.w[0] && keys[old].w[1] == k.w[1]) {
+            continue;
+        }
+
+        // 새 타일을 먼저 잡고 옛 타일을 놓음 (화면에 보이는 타일을 덮어쓰지 않게)
+        int s = (k.b[1] == 0) ? 0 : acquire(&k);
+        release(old);
+        f->cell[c] = (u16)s;
+        write_cell(f, c, s);
+    }
+
+    for (int j = 0; j <= nl; ++j) f->text[j] = n[j];
+    f->len = (u8)nl;
+}
+
+int txt_printf(TextField* f, const char* fmt, ...) {
+    char    buf[TXT_FIELD_MAX + 1];
+    va_list args;
+
+    va_start(args, fmt);
+    int n = txt_vformat(buf, sizeof(buf), fmt, args);
+    va_end(args);
+
+    txt_print(f, buf);
+    return n;
+}
+
+void txt_field_color(TextField* f, int pal) {
+    if (f->pal == pal) return;
+
+    f->pal = (u8)pal;
+    for (int c = 0; c < f->cols; ++c) write_cell(f, c, f->cell[c]);
+}
+
+void txt_field_clear(TextField* f) {
+    txt_print(f, "");
+}
+
+// ---------------------------------------------------------
+// 5. 서식
+// ---------------------------------------------------------
+#define F_LEFT  1
+#define F_ZERO  2
+#define F_PLUS  4
+#define F_PREC_MAX 4
+
+typedef struct {
+    char* p;
+    char* end;  // 널 문자 자리
+    int   n;
+} Out;
+
+static inline void emit(Out* o, char c) {
+    if (o->p < o->end) *o->p++ = c;
+    ++o->n;
+}
+
+static inline void emit_n(Out* o, char c, int count) {
+    while (count-- > 0) emit(o, c);
+}
+
+// [부호][0 채움][본문] + 폭 맞추기
+static void emit_field(Out* o, char sign, const char* body, int len, int zeros, int width, int flags) {
+    int pad = width - len - zeros - (sign ? 1 : 0);
+
+    if (!(flags & (F_LEFT | F_ZERO))) emit_n(o, ' ', pad);
+    if (sign) emit(o, sign);
+    if ((flags & (F_LEFT | F_ZERO)) == F_ZERO) emit_n(o, '0', pad);
+    emit_n(o, '0', zeros);
+    for (int i = 0; i < len; ++i) emit(o, body[i]);
+    if (flags & F_LEFT) emit_n(o, ' ', pad);
+}
+
+// 10으로 나누기 = 역수 곱셈 (u32 전 범위에서 정확)
+static inline u32 div10(u32 v) {
+    return (u32)(((u64)v * 0xCCCCCCCDu) >> 35);
+}
+
+// 숫자를 buf 끝에서부터 채움. 반환값: 첫 글자 위치
+static char* utoa_back(char* end, u32 v, int hex, bool upper) {
+    const char* digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+    char*       p      = end;
+
+    do {
+        if (hex) {
+            *--p = digits[v & 15];
+            v >>= 4;
+        } else {
+            u32 q = div10(v);
+            *--p = (char)('0' + (v - q * 10));
+            v    = q;
+        }
+    } while (v);
+    return p;
+}
+
+static const u32 dec_scale[F_PREC_MAX + 1] = { 1, 10, 100, 1000, 10000 };
+
+int txt_vformat(char* buf, int size, const char* fmt, va_list args) {
+    Out o = { buf, buf + (size > 0 ? size - 1 : 0), 0 };
+
+    for (; *fmt; ++fmt) {
+        if (*fmt != '%') {
+            emit(&o, *fmt);
+            continue;
+        }
+
+        int  flags = 0, width = 0, prec = -1;
+        bool is_long = false;
+
+        for (;; ++fmt) {
+            char c = fmt[1];
+            if      (c == '-') flags |= F_LEFT;
+            else if (c == '0') flags |= F_ZERO;
+            else if (c == '+') flags |= F_PLUS;
+            else break;
+        }
+        ++fmt;
+
+        if (*fmt == '*') {
+            width = va_arg(args, int);
+            if (width < 0) { flags |= F_LEFT; width = -width; }
+            ++fmt;
+        } else {
+            while (*fmt >= '0' && *fmt <= '9') width = width * 10 + (*fmt++ - '0');
+        }
+        if (*fmt == '.') {
+            ++fmt;
+            prec = 0;
+            if (*fmt == '*') {
+                prec = va_arg(args, int);
+                ++fmt;
+            } else {
+                while (*fmt >= '0' && *fmt <= '9') prec = prec * 10 + (*fmt++ - '0');
+            }
+        }
+        while (*fmt == 'l' || *fmt == 'h') {
+            if (*fmt == 'l') is_long = true;
+            ++fmt;
+        }
+        if (*fmt == '\0') break;
+
+        char  tmp[24];
+        char* end = tmp + sizeof(tmp);
+        char  sign = 0;
+
+        switch (*fmt) {
+            case 'd':
+            case 'i': {
+                s32 v = is_long ? (s32)va_arg(args, long) : va_arg(args, int);
+                u32 a = (v < 0) ? (u32)0 - (u32)v : (u32)v;
+                if (v < 0)               sign = '-';
+                else if (flags & F_PLUS) sign = '+';
+
+                char* p   = utoa_back(end, a, 0, false);
+                int   len = (int)(end - p);
+                if (prec == 0 && a == 0) len = 0;
+                if (prec >= 0) flags &= ~F_ZERO;
+                emit_field(&o, sign, p, len, (prec > len) ? prec - len : 0, width, flags);
+                break;
+            }
+            case 'u':
+            case 'x':
+            case 'X': {
+                u32   v   = is_long ? (u32)va_arg(args, unsigned long) : va_arg(args, unsigned);
+                char* p   = utoa_back(end, v, *fmt != 'u', *fmt == 'X');
+                int   len = (int)(end - p);
+                if (prec == 0 && v == 0) len = 0;
+                if (prec >= 0) flags &= ~F_ZERO;
+                emit_field(&o, 0, p, len, (prec > len) ? prec - len : 0, width, flags);
+                break;
+            }
+            case 'f': {
+                // fixed (Q24.8): 정수부 + 소수부(0 ~ 255)를 10^prec 단위로 반올림
+                s32 v = va_arg(args, int);
+                u32 a = (v < 0) ? (u32)0 - (u32)v : (u32)v;
+                if (prec < 0)          prec = 2;
+                if (prec > F_PREC_MAX) prec = F_PREC_MAX;
+
+                u32 ip = a >> FIX_SHIFT;
+                u32 fp = ((a & FIX_MASK) * dec_scale[prec] + 0x80) >> FIX_SHIFT;
+                if (fp >= dec_scale[prec]) {
+                    ++ip;
+                    fp -= dec_scale[prec];
+                }
+                if (v < 0 && (ip | fp)) sign = '-';
+                else if (flags & F_PLUS) sign = '+';
+
+                char* p = end;
+                if (prec > 0) {
+                    for (int d = 0; d < prec; ++d) {
+                        u32 q = div10(fp);
+                        *--p = (char)('0' + (fp - q * 10));
+                        fp   = q;
+                    }
+                    *--p = '.';
+                }
+                p = utoa_back(p, ip, 0, false);
+                emit_field(&o, sign, p, (int)(end - p), 0, width, flags);
+                break;
+            }
+            case 'c':
+                tmp[0] = (char)va_arg(args, int);
+                emit_field(&o, 0, tmp, 1, 0, width, flags & ~F_ZERO);
+                break;
+            case 's': {
+                const char* s = va_arg(args, const char*);
+                if (!s) s = "(null)";
+                int len = 0;
+                while (s[len] && (prec < 0 || len < prec)) ++len;
+                emit_field(&o, 0, s, len, 0, width, flags & ~F_ZERO);
+                break;
+            }
+            default: // %% 또는 모르는 변환은 그대로
+                emit(&o, *fmt);
+                break;
+        }
+    }
+
+    if (size > 0) *o.p = '\0';
+    return o.n;
+}
+
+int txt_format(char* buf, int size, const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    int n = txt_vformat(buf, size, fmt, args);
+    va_end(args);
+    return n;
+}
+
+// ---------------------------------------------------------
+// 6. 측정 / 통계
+// ---------------------------------------------------------
+int txt_width(const char* s) {
+    int w = 0;
+    while (*s) w += advance(*s++);
+    return w;
+}
+
+const TextStats* txt_stats(void) {
+    return &stats;
+}
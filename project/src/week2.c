@@ -0,0 +1,163 @@
+// =========================================================================
+// GBA Engine Core: Week 2 Implementation (Final)
+// =========================================================================
+
+#include "../include/fixed.h"  // fixed_zero, fixed_screen_w 등이 여기에 정의됨
+#include "../include/gba.h"    // 하드웨어 레지스터 및 타입
+#include "../include/draw.h"   // draw_rect 등 스팬 래스터라이저
+#include "../include/fb.h"     // 화면 모드 설정
+#include "../include/dirty.h"  // 지나간 자리 복구 (더티 렉탱글)
+#include "../include/irq.h"    // VBlank 인터럽트 대기
+#include "../include/prof.h"   // 구간 프로파일러 (make PROFILE=1 에서만 동작)
+#include "../include/input.h"  // 프레임 단위 키 스냅샷 (눌린 순간 감지)
+#include "../include/entity.h" // 위치/속도 SoA 배열 + 일괄 이동/경계 처리
+#include "../include/sfx.h"    // 페이드/반투명/모자이크 (레지스터만 바꿈)
+#include "../include/state.h"  // 게임 상태 스택 (장면 전환, 아레나 메모리)
+#include "../include/sched.h"  // 프레임 순서 + 예산 안에서 돌리는 태스크
+
+// 매크로 상수는 대문자가 관례이지만, 편의상 소문자로 쓰신 부분 존중합니다.
+#define PLAYER_W 16
+#define PLAYER_H 16
+
+// -------------------------------------------------------------------------
+// 렌더링 함수
+// -------------------------------------------------------------------------
+// 화면 전체(19,200워드) 채우기는 mem 모듈이 DMA3로 처리
+// 화면을 통째로 새로 칠했으므로 밀려있던 더티 영역도 무의미해짐
+void clear_screen(u16 color) {
+    fb_clear(color);
+    dirty_set_background_color(color);
+    dirty_reset();
+}
+
+// -------------------------------------------------------------------------
+// 게임 상태: 플레이 (state.h / sched.h)
+// -------------------------------------------------------------------------
+// 상태 메모리는 push할 때 아레나에서 받음 (update와 render 사이에 넘길 값도 여기에)
+typedef struct {
+    int   p;                // 플레이어 = 엔티티 하나 (위치는 ent.x[p], ent.y[p])
+    u16   player_color;
+    u16   background_color;
+    fixed speed;
+    fixed old_x, old_y;     // update 전 위치 -> render에서 지나간 자리 복구
+} Play;
+
+static void play_enter(void* mem) {
+    Play* g = mem;
+
+    // [2. Data Initialization]
+    entity_init();
+    EntityId player = entity_create(INT_TO_FIX(SCREEN_W / 2 - PLAYER_W / 2),
+                                    INT_TO_FIX(SCREEN_H / 2 - PLAYER_H / 2),
+                                    PLAYER_W, PLAYER_H, ENT_SOLID);
+    g->p            = entity_slot(player);
+    g->player_color = COLOR_BLUE;
+    g->speed        = INT_TO_FIX(2);
+
+    // 초기 렌더링
+    g->background_color = COLOR_BLACK;
+    clear_screen(g->background_color);
+    draw_rect(FIX_TO_INT(ent.x[g->p]), FIX_TO_INT(ent.y[g->p]), PLAYER_W, PLAYER_H, g->player_color);
+
+    // 시작 화면은 검은색에서 서서히 나타남 (VRAM은 그대로, 프레임마다 BLDY 하나만 바뀜)
+    sfx_init();
+    sfx_fade_in(BLD_BLACK, 32);
+}
+
+// [Step 1] Input & Update (VBlank 전, sched_frame이 부름)
+static void play_update(void* mem) {
+    Play* g = mem;
+    int   p = g->p;
+
+    PROF_BEGIN("update");
+    g->old_x = ent.x[p];
+    g->old_y = ent.y[p];
+
+    key_poll();
+    u16 new_bg_color = g->background_color;
+
+    // 배경색 변경
+    if      ( key_held(KEY_A) )      new_bg_color = COLOR_RED;
+    else if ( key_held(KEY_B) )      new_bg_color = COLOR_GOLD;
+    else if ( key_held(KEY_L) )      new_bg_color = COLOR_GREEN;
+    else if ( key_held(KEY_R) )      new_bg_color = COLOR_WHITE;
+    else if ( key_held(KEY_SELECT) ) new_bg_color = COLOR_BLACK;
+
+    if (new_bg_color != g->background_color) {
+        g->background_color = new_bg_color;
+        clear_screen(g->background_color);
+        draw_rect(FIX_TO_INT(ent.x[p]), FIX_TO_INT(ent.y[p]), PLAYER_W, PLAYER_H, g->player_color);
+    }
+
+    // 이동 로직: 키로 속도를 정하고 이동은 엔티티 일괄 처리에 맡김
+    ent.vx[p] = fixed_zero;
+    ent.vy[p] = fixed_zero;
+    if (key_held(KEY_UP))    ent.vy[p] -= g->speed;
+    if (key_held(KEY_DOWN))  ent.vy[p] += g->speed;
+    if (key_held(KEY_LEFT))  ent.vx[p] -= g->speed;
+    if (key_held(KEY_RIGHT)) ent.vx[p] += g->speed;
+    entity_integrate();
+
+    // -------------------------------------------------
+    // [Clamping] 화면 밖으로 나가지 않도록 좌표 고정
+    // -------------------------------------------------
+    // 오른쪽/아래쪽은 엔티티 크기(PLAYER_W/H)만큼 안쪽에서 멈춤
+    entity_clamp(fixed_zero, fixed_zero, fixed_screen_w, fixed_screen_h);
+    sfx_update();
+    PROF_END("update");
+}
+
+// [Step 3] Render (VBlank 직후, sched_frame이 부름)
+static void play_render(void* mem) {
+    Play* g = mem;
+    int   p = g->p;
+
+    sfx_vblank();
+
+    PROF_BEGIN("render");
+    if (g->old_x != ent.x[p] || g->old_y != ent.y[p]) {
+        // 이전 자리를 무효화 -> 배경으로 복구 -> 새 위치에 그리기
+        dirty_add(FIX_TO_INT(g->old_x), FIX_TO_INT(g->old_y), PLAYER_W, PLAYER_H, DIRTY_HIGH);
+        dirty_flush(DIRTY_VBLANK_BUDGET);
+        draw_rect(FIX_TO_INT(ent.x[p]), FIX_TO_INT(ent.y[p]), PLAYER_W, PLAYER_H, g->player_color);
+    }
+    PROF_END("render");
+
+    // [Profile] 맨 아래 줄에 지난 프레임 막대, START를 누른 순간 로그로 CSV 출력
+    PROF_OVERLAY(SCREEN_H - PROF_BAR_H);
+    PROF_FRAME();
+    if (key_hit(KEY_START)) PROF_DUMP();
+}
+
+static const GameState play_state = {
+    "play", sizeof(Play), play_enter, NULL, play_update, play_render, 0,
+};
+
+// -------------------------------------------------------------------------
+// 메인 게임 루프
+// -------------------------------------------------------------------------
+int main() {
+
+    // [Debug Trap]
+    // 호스트 빌드는 gdb로 바로 실행하므로 대기하지 않음
+    #if defined(DEBUG_MODE) && !defined(GBA_HOST)
+        volatile int debug_wait = 1;
+        while (debug_wait) { }
+    #endif
+
+    // [1. Window Initialization]
+    fb_init(FB_MODE3, 0);
+    irq_init();
+    sched_init();  // 사이클 카운터를 다시 시작하므로 프로파일러보다 먼저
+    PROF_INIT();
+
+    // 프레임 순서(update -> 대기 -> render)는 sched_frame이 맡고, 장면은 상태 스택으로
+    state_init();
+    state_push(&play_state);
+
+    while (1) {
+        sched_frame();
+    }
+
+    return 0;
+}
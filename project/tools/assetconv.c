@@ -0,0 +1,887 @@
+// assetconv.c
+// PNG -> GBA 데이터(C 배열) 변환기 (빌드 시 PC에서 실행)
+// ---------------------------------------------------------
+// makefile이 호스트 gcc로 빌드해서 assets/*.png마다 실행합니다. (make assets)
+//
+//   assetconv [옵션] assets/hero.png build/gen/assets/hero
+//     -> build/gen/assets/hero.c, hero.h  (심볼 이름 = 마지막 경로 이름: hero_pal, hero_tiles ...)
+//
+// [모드] --mode
+//   tiles4  (기본) 16색 타일셋 + 맵. 같은 타일(뒤집은 것 포함)은 한 번만 저장
+//   tiles8  256색 타일셋 + 맵
+//   bitmap3 Mode 3 비트맵 (BGR555, 팔레트 없음)
+//   bitmap4 Mode 4 비트맵 (8비트 인덱스 + 256색 팔레트)
+//
+// [옵션]
+//   --no-dedup    중복 타일 제거 안 함 (스프라이트 시트: 타일 순서 = 그림 순서)
+//   --no-flip     뒤집은 타일은 같은 것으로 보지 않음 (OBJ 타일은 칸마다 뒤집기가 없음)
+//   --meta WxH    W x H 타일 단위로 묶어서 순서대로 저장 (OBJ 1D 매핑용, 맵은 안 만듦)
+//                 블록 안의 타일이 연속이어야 하므로 중복 제거는 자동으로 꺼짐
+//   --palbank N   맵 칸에 SE_PALBANK(N)을 붙임 (tiles4)
+//   --lz77        타일/비트맵/맵을 BIOS LZ77 형식으로 압축 (bios_lz77_uncomp_vram로 바로 풀림)
+//
+// [팔레트]
+//   인덱스 PNG: 그림의 팔레트 순서를 그대로 씀 (아티스트가 정한 번호 유지)
+//   트루컬러 PNG: 0번 = 투명(알파 < 128), 나머지는 처음 나온 순서대로 BGR555 색 등록
+//
+// [출력] 모든 배열은 4바이트 정렬 (타일/비트맵 = u32, 팔레트/맵 = u16 + aligned(4))
+//        -> mem_copy32, DMA, CpuFastSet에 그대로 넘길 수 있음
+//
+// [증분 빌드] 입력 PNG 내용 + 옵션 + 변환기 버전 / 빌드 번호의 해시를 출력 파일 첫 줄에 적어 두고,
+//            다시 실행했을 때 같으면 파일을 건드리지 않습니다. (타임스탬프가 바뀌어도
+//            내용이 같으면 이 에셋을 쓰는 오브젝트가 다시 컴파일되지 않음)
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TOOL_VERSION "assetconv 1"
+
+// 변환기 빌드 번호 (makefile이 이 소스의 체크섬을 넘겨 줌). 해시에 들어가므로
+// 변환기를 고쳐 다시 빌드하면 TOOL_VERSION을 올리지 않아도 모든 에셋이 다시 변환됨
+#ifndef TOOL_BUILD
+#define TOOL_BUILD __DATE__ " " __TIME__
+#endif
+
+typedef uint8_t  u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+
+static const char* input_path = "";
+static char        tmp_c[1040], tmp_h[1040]; // 쓰는 중인 임시 출력 (실패하면 지움)
+
+static void die(const char* fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    fprintf(stderr, "assetconv: %s: ", input_path);
+    vfprintf(stderr, fmt, ap);
+    fprintf(stderr, "\n");
+    va_end(ap);
+
+    if (tmp_c[0]) remove(tmp_c);
+    if (tmp_h[0]) remove(tmp_h);
+    exit(1);
+}
+
+static void* xmalloc(size_t n) {
+    void* p = calloc(1, n ? n : 1);
+    if (!p) die("out of memory");
+    return p;
+}
+
+static u8* read_file(const char* path, size_t* len) {
+    FILE* f = fopen(path, "rb");
+    if (!f) die("cannot open");
+
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    u8* data = xmalloc((size_t)size);
+    if (fread(data, 1, (size_t)size, f) != (size_t)size) die("read error");
+    fclose(f);
+
+    *len = (size_t)size;
+    return data;
+}
+
+// 늘어나는 바이트 버퍼
+typedef struct {
+    u8*    data;
+    size_t len, cap;
+} Buf;
+
+static void buf_push(Buf* b, u8 v) {
+    if (b->len == b->cap) {
+        b->cap  = b->cap ? b->cap * 2 : 4096;
+        b->data = realloc(b->data, b->cap);
+        if (!b->data) die("out of memory");
+    }
+    b->data[b->len++] = v;
+}
+
+// =========================================================================
+// 1. Inflate (zlib, RFC 1951) - PNG의 IDAT 압축 해제
+// =========================================================================
+typedef struct {
+    const u8* src;
+    size_t    len, pos;
+    u32       bits;
+    int       count;
+    Buf       out;
+} Inflate;
+
+typedef struct {
+    short count[16];   // 길이별 부호 개수
+    short symbol[288]; // 길이 -> 부호 순으로 정렬된 심볼
+} Huffman;
+
+static int get_bits(Inflate* s, int n) {
+    while (s->count < n) {
+        if (s->pos >= s->len) die("truncated deflate stream");
+        s->bits  |= (u32)s->src[s->pos++] << s->count;
+        s->count += 8;
+    }
+    int v = (int)(s->bits & ((1u << n) - 1));
+    s->bits  >>= n;
+    s->count  -= n;
+    return v;
+}
+
+static void huff_build(Huffman* h, const u8* lengths, int n) {
+    short offs[16];
+
+    memset(h->count, 0, sizeof(h->count));
+    for (int i = 0; i < n; ++i) h->count[lengths[i]]++;
+    h->count[0] = 0;
+
+    offs[1] = 0;
+    for (int len = 1; len < 15; ++len) offs[len + 1] = (short)(offs[len] + h->count[len]);
+    for (int i = 0; i < n; ++i) {
+        if (lengths[i]) h->symbol[offs[lengths[i]]++] = (short)i;
+    }
+}
+
+// 정규(canonical) 허프만: 길이 1부터 한 비트씩 늘려가며 범위 안에 들어오는지 확인
+static int huff_decode(Inflate* s, const Huffman* h) {
+    int code = 0, first = 0, index = 0;
+
+    for (int len = 1; len <= 15; ++len) {
+        code |= get_bits(s, 1);
+        int count = h->count[len];
+        if (code - count < first) return h->symbol[index + (code - first)];
+        index += count;
+        first  = (first + count) << 1;
+        code <<= 1;
+    }
+    die("bad huffman code");
+    return -1;
+}
+
+static const short len_base[29]  = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                     35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static const short len_extra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                     3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static const short dist_base[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+                                     257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+                                     8193, 12289, 16385, 24577 };
+static const short dist_extra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+                                      7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+static void inflate_codes(Inflate* s, const Huffman* lit, const Huffman* dist) {
+    for (;;) {
+        int sym = huff_decode(s, lit);
+        if (sym < 256) {
+            buf_push(&s->out, (u8)sym);
+        } else if (sym == 256) {
+            return;
+        } else {
+            sym -= 257;
+            if (sym >= 29) die("bad length symbol");
+            int len = len_base[sym] + get_bits(s, len_extra[sym]);
+
+            int dsym = huff_decode(s, dist);
+            if (dsym >= 30) die("bad distance symbol");
+            size_t d = (size_t)(dist_base[dsym] + get_bits(s, dist_extra[dsym]));
+            if (d > s->out.len) die("distance too far");
+
+            while (len--) buf_push(&s->out, s->out.data[s->out.len - d]);
+        }
+    }
+}
+
+static void inflate_fixed(Inflate* s) {
+    static Huffman lit, dist;
+    static int     ready = 0;
+
+    if (!ready) {
+        u8 lengths[288];
+        int i = 0;
+        for (; i < 144; ++i) lengths[i] = 8;
+        for (; i < 256; ++i) lengths[i] = 9;
+        for (; i < 280; ++i) lengths[i] = 7;
+        for (; i < 288; ++i) lengths[i] = 8;
+        huff_build(&lit, lengths, 288);
+        for (i = 0; i < 30; ++i) lengths[i] = 5;
+        huff_build(&dist, lengths, 30);
+        ready = 1;
+    }
+    inflate_codes(s, &lit, &dist);
+}
+
+static void inflate_dynamic(Inflate* s) {
+    static const u8 order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+    u8      lengths[320];
+    Huffman lencode, lit, dist;
+
+    int nlen  = get_bits(s, 5) + 257;
+    int ndist = get_bits(s, 5) + 1;
+    int ncode = get_bits(s, 4) + 4;
+
+    memset(lengths, 0, sizeof(lengths));
+    for (int i = 0; i < ncode; ++i) lengths[order[i]] = (u8)get_bits(s, 3);
+    huff_build(&lencode, lengths, 19);
+
+    for (int i = 0; i < nlen + ndist;) {
+        int sym = huff_decode(s, &lencode);
+        if (sym < 16) {
+            lengths[i++] = (u8)sym;
+            continue;
+        }
+
+        int value = 0, repeat;
+        if (sym == 16) {
+            if (i == 0) die("repeat with no previous length");
+            value  = lengths[i - 1];
+            repeat = 3 + get_bits(s, 2);
+        } else if (sym == 17) {
+            repeat = 3 + get_bits(s, 3);
+        } else {
+            repeat = 11 + get_bits(s, 7);
+        }
+        if (i + repeat > nlen + ndist) die("too many code lengths");
+        while (repeat--) lengths[i++] = (u8)value;
+    }
+
+    huff_build(&lit, lengths, nlen);
+    huff_build(&dist, lengths + nlen, ndist);
+    inflate_codes(s, &lit, &dist);
+}
+
+static Buf zlib_inflate(const u8* src, size_t len) {
+    Inflate s;
+    memset(&s, 0, sizeof(s));
+
+    if (len < 2 || (src[0] & 0x0F) != 8) die("not a zlib stream");
+    s.src = src;
+    s.len = len;
+    s.pos = 2; // CMF, FLG
+
+    int last;
+    do {
+        last     = get_bits(&s, 1);
+        int type = get_bits(&s, 2);
+
+        if (type == 0) {
+            // 저장 블록: 바이트 경계로 맞춘 뒤 LEN, NLEN, 원본 그대로
+            s.bits  = 0;
+            s.count = 0;
+            if (s.pos + 4 > s.len) die("truncated stored block");
+            u32 n = s.src[s.pos] | (s.src[s.pos + 1] << 8);
+            s.pos += 4;
+            if (s.pos + n > s.len) die("truncated stored block");
+            for (u32 i = 0; i < n; ++i) buf_push(&s.out, s.src[s.pos++]);
+        } else if (type == 1) {
+            inflate_fixed(&s);
+        } else if (type == 2) {
+            inflate_dynamic(&s);
+        } else {
+            die("bad deflate block type");
+        }
+    } while (!last);
+
+    return s.out;
+}
+
+// =========================================================================
+// 2. PNG 읽기 (인터레이스 없는 모든 색 형식, 16비트는 상위 8비트만)
+// =========================================================================
+typedef struct {
+    int  width, height;
+    u8*  rgba;        // width * height * 4
+    u8*  index;       // 인덱스 PNG일 때만 (아니면 NULL)
+    u8   plte[256][3];
+    int  plte_count;
+} Image;
+
+static u32 be32(const u8* p) {
+    return ((u32)p[0] << 24) | ((u32)p[1] << 16) | ((u32)p[2] << 8) | p[3];
+}
+
+static int paeth(int a, int b, int c) {
+    int p = a + b - c;
+    int pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+    if (pa <= pb && pa <= pc) return a;
+    return (pb <= pc) ? b : c;
+}
+
+static Image load_png(const u8* file, size_t len) {
+    static const u8 magic[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    Image img;
+    Buf   idat;
+    u8    trns[256];
+    int   depth = 0, color = 0, interlace = 0;
+
+    memset(&img, 0, sizeof(img));
+    memset(&idat, 0, sizeof(idat));
+    memset(trns, 0xFF, sizeof(trns));
+
+    if (len < 8 || memcmp(file, magic, 8) != 0) die("not a PNG file");
+
+    for (size_t pos = 8; pos + 12 <= len;) {
+        u32       n    = be32(file + pos);
+        const u8* type = file + pos + 4;
+        const u8* data = file + pos + 8;
+        if (pos + 12 + n > len) die("truncated chunk");
+
+        if (!memcmp(type, "IHDR", 4)) {
+            img.width  = (int)be32(data);
+            img.height = (int)be32(data + 4);
+            depth      = data[8];
+            color      = data[9];
+            interlace  = data[12];
+        } else if (!memcmp(type, "PLTE", 4)) {
+            img.plte_count = (int)(n / 3);
+            memcpy(img.plte, data, (size_t)img.plte_count * 3);
+        } else if (!memcmp(type, "tRNS", 4) && color == 3) {
+            memcpy(trns, data, n < 256 ? n : 256);
+        } else if (!memcmp(type, "IDAT", 4)) {
+            for (u32 i = 0; i < n; ++i) buf_push(&idat, data[i]);
+        } else if (!memcmp(type, "IEND", 4)) {
+            break;
+        }
+        pos += 12 + n;
+    }
+
+    if (img.width <= 0 || img.height <= 0) die("missing IHDR");
+    if (interlace) die("interlaced PNG is not supported (re-save without interlace)");
+
+    int channels = (color == 0 || color == 3) ? 1 : (color == 2) ? 3 : (color == 4) ? 2 : 4;
+    int bpp      = (channels * depth + 7) / 8;              // 필터 계산용 픽셀 바이트 수
+    int stride   = (img.width * channels * depth + 7) / 8;
+
+    Buf raw = zlib_inflate(idat.data, idat.len);
+    if (raw.len < (size_t)(stride + 1) * img.height) die("image data too short");
+
+    // [필터 복원] 줄마다 첫 바이트가 필터 종류 (0 없음, 1 왼쪽, 2 위, 3 평균, 4 Paeth)
+    u8* pixels = xmalloc((size_t)stride * img.height);
+    for (int y = 0; y < img.height; ++y) {
+        const u8* in   = raw.data + (size_t)y * (stride + 1);
+        u8*       out  = pixels + (size_t)y * stride;
+        const u8* prev = y ? out - stride : NULL;
+
+        for (int x = 0; x < stride; ++x) {
+            int a = (x >= bpp) ? out[x - bpp] : 0;
+            int b = prev ? prev[x] : 0;
+            int c = (prev && x >= bpp) ? prev[x - bpp] : 0;
+            int v = in[1 + x];
+
+            switch (in[0]) {
+                case 0: break;
+                case 1: v += a; break;
+                case 2: v += b; break;
+                case 3: v += (a + b) >> 1; break;
+                case 4: v += paeth(a, b, c); break;
+                default: die("bad filter type %d", in[0]);
+            }
+            out[x] = (u8)v;
+        }
+    }
+
+    // [RGBA로 펼치기]
+    img.rgba = xmalloc((size_t)img.width * img.height * 4);
+    if (color == 3) img.index = xmalloc((size_t)img.width * img.height);
+
+    for (int y = 0; y < img.height; ++y) {
+        const u8* row = pixels + (size_t)y * stride;
+        for (int x = 0; x < img.width; ++x) {
+            u8* o = img.rgba + ((size_t)y * img.width + x) * 4;
+            int sample[4];
+
+            for (int c = 0; c < channels; ++c) {
+                if (depth == 8) {
+                    sample[c] = row[x * channels + c];
+                } else if (depth == 16) {
+                    sample[c] = row[(x * channels + c) * 2]; // 상위 바이트
+                } else {
+                    // 1/2/4비트: 한 바이트에 여러 픽셀, 왼쪽 픽셀이 상위 비트
+                    int bit   = x * depth;
+                    sample[c] = (row[bit >> 3] >> (8 - depth - (bit & 7))) & ((1 << depth) - 1);
+                }
+            }
+
+            switch (color) {
+                case 0: {
+                    int g = (depth < 8) ? sample[0] * 255 / ((1 << depth) - 1) : sample[0];
+                    o[0] = o[1] = o[2] = (u8)g; o[3] = 255;
+                    break;
+                }
+                case 2: o[0] = (u8)sample[0]; o[1] = (u8)sample[1]; o[2] = (u8)sample[2]; o[3] = 255; break;
+                case 4: o[0] = o[1] = o[2] = (u8)sample[0]; o[3] = (u8)sample[1]; break;
+                case 6: o[0] = (u8)sample[0]; o[1] = (u8)sample[1]; o[2] = (u8)sample[2]; o[3] = (u8)sample[3]; break;
+                case 3: {
+                    int i = sample[0];
+                    if (i >= img.plte_count) die("palette index %d out of range", i);
+                    img.index[(size_t)y * img.width + x] = (u8)i;
+                    o[0] = img.plte[i][0]; o[1] = img.plte[i][1]; o[2] = img.plte[i][2]; o[3] = trns[i];
+                    break;
+                }
+                default: die("unsupported color type %d", color);
+            }
+        }
+    }
+
+    free(pixels);
+    free(raw.data);
+    free(idat.data);
+    return img;
+}
+
+// =========================================================================
+// 3. 팔레트 + 인덱스 그림
+// =========================================================================
+static u16 to_bgr555(const u8* rgb) {
+    return (u16)((rgb[0] >> 3) | ((rgb[1] >> 3) << 5) | ((rgb[2] >> 3) << 10));
+}
+
+typedef struct {
+    u16 colors[256];
+    int count;
+    u8* pixels; // width * height 인덱스
+} Indexed;
+
+static Indexed make_indexed(const Image* img, int max_colors) {
+    Indexed out;
+    size_t  n = (size_t)img->width * img->height;
+
+    memset(&out, 0, sizeof(out));
+    out.pixels = xmalloc(n);
+
+    if (img->index) {
+        // 인덱스 PNG: 번호 그대로
+        out.count = img->plte_count;
+        for (int i = 0; i < out.count; ++i) out.colors[i] = to_bgr555(img->plte[i]);
+        memcpy(out.pixels, img->index, n);
+    } else {
+        // 트루컬러: 0 = 투명, 나머지는 처음 나온 순서
+        out.count = 1;
+        for (size_t i = 0; i < n; ++i) {
+            const u8* p = img->rgba + i * 4;
+            if (p[3] < 128) {
+                out.pixels[i] = 0;
+                continue;
+            }
+
+            u16 c = to_bgr555(p);
+            int k = 1;
+            while (k < out.count && out.colors[k] != c) ++k;
+            if (k == out.count) {
+                if (out.count == 256) die("more than 255 colors");
+                out.colors[out.count++] = c;
+            }
+            out.pixels[i] = (u8)k;
+        }
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        if (out.pixels[i] >= max_colors) {
+            die("uses color index %d but this mode allows %d colors (try --mode tiles8)", out.pixels[i], max_colors);
+        }
+    }
+    if (out.count > max_colors) out.count = max_colors; // 인덱스 PNG의 안 쓰는 뒤쪽 색
+    return out;
+}
+
+// =========================================================================
+// 4. 타일셋 (중복 제거 + 뒤집기 매칭)
+// =========================================================================
+#define SE_HFLIP 0x0400
+#define SE_VFLIP 0x0800
+
+typedef struct {
+    u8 (*tiles)[64]; // 고유 타일 (8x8 인덱스)
+    int count;
+    u16* map;        // 그림 칸마다 맵 칸 값 (타일 번호 | 뒤집기)
+    int  map_w, map_h;
+} Tileset;
+
+static u32 tile_hash(const u8* t) {
+    u32 h = 2166136261u;
+    for (int i = 0; i < 64; ++i) h = (h ^ t[i]) * 16777619u;
+    return h;
+}
+
+static void flip_tile(u8* dst, const u8* src, int h, int v) {
+    for (int y = 0; y < 8; ++y) {
+        for (int x = 0; x < 8; ++x) dst[y * 8 + x] = src[(v ? 7 - y : y) * 8 + (h ? 7 - x : x)];
+    }
+}
+
+static Tileset make_tileset(const Indexed* ix, int width, int height, int dedup, int flips, int meta_w, int meta_h) {
+    Tileset ts;
+    int     cols  = width / 8, rows = height / 8;
+    int     cells = cols * rows;
+
+    if (width % 8 || height % 8) die("size %dx%d is not a multiple of 8", width, height);
+    if (cols % meta_w || rows % meta_h) die("size is not a multiple of --meta %dx%d tiles", meta_w, meta_h);
+
+    memset(&ts, 0, sizeof(ts));
+    ts.tiles = xmalloc((size_t)cells * 64);
+    ts.map   = xmalloc((size_t)cells * sizeof(u16));
+    ts.map_w = cols;
+    ts.map_h = rows;
+
+    // 해시 테이블 (열린 주소법, 고유 타일 번호 + 1을 저장)
+    int  slots = 1;
+    while (slots < cells * 2) slots <<= 1;
+    int* table = xmalloc((size_t)slots * sizeof(int));
+
+    // 메타 타일 순서: 메타 블록(행 우선) -> 블록 안의 타일(행 우선)
+    for (int n = 0; n < cells; ++n) {
+        int block = n / (meta_w * meta_h), inner = n % (meta_w * meta_h);
+        int bx    = block % (cols / meta_w), by = block / (cols / meta_w);
+        int tx    = bx * meta_w + inner % meta_w;
+        int ty    = by * meta_h + inner / meta_w;
+
+        u8 tile[64];
+        for (int y = 0; y < 8; ++y) memcpy(tile + y * 8, ix->pixels + (size_t)(ty * 8 + y) * width + tx * 8, 8);
+
+        int found = -1, flip = 0;
+        if (dedup) {
+            // 새 타일을 뒤집어 본 모양이 이미 있는 타일 T와 같다면 새 타일 = T를 같은 방향으로 뒤집은 것
+            for (int f = 0; f < (flips ? 4 : 1) && found < 0; ++f) {
+                u8 probe[64];
+                flip_tile(probe, tile, f & 1, f & 2);
+
+                for (u32 h = tile_hash(probe) & (slots - 1); table[h]; h = (h + 1) & (slots - 1)) {
+                    if (!memcmp(ts.tiles[table[h] - 1], probe, 64)) {
+                        found = table[h] - 1;
+                        flip  = ((f & 1) ? SE_HFLIP : 0) | ((f & 2) ? SE_VFLIP : 0);
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (found < 0) {
+            found = ts.count++;
+            memcpy(ts.tiles[found], tile, 64);
+            if (dedup) {
+                u32 h = tile_hash(tile) & (slots - 1);
+                while (table[h]) h = (h + 1) & (slots - 1);
+                table[h] = found + 1;
+            }
+        }
+        ts.map[ty * cols + tx] = (u16)(found | flip);
+    }
+
+    free(table);
+    if (ts.count > 1024) die("%d unique tiles (a map entry can address 1024)", ts.count);
+    return ts;
+}
+
+// =========================================================================
+// 5. LZ77 압축 (GBA BIOS 형식, VRAM 안전)
+// =========================================================================
+// 헤더 u32 = 풀린 크기 << 8 | 0x10
+// 이후 블록 8개마다 플래그 1바이트 (상위 비트부터, 1 = 참조)
+//   리터럴: 1바이트,  참조: 2바이트 = (길이 - 3) << 12 | (거리 - 1)   (길이 3~18, 거리 1~4096)
+// LZ77UnCompVram은 16비트 단위로 쓰므로, 거리 1(직전 바이트 참조)은 아직 안 쓰인 바이트를
+// 읽게 됨 -> 거리 2 이상만 사용. 이렇게 만든 데이터는 WRAM/VRAM 버전 모두로 풀 수 있음.
+#define LZ_MIN      3
+#define LZ_MAX      18
+#define LZ_WINDOW   4096
+#define LZ_HASH     4096
+#define LZ_CHAIN    256 // 후보 탐색 한도 (속도/압축률 절충)
+
+static Buf lz77_compress(const u8* src, size_t len) {
+    Buf  out;
+    int* head = xmalloc(LZ_HASH * sizeof(int));
+    int* prev = xmalloc((len ? len : 1) * sizeof(int));
+
+    memset(&out, 0, sizeof(out));
+    for (int i = 0; i < LZ_HASH; ++i) head[i] = -1;
+
+    buf_push(&out, 0x10);
+    buf_push(&out, (u8)len);
+    buf_push(&out, (u8)(len >> 8));
+    buf_push(&out, (u8)(len >> 16));
+
+    #define HASH3(p) ((((p)[0] << 8) ^ ((p)[1] << 4) ^ (p)[2]) & (LZ_HASH - 1))
+
+    size_t pos = 0, flag_at = 0;
+    int    block = 8;
+
+    // 해시 체인에 i 위치 등록
+    #define INSERT(i) do { if ((i) + 2 < len) { int h_ = HASH3(src + (i)); prev[i] = head[h_]; head[h_] = (int)(i); } } while (0)
+
+    while (pos < len) {
+        if (block == 8) {
+            flag_at = out.len;
+            buf_push(&out, 0);
+            block = 0;
+        }
+
+        int best_len = 0, best_dist = 0;
+        if (pos + LZ_MIN <= len) {
+            int chain = LZ_CHAIN;
+            for (int cand = head[HASH3(src + pos)]; cand >= 0 && chain--; cand = prev[cand]) {
+                size_t dist = pos - (size_t)cand;
+                if (dist > LZ_WINDOW) break;
+                if (dist < 2) continue;
+
+                int n = 0;
+                while (n < LZ_MAX && pos + n < len && src[cand + n] == src[pos + n]) ++n;
+                if (n > best_len) {
+                    best_len  = n;
+                    best_dist = (int)dist;
+                    if (n == LZ_MAX) break;
+                }
+            }
+        }
+
+        if (best_len >= LZ_MIN) {
+            out.data[flag_at] |= (u8)(0x80 >> block);
+            buf_push(&out, (u8)(((best_len - 3) << 4) | ((best_dist - 1) >> 8)));
+            buf_push(&out, (u8)((best_dist - 1) & 0xFF));
+            for (int i = 0; i < best_len; ++i, ++pos) INSERT(pos);
+        } else {
+            buf_push(&out, src[pos]);
+            INSERT(pos);
+            ++pos;
+        }
+        ++block;
+    }
+
+    #undef INSERT
+    #undef HASH3
+
+    while (out.len & 3) buf_push(&out, 0); // u32 배열로 내보내기 위해 4바이트 단위로
+    free(head);
+    free(prev);
+    return out;
+}
+
+// =========================================================================
+// 6. 출력
+// =========================================================================
+typedef struct {
+    const char* mode;
+    int         dedup, flips, lz77, palbank;
+    int         meta_w, meta_h;
+} Options;
+
+static char symbol[64], upper[64];
+static FILE *out_c, *out_h;
+
+static void emit_u16(const char* suffix, const char* macro, const u16* data, int count) {
+    fprintf(out_h, "#define %s_%s %d\n", upper, macro, count);
+    fprintf(out_h, "extern const u16 %s_%s[%d];\n\n", symbol, suffix, count);
+
+    fprintf(out_c, "const u16 %s_%s[%d] __attribute__((aligned(4))) = {", symbol, suffix, count);
+    for (int i = 0; i < count; ++i) fprintf(out_c, "%s0x%04X,", (i % 8 == 0) ? "\n    " : " ", data[i]);
+    fprintf(out_c, "\n};\n\n");
+}
+
+// 바이트 데이터 -> u32 배열 (압축 옵션이면 LZ77 스트림)
+static void emit_words(const char* suffix, const char* macro, const u8* data, size_t bytes, const Options* opt) {
+    Buf packed = { 0 };
+
+    fprintf(out_h, "#define %s_%s_BYTES %zu // 풀린 크기\n", upper, macro, bytes);
+    if (opt->lz77) {
+        packed = lz77_compress(data, bytes);
+        data   = packed.data;
+        bytes  = packed.len;
+        fprintf(out_h, "#define %s_%s_LZ77 1 // LZ77 스트림 (%zu바이트) -> bios_lz77_uncomp_vram / _wram\n",
+                upper, macro, bytes);
+    }
+
+    size_t words = (bytes + 3) / 4;
+    fprintf(out_h, "extern const u32 %s_%s[%zu];\n\n", symbol, suffix, words);
+
+    fprintf(out_c, "const u32 %s_%s[%zu] = {", symbol, suffix, words);
+    for (size_t i = 0; i < words; ++i) {
+        u32 w = 0;
+        for (int b = 0; b < 4; ++b) {
+            if (i * 4 + b < bytes) w |= (u32)data[i * 4 + b] << (8 * b);
+        }
+        fprintf(out_c, "%s0x%08X,", (i % 6 == 0) ? "\n    " : " ", w);
+    }
+    fprintf(out_c, "\n};\n\n");
+
+    free(packed.data);
+}
+
+static void convert(const Image* img, const Options* opt) {
+    int tiles4 = !strcmp(opt->mode, "tiles4"), tiles8 = !strcmp(opt->mode, "tiles8");
+
+    if (!strcmp(opt->mode, "bitmap3")) {
+        // 픽셀당 BGR555 2바이트 (알파는 무시)
+        size_t n     = (size_t)img->width * img->height;
+        u8*    bytes = xmalloc(n * 2);
+        for (size_t i = 0; i < n; ++i) {
+            u16 c = to_bgr555(img->rgba + i * 4);
+            bytes[i * 2]     = (u8)c;
+            bytes[i * 2 + 1] = (u8)(c >> 8);
+        }
+        fprintf(out_h, "#define %s_W %d\n#define %s_H %d\n\n", upper, img->width, upper, img->height);
+        emit_words("bitmap", "BITMAP", bytes, n * 2, opt);
+        free(bytes);
+    } else if (!strcmp(opt->mode, "bitmap4")) {
+        if (img->width & 1) die("Mode 4 bitmap width must be even (VRAM has no 8-bit writes)");
+        Indexed ix = make_indexed(img, 256);
+        fprintf(out_h, "#define %s_W %d\n#define %s_H %d\n\n", upper, img->width, upper, img->height);
+        emit_u16("pal", "PAL_COUNT", ix.colors, ix.count);
+        emit_words("bitmap", "BITMAP", ix.pixels, (size_t)img->width * img->height, opt);
+        free(ix.pixels);
+    } else if (tiles4 || tiles8) {
+        Indexed ix = make_indexed(img, tiles4 ? 16 : 256);
+        Tileset ts = make_tileset(&ix, img->width, img->height, opt->dedup, opt->flips, opt->meta_w, opt->meta_h);
+
+        // 4bpp: 한 줄 = 4바이트 (왼쪽 픽셀이 하위 니블), 8bpp: 한 줄 = 8바이트
+        size_t tile_bytes = tiles4 ? 32 : 64;
+        u8*    bytes      = xmalloc((size_t)ts.count * tile_bytes);
+        for (int t = 0; t < ts.count; ++t) {
+            u8* o = bytes + t * tile_bytes;
+            for (int p = 0; p < 64; ++p) {
+                if (tiles4) o[p >> 1] |= (u8)(ts.tiles[t][p] << ((p & 1) * 4));
+                else        o[p] = ts.tiles[t][p];
+            }
+        }
+
+        emit_u16("pal", "PAL_COUNT", ix.colors, ix.count);
+        fprintf(out_h, "#define %s_TILE_COUNT %d\n", upper, ts.count);
+        emit_words("tiles", "TILES", bytes, (size_t)ts.count * tile_bytes, opt);
+
+        if (opt->meta_w == 1 && opt->meta_h == 1) {
+            int cells = ts.map_w * ts.map_h;
+            for (int i = 0; i < cells; ++i) ts.map[i] |= (u16)(opt->palbank << 12);
+
+            fprintf(out_h, "#define %s_MAP_W %d\n#define %s_MAP_H %d\n", upper, ts.map_w, upper, ts.map_h);
+            if (opt->lz77) {
+                emit_words("map", "MAP", (const u8*)ts.map, (size_t)cells * 2, opt); // 리틀 엔디언 호스트 가정
+            } else {
+                emit_u16("map", "MAP_COUNT", ts.map, cells);
+            }
+        }
+
+        fprintf(stderr, "assetconv: %s: %d cells -> %d unique tiles\n", input_path, ts.map_w * ts.map_h, ts.count);
+        free(bytes);
+        free(ts.tiles);
+        free(ts.map);
+        free(ix.pixels);
+    } else {
+        die("unknown mode '%s'", opt->mode);
+    }
+}
+
+// 출력 파일 첫 줄이 같은 해시면 최신 상태
+static int up_to_date(const char* path, const char* stamp) {
+    char  line[128];
+    FILE* f = fopen(path, "r");
+    if (!f) return 0;
+
+    int same = fgets(line, sizeof(line), f) && !strcmp(line, stamp);
+    fclose(f);
+    return same;
+}
+
+static u64 fnv64(u64 h, const void* data, size_t len) {
+    const u8* p = data;
+    for (size_t i = 0; i < len; ++i) h = (h ^ p[i]) * 0x100000001B3ULL;
+    return h;
+}
+
+static void usage(void) {
+    fprintf(stderr,
+            "usage: assetconv [--mode tiles4|tiles8|bitmap3|bitmap4] [--no-dedup] [--no-flip]\n"
+            "                 [--meta WxH] [--palbank N] [--lz77] <in.png> <out base path>\n");
+    exit(1);
+}
+
+int main(int argc, char** argv) {
+    Options     opt      = { "tiles4", 1, 1, 0, 0, 1, 1 };
+    const char* out_base = NULL;
+    u64         hash     = fnv64(0xCBF29CE484222325ULL, TOOL_VERSION, sizeof(TOOL_VERSION));
+
+    hash = fnv64(hash, TOOL_BUILD, sizeof(TOOL_BUILD));
+
+    for (int i = 1; i < argc; ++i) {
+        const char* a = argv[i];
+
+        if (a[0] == '-' && a[1] == '-') hash = fnv64(hash, a, strlen(a) + 1); // 옵션도 해시에 포함
+
+        if (!strcmp(a, "--mode") && i + 1 < argc) {
+            opt.mode = argv[++i];
+            hash     = fnv64(hash, opt.mode, strlen(opt.mode) + 1);
+        } else if (!strcmp(a, "--meta") && i + 1 < argc) {
+            if (sscanf(argv[++i], "%dx%d", &opt.meta_w, &opt.meta_h) != 2 || opt.meta_w < 1 || opt.meta_h < 1) usage();
+            hash = fnv64(hash, argv[i], strlen(argv[i]) + 1);
+        } else if (!strcmp(a, "--palbank") && i + 1 < argc) {
+            opt.palbank = atoi(argv[++i]) & 15;
+            hash        = fnv64(hash, argv[i], strlen(argv[i]) + 1);
+        } else if (!strcmp(a, "--no-dedup")) {
+            opt.dedup = 0;
+        } else if (!strcmp(a, "--no-flip")) {
+            opt.flips = 0;
+        } else if (!strcmp(a, "--lz77")) {
+            opt.lz77 = 1;
+        } else if (a[0] == '-') {
+            usage();
+        } else if (!input_path[0]) {
+            input_path = a;
+        } else if (!out_base) {
+            out_base = a;
+        } else {
+            usage();
+        }
+    }
+    if (!input_path[0] || !out_base) usage();
+    if (opt.meta_w * opt.meta_h > 1) opt.dedup = 0;
+
+    // 심볼 이름 = 출력 경로의 마지막 부분 (C 식별자로 정리)
+    const char* base = strrchr(out_base, '/');
+    base = base ? base + 1 : out_base;
+    size_t n = 0;
+    for (; base[n] && n < sizeof(symbol) - 1; ++n) {
+        char c    = base[n];
+        int  ok   = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+        symbol[n] = ok ? c : '_';
+        upper[n]  = (c >= 'a' && c <= 'z') ? (char)(c - 32) : symbol[n];
+    }
+    symbol[n] = upper[n] = '\0';
+
+    size_t len;
+    u8*    file = read_file(input_path, &len);
+    hash        = fnv64(hash, file, len);
+
+    char stamp[64], path_c[1024], path_h[1024];
+    snprintf(stamp, sizeof(stamp), "// %s %016llx\n", TOOL_VERSION, (unsigned long long)hash);
+    snprintf(path_c, sizeof(path_c), "%s.c", out_base);
+    snprintf(path_h, sizeof(path_h), "%s.h", out_base);
+
+    if (up_to_date(path_c, stamp) && up_to_date(path_h, stamp)) {
+        fprintf(stderr, "assetconv: %s: up to date\n", input_path);
+        return 0;
+    }
+
+    Image img = load_png(file, len);
+
+    // 임시 파일에 쓰고 끝까지 성공했을 때만 이름을 바꿈
+    // (도중에 실패해도 해시 줄이 달린 반쪽짜리 파일이 '최신'으로 남지 않게)
+    snprintf(tmp_c, sizeof(tmp_c), "%s.tmp", path_c);
+    snprintf(tmp_h, sizeof(tmp_h), "%s.tmp", path_h);
+
+    out_c = fopen(tmp_c, "w");
+    out_h = fopen(tmp_h, "w");
+    if (!out_c || !out_h) die("cannot write %s", out_base);
+
+    fprintf(out_h, "%s// 자동 생성 파일 (tools/assetconv.c, 원본: %s) - 직접 수정하지 마세요\n\n", stamp, input_path);
+    fprintf(out_h, "#ifndef ASSET_%s_H\n#define ASSET_%s_H\n\n#include \"gba.h\"\n\n", upper, upper);
+    fprintf(out_c, "%s// 자동 생성 파일 (tools/assetconv.c, 원본: %s) - 직접 수정하지 마세요\n\n", stamp, input_path);
+    fprintf(out_c, "#include \"%s.h\"\n\n", base);
+
+    convert(&img, &opt);
+
+    fprintf(out_h, "#endif // ASSET_%s_H\n", upper);
+    fclose(out_c);
+    fclose(out_h);
+
+    if (rename(tmp_c, path_c) != 0 || rename(tmp_h, path_h) != 0) die("cannot write %s", out_base);
+
+    free(file);
+    return 0;
+}
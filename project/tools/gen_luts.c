@@ -0,0 +1,56 @@
+// gen_luts.c
+// 고정 소수점 수학 테이블 생성기 (빌드 시 PC에서 실행, include/fixmath.h 참고)
+// ---------------------------------------------------------
+// makefile이 호스트 gcc로 컴파일/실행해서 build/gen/fixmath_lut.c를 만듭니다.
+// GBA에는 FPU가 없으므로 sin/atan 같은 실수 계산은 전부 여기서 double로 미리 해 둡니다.
+//
+//   gen_luts > build/gen/fixmath_lut.c
+
+#include <math.h>
+#include <stdio.h>
+
+#define SIN_SIZE    512 // 한 바퀴 = 512
+#define SIN_ONE     4096.0 // Q12
+#define RECIP_SIZE  256
+#define ATAN_SIZE   128 // tan 0 ~ 1 구간 (+ 보간용 끝 칸)
+
+static void print_table(const char* decl, const long* values, int count) {
+    printf("%s = {", decl);
+    for (int i = 0; i < count; ++i) {
+        printf("%s%6ld,", (i % 8 == 0) ? "\n   " : " ", values[i]);
+    }
+    printf("\n};\n\n");
+}
+
+int main(void) {
+    long sin_lut[SIN_SIZE];
+    long recip_lut[RECIP_SIZE];
+    long atan_lut[ATAN_SIZE + 2];
+    double pi = acos(-1.0);
+
+    // [sin] Q12 (1.0 = 4096)
+    for (int i = 0; i < SIN_SIZE; ++i) {
+        sin_lut[i] = lround(sin(2.0 * pi * i / SIN_SIZE) * SIN_ONE);
+    }
+
+    // [역수] x = 0.5 ~ 1 구간을 256칸으로 나눈 각 칸 '가운데'의 1/x, Q15
+    //        (칸 가운데를 쓰면 양 끝 오차가 절반으로 줄어 Newton 시작값으로 좋음)
+    for (int i = 0; i < RECIP_SIZE; ++i) {
+        double x = (RECIP_SIZE + i + 0.5) / (2.0 * RECIP_SIZE);
+        recip_lut[i] = lround(32768.0 / x);
+    }
+
+    // [atan] tan = i / 128 일 때의 각도, 각도 단위(512 = 한 바퀴) x 256
+    for (int i = 0; i <= ATAN_SIZE + 1; ++i) {
+        double t = (i > ATAN_SIZE ? ATAN_SIZE : i) / (double)ATAN_SIZE;
+        atan_lut[i] = lround(atan(t) / (2.0 * pi) * SIN_SIZE * 256.0);
+    }
+
+    printf("// fixmath_lut.c\n");
+    printf("// 자동 생성 파일 (tools/gen_luts.c) - 직접 수정하지 마세요\n\n");
+    printf("#include \"fixmath.h\"\n\n");
+    print_table("const s16 sin_lut[FIX_ANGLE_FULL]", sin_lut, SIN_SIZE);
+    print_table("const u16 recip_lut[256]", recip_lut, RECIP_SIZE);
+    print_table("const u16 atan_lut[130]", atan_lut, ATAN_SIZE + 2);
+    return 0;
+}
@@ -0,0 +1,79 @@
+#!/bin/sh
+# memmap.sh
+# 링크 후 메모리 맵 보고서: 섹션 크기, IWRAM/EWRAM 여유, ROM에 남은 큰 함수 20개
+# ---------------------------------------------------------
+# 사용: sh tools/memmap.sh <binutils 접두사> <elf>
+#       예) sh tools/memmap.sh $DEVKITARM/bin/arm-none-eabi- build/release/week2.elf
+# makefile이 ELF 링크 직후 자동으로 부르고, make memmap으로 다시 볼 수 있습니다.
+#
+# [영역 구분] 섹션의 실행 주소(VMA)로 판단
+#   ROM   0x08000000~  .text, .rodata 등
+#   IWRAM 0x03000000~  .iwram, .data, .bss  (0x03007F00부터 위는 BIOS/IRQ 스택 자리)
+#   EWRAM 0x02000000~  .ewram, .sbss        (남은 공간은 malloc 힙)
+#   .data / .iwram / .ewram은 초기값이 ROM에 실리므로 ROM 크기에도 더함 (bss 계열 제외)
+#
+# [주의] IWRAM 여유 = 사용자 스택이 쓸 수 있는 최대 크기. 재귀나 큰 지역 배열이 있으면
+#        여유가 몇 KB는 남아 있어야 안전합니다.
+# ---------------------------------------------------------
+
+PREFIX="$1"
+ELF="$2"
+
+if [ -z "$ELF" ] || [ ! -f "$ELF" ]; then
+    echo "usage: sh tools/memmap.sh <binutils prefix> <elf>" >&2
+    exit 1
+fi
+
+echo "========================================"
+echo ">> Memory Map: $ELF"
+echo "========================================"
+
+# size -A -d: "섹션 크기 주소" (10진수)
+"${PREFIX}size" -A -d "$ELF" | awk '
+    BEGIN {
+        IWRAM_LIMIT = 32512;   # 0x7F00: 그 위는 IRQ/BIOS 스택
+        EWRAM_LIMIT = 262144;
+        printf "%-16s %8s  %-10s %s\n", "section", "bytes", "address", "region";
+    }
+    NF == 3 && $3 ~ /^[0-9]+$/ && $3 > 0 && $2 > 0 {
+        name = $1; bytes = $2; addr = $3;
+        nobits = (name ~ /^\.(s)?bss/);
+
+        if (addr >= 134217728) {                         # 0x08000000
+            region = "ROM";   rom += bytes;
+        } else if (addr >= 50331648 && addr < 50364416) { # 0x03000000 ~ 0x03008000
+            region = "IWRAM"; iwram += bytes;
+            if (!nobits) rom += bytes;
+        } else if (addr >= 33554432 && addr < 33816576) { # 0x02000000 ~ 0x02040000
+            region = "EWRAM"; ewram += bytes;
+            if (!nobits) rom += bytes;
+        } else {
+            next;                                        # 디버그 정보 등 (로드 안 됨)
+        }
+        printf "%-16s %8d  0x%08x %s\n", name, bytes, addr, region;
+    }
+    END {
+        printf "----------------------------------------\n";
+        printf "ROM    %8d bytes\n", rom;
+        printf "IWRAM  %8d / %d bytes used, %d free for stack%s\n",
+               iwram, IWRAM_LIMIT, IWRAM_LIMIT - iwram, (iwram > IWRAM_LIMIT ? "  << OVERFLOW" : "");
+        printf "EWRAM  %8d / %d bytes used, %d free for heap%s\n",
+               ewram, EWRAM_LIMIT, EWRAM_LIMIT - ewram, (ewram > EWRAM_LIMIT ? "  << OVERFLOW" : "");
+    }'
+
+# nm -S --size-sort -r: "주소 크기 타입 이름", 큰 것부터
+# 타입 t/T(코드) 중 주소가 ROM(0x08xxxxxx)인 것 = IWRAM으로 옮길 후보
+echo "----------------------------------------"
+echo ">> Largest ROM-resident functions (top 20)"
+"${PREFIX}nm" -S --size-sort -r "$ELF" | awk '
+    # awk마다 16진수 변환 지원이 달라서 직접 변환
+    function hex(s,    i, v) {
+        v = 0;
+        for (i = 1; i <= length(s); ++i) v = v * 16 + index("0123456789abcdef", tolower(substr(s, i, 1))) - 1;
+        return v;
+    }
+    NF == 4 && $3 ~ /^[tT]$/ && hex($1) >= 134217728 {
+        printf "%8d  %s\n", hex($2), $4;
+        if (++n == 20) exit;
+    }'
+echo "========================================"
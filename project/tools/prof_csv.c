@@ -0,0 +1,45 @@
+// prof_csv.c
+// 프로파일러 로그 -> CSV 변환기 (include/prof.h 참고)
+// ---------------------------------------------------------
+// mGBA 로그(또는 호스트 빌드의 stdout)에서 "PROF,"가 들어 있는 줄만 골라
+// 앞부분(로그 레벨, 접두어 등)과 "PROF,"를 떼고 출력합니다.
+//
+//   gcc -O2 -o prof_csv tools/prof_csv.c
+//   ./prof_csv < mgba.log > frames.csv
+//
+// PROF_DUMP()를 여러 번 했다면 머리줄(frame,total,...)이 여러 번 나오며,
+// 같은 프레임 번호가 겹칠 수 있습니다. 마지막 덤프만 쓰려면 --last 옵션을 주세요.
+
+#include <stdio.h>
+#include <string.h>
+
+#define LINE_MAX_LEN 512
+#define MAX_LINES    4096 // --last 일 때 한 번의 덤프 최대 줄 수
+
+static char lines[MAX_LINES][LINE_MAX_LEN];
+
+int main(int argc, char** argv) {
+    char buf[LINE_MAX_LEN];
+    int  only_last = (argc > 1 && strcmp(argv[1], "--last") == 0);
+    int  count = 0;
+
+    while (fgets(buf, sizeof(buf), stdin)) {
+        char* p = strstr(buf, "PROF,");
+        if (!p) continue;
+
+        p += 5;
+        if (!only_last) {
+            fputs(p, stdout);
+            continue;
+        }
+
+        if (strncmp(p, "frame,", 6) == 0) count = 0; // 새 덤프 시작: 이전 내용 버림
+        if (count < MAX_LINES) {
+            strncpy(lines[count], p, LINE_MAX_LEN - 1);
+            ++count;
+        }
+    }
+
+    for (int i = 0; i < count; ++i) fputs(lines[i], stdout);
+    return 0;
+}